@@ -0,0 +1,60 @@
+/**
+ * @file      timer_interface_implementation.cpp
+ *
+ * @brief     Counters of the dynamic allocations made through operator new and delete.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __HEAP_STATISTICS_H__
+#define __HEAP_STATISTICS_H__
+
+#include <stdint.h>
+
+/*!
+ * @brief Statistics of the allocations made through operator new since boot or since the last reset
+ */
+typedef struct
+{
+    uint32_t allocation_count;     //!< Number of successful allocations
+    uint32_t free_count;           //!< Number of released allocations
+    uint32_t allocated_bytes;      //!< Bytes currently allocated
+    uint32_t allocated_bytes_max;  //!< Highest number of bytes allocated at once
+} heap_statistics_t;
+
+/*!
+ * @brief Get a copy of the heap statistics
+ *
+ * @param [out] statistics Pointer to the structure to fill
+ */
+void heap_statistics_get( heap_statistics_t* statistics );
+
+/*!
+ * @brief Reset the allocation and release counters, and restart the peak from the bytes currently allocated
+ */
+void heap_statistics_reset( void );
+
+#endif  // __HEAP_STATISTICS_H__
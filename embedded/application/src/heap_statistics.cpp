@@ -0,0 +1,107 @@
+/**
+ * @file      heap_statistics.cpp
+ *
+ * @brief     Replacement of the global operator new and delete counting the heap usage.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+#include <new>
+#include "heap_statistics.h"
+
+/*!
+ * @brief Size of the header kept in front of each allocation to remember its size. Eight bytes keep the pointer
+ * returned to the caller aligned the same way as the one returned by malloc
+ */
+#define HEAP_STATISTICS_HEADER_SIZE ( 8 )
+
+static heap_statistics_t heap_statistics = { 0 };
+
+static void* heap_statistics_allocate( size_t size )
+{
+    uint8_t* block = ( uint8_t* ) malloc( size + HEAP_STATISTICS_HEADER_SIZE );
+    if( block == nullptr )
+    {
+        return nullptr;
+    }
+
+    *( ( size_t* ) block ) = size;
+    heap_statistics.allocation_count++;
+    heap_statistics.allocated_bytes += size;
+    if( heap_statistics.allocated_bytes > heap_statistics.allocated_bytes_max )
+    {
+        heap_statistics.allocated_bytes_max = heap_statistics.allocated_bytes;
+    }
+    return block + HEAP_STATISTICS_HEADER_SIZE;
+}
+
+static void heap_statistics_release( void* pointer )
+{
+    if( pointer == nullptr )
+    {
+        return;
+    }
+
+    uint8_t* block = ( uint8_t* ) pointer - HEAP_STATISTICS_HEADER_SIZE;
+    heap_statistics.free_count++;
+    heap_statistics.allocated_bytes -= *( ( size_t* ) block );
+    free( block );
+}
+
+void heap_statistics_get( heap_statistics_t* statistics ) { *statistics = heap_statistics; }
+
+void heap_statistics_reset( void )
+{
+    heap_statistics.allocation_count    = 0;
+    heap_statistics.free_count          = 0;
+    heap_statistics.allocated_bytes_max = heap_statistics.allocated_bytes;
+}
+
+// Running out of heap is not recoverable on the board, so the throwing forms stop there instead of throwing
+void* operator new( size_t size )
+{
+    void* pointer = heap_statistics_allocate( size );
+    if( pointer == nullptr )
+    {
+        abort( );
+    }
+    return pointer;
+}
+
+void* operator new[]( size_t size ) { return operator new( size ); }
+
+void* operator new( size_t size, const std::nothrow_t& ) noexcept { return heap_statistics_allocate( size ); }
+
+void* operator new[]( size_t size, const std::nothrow_t& ) noexcept { return heap_statistics_allocate( size ); }
+
+void operator delete( void* pointer ) noexcept { heap_statistics_release( pointer ); }
+
+void operator delete[]( void* pointer ) noexcept { heap_statistics_release( pointer ); }
+
+void operator delete( void* pointer, const std::nothrow_t& ) noexcept { heap_statistics_release( pointer ); }
+
+void operator delete[]( void* pointer, const std::nothrow_t& ) noexcept { heap_statistics_release( pointer ); }
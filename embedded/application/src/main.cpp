@@ -59,10 +59,16 @@
 #include "command_reset.h"
 #include "command_update_almanac.h"
 #include "command_check_almanac_update.h"
+#include "command_get_power_statistics.h"
+#include "command_get_display_statistics.h"
+#include "command_get_heap_statistics.h"
+#include "command_get_almanac_signatures.h"
+#include "command_scheduler.h"
 
 #include "lvgl.h"
 #include "lv_port_disp.h"
 #include "lv_port_indev.h"
+#include "lv_port_img_rle.h"
 
 radio_t radio = {
     SPI1,
@@ -75,8 +81,8 @@ radio_t radio = {
 class Environment : public EnvironmentInterface
 {
    public:
-    virtual time_t GetLocalTimeSeconds( ) const { return system_time_GetTicker( ) / 1000; }
-    virtual time_t GetLocalTimeMilliseconds( ) const { return system_time_GetTicker( ); }
+    virtual time_t GetLocalTimeSeconds( ) const { return system_time_get_ms( ) / 1000; }
+    virtual time_t GetLocalTimeMilliseconds( ) const { return system_time_get_ms( ); }
 };
 
 class AntennaSelector : public AntennaSelectorInterface
@@ -222,6 +228,7 @@ int main( void )
     lv_init( );
     lv_port_disp_init( );
     lv_port_indev_init( );
+    lv_port_img_rle_init( );
 
     Environment          environment;
     AntennaSelector      antenna_selector;
@@ -232,6 +239,7 @@ int main( void )
     CommandFactory       command_factory;
     Hci                  hci( command_factory, environment );
     CommunicationManager communication_manager( &environment, &hci );
+    DemoScheduler        scheduler( &environment, &timer );
 
     environment_location_t default_location(
         { DEMO_ASSISTANCE_LOCATION_LATITUDE, DEMO_ASSISTANCE_LOCATION_LONGITUDE, DEMO_ASSISTANCE_LOCATION_ALTITUDE } );
@@ -274,14 +282,19 @@ int main( void )
                                                    ( ConnectivityManagerTransceiver* ) connectivity_manager );
     }
 
-    CommandGetVersion         com_get_version( hci );
-    CommandGetAlmanacDates    com_get_almanac_dates( device, hci );
-    CommandStartDemo          com_start( device, hci, *demo_manager );
-    CommandFetchResult        com_fetch_result( hci, environment, *demo_manager );
-    CommandSetDateLoc         com_set_date_loc( device, hci, environment );
-    CommandReset              com_reset( device, hci );
-    CommandUpdateAlmanac      com_update_almanac( device, hci );
-    CommandCheckAlmanacUpdate com_check_almanac_update( device, hci );
+    CommandGetVersion           com_get_version( hci );
+    CommandGetAlmanacDates      com_get_almanac_dates( device, hci );
+    CommandStartDemo            com_start( device, hci, *demo_manager );
+    CommandFetchResult          com_fetch_result( hci, environment, *demo_manager );
+    CommandSetDateLoc           com_set_date_loc( device, hci, environment );
+    CommandReset                com_reset( device, hci );
+    CommandUpdateAlmanac        com_update_almanac( device, hci );
+    CommandCheckAlmanacUpdate   com_check_almanac_update( device, hci );
+    CommandGetPowerStatistics   com_get_power_statistics( hci );
+    CommandGetDisplayStatistics com_get_display_statistics( hci );
+    CommandGetHeapStatistics    com_get_heap_statistics( hci );
+    CommandGetAlmanacSignatures com_get_almanac_signatures( device, hci );
+    CommandScheduler            com_scheduler( device, hci, scheduler );
 
     command_factory.AddCommandToPool( com_get_version );
     command_factory.AddCommandToPool( com_get_almanac_dates );
@@ -291,8 +304,14 @@ int main( void )
     command_factory.AddCommandToPool( com_reset );
     command_factory.AddCommandToPool( com_update_almanac );
     command_factory.AddCommandToPool( com_check_almanac_update );
-
-    Supervisor supervisor( &gui, device, demo_manager, &environment, &communication_manager, connectivity_manager );
+    command_factory.AddCommandToPool( com_get_power_statistics );
+    command_factory.AddCommandToPool( com_get_display_statistics );
+    command_factory.AddCommandToPool( com_get_heap_statistics );
+    command_factory.AddCommandToPool( com_get_almanac_signatures );
+    command_factory.AddCommandToPool( com_scheduler );
+
+    Supervisor supervisor( &gui, device, demo_manager, &environment, &communication_manager, connectivity_manager,
+                           &scheduler );
 
     device->Init( );
     supervisor.Init( );
@@ -50,14 +50,19 @@ Timer::~Timer( ) {}
 
 void Timer::set_and_start( uint32_t timeout_in_ms )
 {
-    uint32_t ticks_per_second = 32768 / 16;
+    const uint64_t timeout_in_ticks = ( ( uint64_t ) SYSTEM_LPTIM_TICKS_PER_SECOND * timeout_in_ms ) / 1000;
 
     this->clear_timer( );
-    system_lptim_set_and_run( ( ticks_per_second * timeout_in_ms ) / 1000 );
+    system_lptim_set_alarm( system_lptim_get_ticks( ) + timeout_in_ticks );
 }
 
 bool Timer::is_timer_elapsed( ) { return Timer::timer_elapsed; }
 
-void Timer::clear_timer( ) { Timer::timer_elapsed = false; }
+void Timer::clear_timer( )
+{
+    // Disarm the alarm first so that a compare match pending from a previous start cannot flag the timer again
+    system_lptim_stop_alarm( );
+    Timer::timer_elapsed = false;
+}
 
 void Timer::has_elapsed( ) { Timer::timer_elapsed = true; }
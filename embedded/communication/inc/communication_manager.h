@@ -34,6 +34,9 @@
 
 #include "environment_interface.h"
 #include "communication_interface.h"
+#include "communication_print_only.h"
+#include "communication_demo.h"
+#include "communication_field_test.h"
 #include "hci.h"
 
 typedef enum
@@ -45,6 +48,16 @@ typedef enum
     COMMUNICATION_MANAGER_UNKNOWN_HOST,
 } CommunicationManagerHostType_t;
 
+/*!
+ * @brief Union of the communication interfaces, only used to size and align the storage the active one is built in
+ */
+typedef union
+{
+    CommunicationPrintOnly print_only;
+    CommunicationDemo      demo;
+    CommunicationFieldTest field_test;
+} CommunicationManagerInterfaceStorage_t;
+
 class CommunicationManager : public CommunicationInterface
 {
    public:
@@ -73,7 +86,8 @@ class CommunicationManager : public CommunicationInterface
     bool                           SetFieldTestCommunication( );
 
    protected:
-    void SwapActiveInterface( CommunicationInterface* new_interface, CommunicationInterface** interface_to_delete );
+    void ReleaseActiveInterface( );
+    void SetActiveInterface( CommunicationInterface* new_interface );
     void HostDetectRuntime( );
     bool TestHostConnected( CommunicationManagerHostType_t* host_type );
     void SendConnectionTestResponse( );
@@ -93,6 +107,8 @@ class CommunicationManager : public CommunicationInterface
     static char*                   magic_token_demo;
     static char*                   magic_token_field_test;
     static char*                   magic_token_connection_test;
+    alignas( CommunicationManagerInterfaceStorage_t ) uint8_t
+        interface_storage[sizeof( CommunicationManagerInterfaceStorage_t )];
 };
 
 #endif  // __COMMUNICATION_MANAGER_H__
\ No newline at end of file
@@ -32,11 +32,9 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <new>
 #include "communication_utils.h"
 #include "communication_manager.h"
-#include "communication_print_only.h"
-#include "communication_demo.h"
-#include "communication_field_test.h"
 
 #define COMMUNICATION_MANAGER_MAGIC_TOKEN_SIZE ( 10 )
 #define COMMUNICATION_MANAGER_TIMEOUT_SERIAL_SHORT_RECEIVE_MS ( 100 )
@@ -49,7 +47,7 @@ char* CommunicationManager::magic_token_field_test      = ( char* ) COMMUNICATIO
 char* CommunicationManager::magic_token_connection_test = ( char* ) COMMUNICATION_MANAGER_MAGIC_TOKEN_CONNECTION_TEST;
 
 CommunicationManager::CommunicationManager( EnvironmentInterface* environment, Hci* hci )
-    : active_interface( new CommunicationPrintOnly( ) ),
+    : active_interface( new( interface_storage ) CommunicationPrintOnly( ) ),
       host_type( COMMUNICATION_MANAGER_NO_HOST ),
       has_host_just_changed( false ),
       environment( environment ),
@@ -57,7 +55,7 @@ CommunicationManager::CommunicationManager( EnvironmentInterface* environment, H
 {
 }
 
-CommunicationManager::~CommunicationManager( ) { delete this->active_interface; }
+CommunicationManager::~CommunicationManager( ) { this->active_interface->~CommunicationInterface( ); }
 
 bool CommunicationManager::TestHostConnected( CommunicationManagerHostType_t* host_type )
 {
@@ -167,69 +165,35 @@ bool CommunicationManager::HasHostJustChanged( CommunicationManagerHostType_t* h
 
 bool CommunicationManager::SetPrintfOnlyCommunication( )
 {
-    CommunicationInterface* tmp_interface_pointer = new CommunicationPrintOnly( );
-    bool                    success               = false;
-    if( tmp_interface_pointer != nullptr )
-    {
-        // Only delete previous active_interface if creating the new one succeeded.
-        // Otherwise, the instance will stay with a dangling pointer and destructor call will break something
-        CommunicationInterface* interface_to_delete = nullptr;
-        this->SwapActiveInterface( tmp_interface_pointer, &interface_to_delete );
-        delete interface_to_delete;
-        success = true;
-    }
-    else
-    {
-        success = false;
-    }
-    return success;
+    this->ReleaseActiveInterface( );
+    this->SetActiveInterface( new( this->interface_storage ) CommunicationPrintOnly( ) );
+    return true;
 }
 
 bool CommunicationManager::SetDemoCommunication( )
 {
-    CommunicationInterface* tmp_interface_pointer = new CommunicationDemo( );
-    bool                    success               = false;
-    if( tmp_interface_pointer != nullptr )
-    {
-        // Only delete previous active_interface if creating the new one succeeded.
-        // Otherwise, the instance will stay with a dangling pointer and destructor call will break something
-        CommunicationInterface* interface_to_delete = nullptr;
-        this->SwapActiveInterface( tmp_interface_pointer, &interface_to_delete );
-        delete interface_to_delete;
-        success = true;
-    }
-    else
-    {
-        success = false;
-    }
-    return success;
+    this->ReleaseActiveInterface( );
+    this->SetActiveInterface( new( this->interface_storage ) CommunicationDemo( ) );
+    return true;
 }
 
 bool CommunicationManager::SetFieldTestCommunication( )
 {
-    CommunicationInterface* tmp_interface_pointer = new CommunicationFieldTest( this->hci );
-    bool                    success               = false;
-    if( tmp_interface_pointer != nullptr )
-    {
-        // Only delete previous active_interface if creating the new one succeeded.
-        // Otherwise, the instance will stay with a dangling pointer and destructor call will break something
-        CommunicationInterface* interface_to_delete = nullptr;
-        this->SwapActiveInterface( tmp_interface_pointer, &interface_to_delete );
-        delete interface_to_delete;
-        success = true;
-    }
-    else
-    {
-        success = false;
-    }
-    return success;
+    this->ReleaseActiveInterface( );
+    this->SetActiveInterface( new( this->interface_storage ) CommunicationFieldTest( this->hci ) );
+    return true;
 }
 
-void CommunicationManager::SwapActiveInterface( CommunicationInterface*  new_interface,
-                                                CommunicationInterface** interface_to_delete )
+void CommunicationManager::ReleaseActiveInterface( )
 {
+    // The next interface is built in the same storage, so the current one must be torn down first
     this->active_interface->DeInit( );
-    *interface_to_delete   = this->active_interface;
+    this->active_interface->~CommunicationInterface( );
+    this->active_interface = nullptr;
+}
+
+void CommunicationManager::SetActiveInterface( CommunicationInterface* new_interface )
+{
     this->active_interface = new_interface;
     this->active_interface->Init( );
 }
@@ -70,6 +70,8 @@ typedef enum
 #define DEMO_WIFI_TIMEOUT_IN_MS_DEFAULT 110
 #define DEMO_WIFI_RESULT_TYPE_DEFAULT ( DEMO_WIFI_RESULT_TYPE_BASIC_COMPLETE )
 #define DEMO_WIFI_DOES_ABORT_ON_TIMEOUT_DEFAULT ( true )
+#define DEMO_WIFI_IS_CHANNEL_MASK_ADAPTIVE_DEFAULT ( false )
+#define DEMO_WIFI_DOES_SEARCH_COUNTRY_CODE_DEFAULT ( false )
 
 #define DEMO_GNSS_AUTONOMOUS_OPTION_DEFAULT ( DEMO_GNSS_OPTION_DEFAULT )
 #define DEMO_GNSS_AUTONOMOUS_CAPTURE_MODE_DEFAULT ( DEMO_GNSS_SCAN_MODE_3 )
@@ -82,14 +84,22 @@ typedef enum
 #define DEMO_GNSS_ASSISTED_N_SATELLLITE_DEFAULT ( 0 )
 #define DEMO_GNSS_ASSISTED_ANTENNA_SELECTION_DEFAULT ( DEMO_GNSS_NO_ANTENNA_SELECTION )
 #define DEMO_GNSS_ASSISTED_CONSTELLATION_MASK_DEFAULT ( DEMO_GNSS_GPS_MASK | DEMO_GNSS_BEIDOU_MASK )
+// Delay before a GNSS scan refused by a busy modem is issued again, and number of attempts before giving up
+#define DEMO_GNSS_MODEM_BUSY_RETRY_PERIOD_MS ( 100 )
+#define DEMO_GNSS_MODEM_BUSY_MAX_RETRIES ( 20 )
 
 #define DEMO_RADIO_RF_FREQUENCY_DEFAULT ( 868200000 )
 #define DEMO_RADIO_TX_POWER_DEFAULT ( 14 )
 #define DEMO_RADIO_PAYLOAD_LENGTH_DEFAULT ( 20 )
 #define DEMO_RADIO_NB_OF_PACKET_DEFAULT ( 10 )
+#define DEMO_RADIO_RX_SAMPLING_PERIOD_MS_DEFAULT ( 1000 )
+#define DEMO_RADIO_RX_SAMPLING_PERIOD_MS_MIN ( 100 )
+#define DEMO_RADIO_RX_SAMPLING_PERIOD_MS_MAX ( 60000 )
 #define DEMO_RADIO_PA_RAMP_TIME_DEFAULT ( LR1110_RADIO_RAMP_240_US )
 #define DEMO_RADIO_PA_DUTY_CYCLE_DEFAULT ( 4 )
 #define DEMO_RADIO_PA_HP_SEL_DEFAULT ( 0 )
+#define DEMO_RADIO_RF_FREQUENCY_MIN ( 150000000 )
+#define DEMO_RADIO_RF_FREQUENCY_MAX ( 960000000 )
 #define DEMO_RADIO_PA_REG_SUPPLY_DEFAULT ( LR1110_RADIO_PA_REG_SUPPLY_VREG )
 #define DEMO_RADIO_PA_SEL_DEFAULT ( LR1110_RADIO_PA_SEL_LP )
 #define DEMO_RADIO_PACKET_TYPE_DEFAULT ( LR1110_RADIO_PKT_TYPE_LORA )
@@ -114,12 +124,48 @@ typedef enum
 #define DEMO_PING_PONG_RX_TIMEOUT_DEFAULT ( 0xFFFFFFFF )
 #define DEMO_PING_PONG_TX_TIMEOUT_DEFAULT ( 0xFFFFFFFF )
 
+#define DEMO_SPECTRUM_SWEEP_MAX_CHANNELS ( 64 )
+#define DEMO_SPECTRUM_SWEEP_MAX_SAMPLES_PER_CHANNEL ( 32 )
+#define DEMO_SPECTRUM_SWEEP_START_FREQUENCY_DEFAULT ( 863000000 )
+#define DEMO_SPECTRUM_SWEEP_STEP_FREQUENCY_DEFAULT ( 200000 )
+#define DEMO_SPECTRUM_SWEEP_NB_CHANNELS_DEFAULT ( 36 )
+#define DEMO_SPECTRUM_SWEEP_NB_SAMPLES_DEFAULT ( 8 )
+#define DEMO_SPECTRUM_SWEEP_NB_SWEEPS_DEFAULT ( 0 )
+// Number of sweeps averaged into the RSSI means before the accumulation restarts, which keeps the sums within 32 bits
+#define DEMO_SPECTRUM_SWEEP_MEAN_WINDOW_SWEEPS ( 1024 )
+// Time left to the receiver after tuning to a channel, covering the RX-ready delay, before the first RSSI sample
+#define DEMO_SPECTRUM_SWEEP_SETTLE_TIME_MS ( 1 )
+// Time between two RSSI samples of a channel, so that the samples are spread over a known duration
+#define DEMO_SPECTRUM_SWEEP_SAMPLE_PERIOD_MS ( 1 )
+#define DEMO_SPECTRUM_SWEEP_RX_BW_DEFAULT ( LR1110_RADIO_GFSK_BW_187200 )
+
+#define DEMO_CAD_SNIFFER_MAX_CHANNELS ( 8 )
+#define DEMO_CAD_SNIFFER_NB_SF ( 8 )
+#define DEMO_CAD_SNIFFER_FREQUENCIES_DEFAULT \
+    { 868100000, 868300000, 868500000, 867100000, 867300000, 867500000, 867700000, 867900000 }
+#define DEMO_CAD_SNIFFER_NB_CHANNELS_DEFAULT ( 8 )
+#define DEMO_CAD_SNIFFER_SF_MASK_ALL ( 0x1FE0 )
+#define DEMO_CAD_SNIFFER_SF_MASK_DEFAULT ( 0x1F80 )
+#define DEMO_CAD_SNIFFER_BW_DEFAULT ( LR1110_RADIO_LORA_BW_125 )
+#define DEMO_CAD_SNIFFER_SYMB_NB_DEFAULT ( 2 )
+#define DEMO_CAD_SNIFFER_DETECT_PEAK_DEFAULT ( 0x32 )
+#define DEMO_CAD_SNIFFER_DETECT_MIN_DEFAULT ( 0x0A )
+#define DEMO_CAD_SNIFFER_NB_CYCLES_DEFAULT ( 0 )
+
+#define DEMO_RX_DUTY_CYCLE_RX_PERIOD_MS_DEFAULT ( 10 )
+#define DEMO_RX_DUTY_CYCLE_SLEEP_PERIOD_MS_DEFAULT ( 100 )
+#define DEMO_RX_DUTY_CYCLE_MAX_PERIOD_MS ( 511000 )
+// Typical LR1110 supply currents, used to estimate the average consumption of the duty-cycled receiver
+#define DEMO_RX_DUTY_CYCLE_RX_CURRENT_NA ( 5400000 )
+#define DEMO_RX_DUTY_CYCLE_SLEEP_CURRENT_NA ( 1600 )
+
 typedef struct
 {
     uint32_t                       rf_frequency;
     lr1110_radio_pa_cfg_t          pa_configuration;
     int8_t                         tx_power;
     uint32_t                       nb_of_packets;
+    uint32_t                       rx_sampling_period_ms;
     uint8_t                        payload_length;
     lr1110_radio_ramp_time_t       pa_ramp_time;
     lr1110_radio_pkt_type_t        pkt_type;
@@ -129,6 +175,34 @@ typedef struct
     lr1110_radio_pkt_params_lora_t packet_lora;
 } demo_radio_settings_t;
 
+typedef struct
+{
+    uint32_t               start_frequency_hz;
+    uint32_t               step_frequency_hz;
+    uint8_t                nb_channels;
+    uint8_t                nb_samples_per_channel;
+    uint16_t               nb_sweeps;
+    lr1110_radio_gfsk_bw_t rx_bandwidth;
+} demo_spectrum_sweep_settings_t;
+
+typedef struct
+{
+    uint32_t               frequencies_hz[DEMO_CAD_SNIFFER_MAX_CHANNELS];
+    uint8_t                nb_channels;
+    uint16_t               sf_mask;
+    lr1110_radio_lora_bw_t bandwidth;
+    uint8_t                cad_symb_nb;
+    uint8_t                cad_detect_peak;
+    uint8_t                cad_detect_min;
+    uint16_t               nb_cycles;
+} demo_cad_sniffer_settings_t;
+
+typedef struct
+{
+    uint32_t rx_period_ms;
+    uint32_t sleep_period_ms;
+} demo_rx_duty_cycle_settings_t;
+
 typedef struct
 {
     demo_wifi_settings_t              wifi_settings;
@@ -136,5 +210,8 @@ typedef struct
     demo_gnss_settings_t              gnss_autonomous_settings;
     demo_gnss_settings_t              gnss_assisted_settings;
     demo_radio_settings_t             radio_settings;
+    demo_spectrum_sweep_settings_t    spectrum_sweep_settings;
+    demo_cad_sniffer_settings_t       cad_sniffer_settings;
+    demo_rx_duty_cycle_settings_t     rx_duty_cycle_settings;
 } demo_all_settings_t;
 #endif
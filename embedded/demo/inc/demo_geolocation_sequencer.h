@@ -0,0 +1,100 @@
+/**
+ * @file      demo_geolocation_sequencer.h
+ *
+ * @brief     Definition of the Wi-Fi then GNSS geolocation sequencer demo.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __DEMO_GEOLOCATION_SEQUENCER_H__
+#define __DEMO_GEOLOCATION_SEQUENCER_H__
+
+#include "demo_interface.h"
+#include "demo_wifi_types.h"
+#include "demo_gnss_types.h"
+
+typedef enum
+{
+    DEMO_GEOLOCATION_STATE_INIT,
+    DEMO_GEOLOCATION_STATE_WIFI_SCAN,
+    DEMO_GEOLOCATION_STATE_GNSS_START,
+    DEMO_GEOLOCATION_STATE_GNSS_SCAN,
+    DEMO_GEOLOCATION_STATE_TERMINATED,
+} demo_geolocation_state_t;
+
+typedef enum
+{
+    DEMO_GEOLOCATION_STEP_NONE,
+    DEMO_GEOLOCATION_STEP_WIFI,
+    DEMO_GEOLOCATION_STEP_GNSS,
+} demo_geolocation_step_t;
+
+typedef struct
+{
+    demo_geolocation_step_t             last_completed_step;
+    const demo_wifi_scan_all_results_t* wifi_results;
+    const demo_gnss_all_results_t*      gnss_results;
+} demo_geolocation_results_t;
+
+/*
+ * Chains a Wi-Fi scan and a GNSS scan. The GNSS demo is started as soon as the Wi-Fi scan terminates, and the Wi-Fi
+ * results are only reported as intermediate results once the GNSS capture is running, so that handling them (and
+ * the uplink it may trigger) does not delay the capture nor compete with it on the modem. If the GNSS demo ends
+ * before its capture starts, the Wi-Fi results are reported alone and the GNSS step completes on the next runtime.
+ * The sequencer takes ownership of both demos.
+ */
+class DemoGeolocationSequencer : public DemoInterface
+{
+   public:
+    DemoGeolocationSequencer( DeviceInterface* device, SignalingInterface* signaling,
+                              CommunicationInterface* communication_interface, DemoInterface* wifi_demo,
+                              const demo_wifi_scan_all_results_t* wifi_results, DemoInterface* gnss_demo,
+                              const demo_gnss_all_results_t* gnss_results );
+    virtual ~DemoGeolocationSequencer( );
+
+    void                              Reset( ) override;
+    bool                              HasIntermediateResults( ) const override;
+    const demo_geolocation_results_t* GetResult( ) const;
+    DemoInterface*                    GetWifiDemo( ) const;
+    DemoInterface*                    GetGnssDemo( ) const;
+
+   protected:
+    void SpecificRuntime( ) override;
+    void SpecificStop( ) override;
+    void SpecificInterruptHandler( const InterruptionInterface* interruption ) override;
+    void ClearRegisteredIrqs( ) const override;
+
+    DemoInterface* GetActiveDemo( ) const;
+
+   private:
+    demo_geolocation_state_t   state;
+    DemoInterface*             wifi_demo;
+    DemoInterface*             gnss_demo;
+    demo_geolocation_results_t results;
+    bool                       has_intermediate_results;
+};
+
+#endif  // __DEMO_GEOLOCATION_SEQUENCER_H__
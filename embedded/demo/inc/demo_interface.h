@@ -59,6 +59,8 @@ class DemoInterface
     virtual void Reset( );
 
     virtual bool HasIntermediateResults( ) const;
+    // Tells whether a radio capture has been issued and is still running
+    virtual bool IsCaptureRunning( ) const;
 
     bool          IsStarted( ) const;
     demo_status_t GetStatus( ) const;
@@ -35,6 +35,11 @@
 #include <stddef.h>
 #include "demo_transceiver_radio_ping_pong.h"
 #include "demo_transceiver_radio_per.h"
+#include "demo_transceiver_radio_spectrum_sweep.h"
+#include "demo_transceiver_radio_cad_sniffer.h"
+#include "demo_transceiver_radio_rx_duty_cycle.h"
+#include "demo_geolocation_sequencer.h"
+#include "demo_wifi_channel_planner.h"
 #include "demo_configuration.h"
 #include "demo_interface.h"
 #include "antenna_selector_interface.h"
@@ -59,6 +64,10 @@ typedef enum
     DEMO_TYPE_RADIO_PER_RX,
     DEMO_TYPE_TEMPERATURE,
     DEMO_TYPE_FILE_UPLOAD,
+    DEMO_TYPE_SPECTRUM_SWEEP,
+    DEMO_TYPE_CAD_SNIFFER,
+    DEMO_TYPE_RADIO_RX_DUTY_CYCLE,
+    DEMO_TYPE_GEOLOCATION,
 } demo_type_t;
 
 class DemoManagerInterface
@@ -79,16 +88,23 @@ class DemoManagerInterface
     void GetConfigWifi( demo_wifi_settings_t* settings );
     void GetConfigAutonomousGnss( demo_gnss_settings_t* settings );
     void GetConfigAssistedGnss( demo_gnss_settings_t* settings );
+    void GetConfigSpectrumSweep( demo_spectrum_sweep_settings_t* settings );
+    void GetConfigCadSniffer( demo_cad_sniffer_settings_t* settings );
+    void GetConfigRxDutyCycle( demo_rx_duty_cycle_settings_t* settings );
     void UpdateConfigRadio( demo_radio_settings_t* radio_config );
     void UpdateConfigWifiScan( const demo_wifi_settings_t* wifi_config );
     void UpdateConfigWifiCountryCode( const demo_wifi_country_code_settings_t* wifi_config );
     void UpdateConfigAutonomousGnss( const demo_gnss_settings_t* gnss_autonomous_config );
     void UpdateConfigAssistedGnss( const demo_gnss_settings_t* gnss_assisted_config );
+    void UpdateConfigSpectrumSweep( const demo_spectrum_sweep_settings_t* spectrum_sweep_config );
+    void UpdateConfigCadSniffer( const demo_cad_sniffer_settings_t* cad_sniffer_config );
+    void UpdateConfigRxDutyCycle( const demo_rx_duty_cycle_settings_t* rx_duty_cycle_config );
 
     virtual void Start( demo_type_t demo_type ) = 0;
     void         Stop( );
     void         Reset( );
     bool         HasIntermediateResults( ) const;
+    bool         IsWaitingForInterrupt( ) const;
     void         InterruptHandler( const InterruptionInterface* interruption );
 
     demo_status_t Runtime( );
@@ -97,6 +113,9 @@ class DemoManagerInterface
     virtual void* GetResults( ) = 0;
 
    protected:
+    void PlanWifiSettings( demo_wifi_settings_t* settings );
+    void UpdateWifiChannelPlanner( );
+
     EnvironmentInterface*             environment;
     AntennaSelectorInterface*         antenna_selector;
     SignalingInterface*               signaling;
@@ -113,8 +132,15 @@ class DemoManagerInterface
     demo_gnss_settings_t              demo_gnss_assisted_settings_default;
     demo_radio_settings_t             demo_radio_settings;
     demo_radio_settings_t             demo_radio_settings_default;
+    demo_spectrum_sweep_settings_t    demo_spectrum_sweep_settings;
+    demo_spectrum_sweep_settings_t    demo_spectrum_sweep_settings_default;
+    demo_cad_sniffer_settings_t       demo_cad_sniffer_settings;
+    demo_cad_sniffer_settings_t       demo_cad_sniffer_settings_default;
+    demo_rx_duty_cycle_settings_t     demo_rx_duty_cycle_settings;
+    demo_rx_duty_cycle_settings_t     demo_rx_duty_cycle_settings_default;
     CommunicationInterface*           communication_interface;
     ConnectivityManagerInterface*     connectivity_interface;
+    DemoWifiChannelPlanner            wifi_channel_planner;
 };
 
 #endif  // __DEMO_MANAGER_INTERFACE_H__
@@ -44,6 +44,7 @@ typedef enum
 {
     DEMO_MODEM_GNSS_BASE_INIT,
     DEMO_MODEM_GNSS_BASE_SCAN,
+    DEMO_MODEM_GNSS_BASE_WAIT_FOR_MODEM_READY,
     DEMO_MODEM_GNSS_BASE_WAIT_FOR_SCAN,
     DEMO_MODEM_GNSS_BASE_TERMINATED,
     DEMO_MODEM_GNSS_BASE_ERROR,
@@ -61,6 +62,7 @@ class DemoModemGnssInterface : public DemoModemInterface
     virtual void SpecificRuntime( );
     virtual void SpecificStop( );
     virtual void SpecificInterruptHandler( );
+    virtual bool IsCaptureRunning( ) const;
 
     void                           Configure( demo_gnss_settings_t& config );
     const demo_gnss_all_results_t* GetResult( ) const;
@@ -137,6 +139,7 @@ class DemoModemGnssInterface : public DemoModemInterface
     demo_gnss_settings_t      settings;
     uint16_t                  instant_start_capture_ms;
     AntennaSelectorInterface* antenna_selector;
+    uint8_t                   nb_scan_retries;
 };
 
 #endif  // __DEMO_MODEM_GNSS_INTERFACE_H__
@@ -35,6 +35,8 @@
 #include "demo_modem_interface.h"
 #include "demo_configuration.h"
 #include "demo_per_results.h"
+#include "environment_interface.h"
+#include "timer_interface.h"
 
 typedef struct
 {
@@ -42,6 +44,7 @@ typedef struct
     lr1110_modem_tst_mode_sf_t sf;
     lr1110_modem_tst_mode_bw_t bw;
     lr1110_modem_tst_mode_cr_t cr;
+    uint32_t                   sampling_period_ms;
 } demo_radio_rx_continuous_settings_t;
 
 typedef enum
@@ -54,7 +57,8 @@ class DemoModemRadioRxContinuous : public DemoModemInterface
 {
    public:
     DemoModemRadioRxContinuous( DeviceModem* device, SignalingInterface* signaling,
-                                CommunicationInterface* communication_interface );
+                                CommunicationInterface* communication_interface, EnvironmentInterface* environment,
+                                TimerInterface* timer );
     virtual ~DemoModemRadioRxContinuous( );
 
     void                      SpecificRuntime( ) override;
@@ -66,10 +70,15 @@ class DemoModemRadioRxContinuous : public DemoModemInterface
    protected:
     static bool                             convert_radio_settings( const demo_radio_settings_t*         radio_settings,
                                                                     demo_radio_rx_continuous_settings_t* demo_radio_rx_continuous_settings );
+    void                                    SampleRxCounter( );
     demo_radio_rx_continuous_settings_t     settings;
     demo_modem_raxdio_rx_continuous_state_t state;
     bool                                    has_intermediate_results;
     demo_radio_per_results_t                results;
+    EnvironmentInterface*                   environment;
+    TimerInterface*                         timer;
+    uint32_t                                instant_start_ms;
+    uint32_t                                instant_last_sample_ms;
 };
 
 #endif  // __DEMO_MODEM_RADIO_RX_CONTINUOUS_H__
\ No newline at end of file
@@ -40,6 +40,8 @@ typedef struct
     uint32_t count_tx;
     uint32_t count_rx_timeout;
     int8_t   last_rssi;
+    float    rx_rate_instant_pps;
+    float    rx_rate_average_pps;
 } demo_radio_per_results_t;
 
 #endif  // __DEMO_PER_INTERFACE_H__
\ No newline at end of file
@@ -0,0 +1,90 @@
+/**
+ * @file      demo_scheduler.h
+ *
+ * @brief     Definition of the periodic scan scheduler.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __DEMO_SCHEDULER_H__
+#define __DEMO_SCHEDULER_H__
+
+#include "demo_manager_interface.h"
+#include "environment_interface.h"
+#include "timer_interface.h"
+
+#define DEMO_SCHEDULER_SINK_SERIAL ( 1 << 0 )
+#define DEMO_SCHEDULER_SINK_LORAWAN ( 1 << 1 )
+#define DEMO_SCHEDULER_SINK_ALL ( DEMO_SCHEDULER_SINK_SERIAL | DEMO_SCHEDULER_SINK_LORAWAN )
+
+#define DEMO_SCHEDULER_MAX_INTERVAL_S ( 86400 )
+
+typedef struct
+{
+    demo_type_t demo_type;
+    uint8_t     sinks;
+    uint16_t    nb_scans;  // 0 means no limit
+    uint32_t    interval_s;
+    uint32_t    max_interval_s;  // The interval is adaptive if greater than interval_s
+} demo_scheduler_settings_t;
+
+/*
+ * Starts a scan demo periodically without any host involvement. When the interval is adaptive, it is doubled after
+ * each scan that produced no result, up to the maximal interval, and set back to its initial value as soon as a scan
+ * produces results.
+ */
+class DemoScheduler
+{
+   public:
+    DemoScheduler( EnvironmentInterface* environment, TimerInterface* timer );
+    virtual ~DemoScheduler( );
+
+    void Configure( const demo_scheduler_settings_t& settings );
+    void Start( );
+    void Stop( );
+
+    bool        IsRunning( ) const;
+    bool        IsScanDue( ) const;
+    bool        IsScanOngoing( ) const;
+    demo_type_t GetDemoType( ) const;
+    uint8_t     GetSinks( ) const;
+
+    void ScanStarted( );
+    void ScanTerminated( const bool has_results );
+    void ArmWakeUp( );
+
+   private:
+    EnvironmentInterface*     environment;
+    TimerInterface*           timer;
+    demo_scheduler_settings_t settings;
+    bool                      is_running;
+    bool                      is_scan_ongoing;
+    uint16_t                  nb_scans_done;
+    uint32_t                  current_interval_s;
+    uint32_t                  next_scan_instant_ms;
+};
+
+#endif  // __DEMO_SCHEDULER_H__
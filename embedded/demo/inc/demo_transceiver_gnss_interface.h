@@ -61,6 +61,7 @@ class DemoTransceiverGnssInterface : public DemoTransceiverInterface
     void Reset( ) override;
     void SpecificRuntime( ) override;
     void SpecificStop( ) override;
+    bool IsCaptureRunning( ) const override;
 
     void                           Configure( demo_gnss_settings_t& config );
     const demo_gnss_all_results_t* GetResult( ) const;
@@ -0,0 +1,102 @@
+/**
+ * @file      demo_transceiver_radio_cad_sniffer.h
+ *
+ * @brief     Definition of the multi-channel CAD sniffer demo.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __DEMO_TRANSCEIVER_RADIO_CAD_SNIFFER_H__
+#define __DEMO_TRANSCEIVER_RADIO_CAD_SNIFFER_H__
+
+#include "demo_configuration.h"
+#include "demo_transceiver_interface.h"
+
+typedef enum
+{
+    DEMO_CAD_SNIFFER_STATE_INIT,
+    DEMO_CAD_SNIFFER_STATE_START_CAD,
+    DEMO_CAD_SNIFFER_STATE_WAIT_CAD_DONE,
+} demo_cad_sniffer_state_t;
+
+typedef struct
+{
+    uint32_t frequency_hz;
+    uint32_t nb_cad;
+    uint32_t nb_detections;
+    uint32_t cad_time_ms;
+    uint16_t activity_permille;
+    uint16_t detections_per_sf[DEMO_CAD_SNIFFER_NB_SF];
+} demo_cad_sniffer_channel_result_t;
+
+typedef struct
+{
+    uint8_t                           nb_channels;
+    uint16_t                          sf_mask;
+    uint16_t                          nb_cycles;
+    uint32_t                          elapsed_ms;
+    uint16_t                          cad_duty_cycle_permille;
+    demo_cad_sniffer_channel_result_t channels[DEMO_CAD_SNIFFER_MAX_CHANNELS];
+} demo_cad_sniffer_results_t;
+
+class DemoTransceiverRadioCadSniffer : public DemoTransceiverInterface
+{
+   public:
+    DemoTransceiverRadioCadSniffer( DeviceTransceiver* device, SignalingInterface* signaling,
+                                    CommunicationInterface* communication_interface,
+                                    EnvironmentInterface*   environment );
+    virtual ~DemoTransceiverRadioCadSniffer( );
+
+    void                              Configure( demo_cad_sniffer_settings_t& settings );
+    bool                              HasIntermediateResults( ) const override;
+    const demo_cad_sniffer_results_t* GetResult( ) const;
+
+   protected:
+    void SpecificRuntime( ) override;
+    void SpecificStop( ) override;
+    void ClearRegisteredIrqs( ) const override;
+
+    void ResetResults( );
+    void StartCad( ) const;
+    void HandleCadDone( );
+    bool SelectNextSpreadingFactor( );
+    void PublishCycle( );
+
+    static uint32_t GetCadDurationUs( const lr1110_radio_lora_sf_t sf, const lr1110_radio_lora_bw_t bw,
+                                      const uint8_t nb_symbols );
+
+   private:
+    demo_cad_sniffer_state_t    state;
+    demo_cad_sniffer_settings_t settings;
+    demo_cad_sniffer_results_t  results;
+    uint32_t                    cad_time_remainder_us[DEMO_CAD_SNIFFER_MAX_CHANNELS];
+    uint32_t                    start_instant_ms;
+    uint8_t                     current_channel;
+    uint8_t                     current_sf;
+    bool                        has_intermediate_results;
+};
+
+#endif  // __DEMO_TRANSCEIVER_RADIO_CAD_SNIFFER_H__
@@ -0,0 +1,86 @@
+/**
+ * @file      demo_transceiver_radio_rx_duty_cycle.h
+ *
+ * @brief     Definition of the duty-cycled RX demo for the transceiver.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __DEMO_TRANSCEIVER_RADIO_RX_DUTY_CYCLE_H__
+#define __DEMO_TRANSCEIVER_RADIO_RX_DUTY_CYCLE_H__
+
+#include "demo_configuration.h"
+#include "demo_transceiver_radio_interface.h"
+
+typedef enum
+{
+    DEMO_RX_DUTY_CYCLE_STATE_INIT,
+    DEMO_RX_DUTY_CYCLE_STATE_START,
+    DEMO_RX_DUTY_CYCLE_STATE_WAIT_FOR_EVENT,
+} demo_rx_duty_cycle_state_t;
+
+typedef struct
+{
+    uint32_t count_rx_correct_packet;
+    uint32_t count_rx_wrong_packet;
+    uint32_t count_preamble_detected;
+    uint32_t count_missed_preamble;
+    uint32_t rx_time_ms;
+    uint32_t sleep_time_ms;
+    uint32_t average_current_na;
+} demo_rx_duty_cycle_results_t;
+
+class DemoTransceiverRadioRxDutyCycle : public DemoTransceiverRadioInterface
+{
+   public:
+    DemoTransceiverRadioRxDutyCycle( DeviceTransceiver* device, SignalingInterface* signaling,
+                                     CommunicationInterface* communication_interface,
+                                     EnvironmentInterface*   environment );
+    virtual ~DemoTransceiverRadioRxDutyCycle( );
+
+    void                                ConfigureDutyCycle( demo_rx_duty_cycle_settings_t& settings );
+    bool                                HasIntermediateResults( ) const override;
+    const demo_rx_duty_cycle_results_t* GetResult( ) const;
+
+   protected:
+    void SpecificRuntime( ) override;
+    void SpecificStop( ) override;
+    void ClearRegisteredIrqs( ) const override;
+
+    void ConfigureRadio( ) const;
+    bool HandleEvent( );
+    void AccountTimeUntil( const uint32_t instant_ms );
+
+   private:
+    demo_rx_duty_cycle_state_t    state;
+    demo_rx_duty_cycle_settings_t duty_cycle_settings;
+    demo_rx_duty_cycle_results_t  results;
+    uint32_t                      last_accounting_instant_ms;
+    bool                          is_receiving_packet;
+    bool                          has_intermediate_results;
+};
+
+#endif  // __DEMO_TRANSCEIVER_RADIO_RX_DUTY_CYCLE_H__
@@ -0,0 +1,97 @@
+/**
+ * @file      demo_transceiver_radio_spectrum_sweep.h
+ *
+ * @brief     Definition of the RSSI spectrum sweep demo for the transceiver.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __DEMO_TRANSCEIVER_RADIO_SPECTRUM_SWEEP_H__
+#define __DEMO_TRANSCEIVER_RADIO_SPECTRUM_SWEEP_H__
+
+#include "demo_configuration.h"
+#include "demo_transceiver_interface.h"
+#include "timer_interface.h"
+
+typedef enum
+{
+    DEMO_SPECTRUM_SWEEP_STATE_INIT,
+    DEMO_SPECTRUM_SWEEP_STATE_TUNE,
+    DEMO_SPECTRUM_SWEEP_STATE_SAMPLE,
+} demo_spectrum_sweep_state_t;
+
+typedef struct
+{
+    int8_t rssi_min;
+    int8_t rssi_max;
+    int8_t rssi_mean;
+} demo_spectrum_sweep_channel_result_t;
+
+typedef struct
+{
+    uint32_t                             start_frequency_hz;
+    uint32_t                             step_frequency_hz;
+    uint8_t                              nb_channels;
+    uint16_t                             nb_sweeps;
+    demo_spectrum_sweep_channel_result_t channels[DEMO_SPECTRUM_SWEEP_MAX_CHANNELS];
+} demo_spectrum_sweep_results_t;
+
+class DemoTransceiverRadioSpectrumSweep : public DemoTransceiverInterface
+{
+   public:
+    DemoTransceiverRadioSpectrumSweep( DeviceTransceiver* device, SignalingInterface* signaling,
+                                       CommunicationInterface* communication_interface,
+                                       EnvironmentInterface* environment, TimerInterface* timer );
+    virtual ~DemoTransceiverRadioSpectrumSweep( );
+
+    void                                 Configure( demo_spectrum_sweep_settings_t& settings );
+    bool                                 HasIntermediateResults( ) const override;
+    const demo_spectrum_sweep_results_t* GetResult( ) const;
+
+   protected:
+    void SpecificRuntime( ) override;
+    void SpecificStop( ) override;
+    void ClearRegisteredIrqs( ) const override;
+
+    void ConfigureRadio( ) const;
+    void ResetResults( );
+    void TuneChannel( const uint8_t channel ) const;
+    void SampleChannel( const uint8_t channel );
+    void PublishSweep( );
+
+   private:
+    TimerInterface*                timer;
+    demo_spectrum_sweep_state_t    state;
+    demo_spectrum_sweep_settings_t settings;
+    demo_spectrum_sweep_results_t  results;
+    int32_t                        rssi_sums[DEMO_SPECTRUM_SWEEP_MAX_CHANNELS];
+    uint16_t                       nb_sweeps_in_window;
+    uint8_t                        current_channel;
+    uint8_t                        current_sample;
+    bool                           has_intermediate_results;
+};
+
+#endif  // __DEMO_TRANSCEIVER_RADIO_SPECTRUM_SWEEP_H__
@@ -67,6 +67,9 @@ class DemoTransceiverWifiInterface : public DemoTransceiverInterface
 
     virtual void ExecuteScan( radio_t* radio )         = 0;
     virtual void FetchAndSaveResults( radio_t* radio ) = 0;
+    virtual bool HasPendingScan( ) const;
+    virtual void AbortPendingScan( );
+    void         SaveCumulativeTimings( );
 
     static demo_wifi_timings_t demo_wifi_timing_from_transceiver(
         const lr1110_wifi_cumulative_timings_t& transceiver_timings );
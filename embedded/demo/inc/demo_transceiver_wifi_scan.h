@@ -42,21 +42,35 @@ class DemoTransceiverWifiScan : public DemoTransceiverWifiInterface
                              CommunicationInterface* communication_interface, EnvironmentInterface* environment );
     virtual ~DemoTransceiverWifiScan( );
 
+    void Reset( ) override;
     void Configure( demo_wifi_settings_t& config );
 
    protected:
     virtual void ExecuteScan( radio_t* radio );
     virtual void FetchAndSaveResults( radio_t* radio );
+    virtual bool HasPendingScan( ) const;
+    virtual void AbortPendingScan( );
+    virtual void FetchAndJoinCountryCodeResults( radio_t* radio );
     virtual void FetchAndSaveBasicCompleteResults( radio_t* radio );
     virtual void FetchAndSaveBasicMacChannelTypeResults( radio_t* radio );
+    virtual void FetchAndSaveExtendedFullResults( radio_t* radio );
     static void  AddScanToResults( const lr1110_system_reg_mode_t regMode, demo_wifi_scan_all_results_t& results,
                                    const lr1110_wifi_basic_complete_result_t* scan_result, const uint8_t nbr_results );
     static void  AddScanToResults( const lr1110_system_reg_mode_t regMode, demo_wifi_scan_all_results_t& results,
                                    const lr1110_wifi_basic_mac_type_channel_result_t* scan_result,
                                    const uint8_t                                      nbr_results );
+    static bool  AddScanToResults( demo_wifi_scan_all_results_t&             results,
+                                   demo_wifi_extended_results_t&             extended_results,
+                                   const lr1110_wifi_extended_full_result_t* scan_result );
+    static bool  StreamBasicCompleteResult( const lr1110_wifi_basic_complete_result_t* result, void* context );
+    static bool  StreamBasicMacChannelTypeResult( const lr1110_wifi_basic_mac_type_channel_result_t* result,
+                                                  void*                                              context );
+    static bool  StreamExtendedFullResult( const lr1110_wifi_extended_full_result_t* result, void* context );
 
    private:
-    demo_wifi_settings_t settings;
+    demo_wifi_settings_t         settings;
+    demo_wifi_extended_results_t extended_results;
+    bool                         is_searching_country_code;
 };
 
 #endif  //__DEMO_TRANSCEIVER_WIFI_SCAN_H__
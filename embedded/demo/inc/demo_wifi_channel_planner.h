@@ -0,0 +1,68 @@
+/**
+ * @file      demo_wifi_channel_planner.h
+ *
+ * @brief     Definition of the Wi-Fi channel planner.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __DEMO_WIFI_CHANNEL_PLANNER_H__
+#define __DEMO_WIFI_CHANNEL_PLANNER_H__
+
+#include <stdint.h>
+#include "demo_wifi_types.h"
+
+#define DEMO_WIFI_CHANNEL_PLANNER_NB_CHANNELS ( 14 )
+#define DEMO_WIFI_CHANNEL_PLANNER_MAX_SCANS_WITHOUT_HIT ( 4 )
+#define DEMO_WIFI_CHANNEL_PLANNER_MAX_NARROWED_SCANS ( 7 )
+
+/*
+ * Keeps per-channel hit statistics across Wi-Fi scans to narrow the channel mask to the channels that recently
+ * produced results. The whole configured mask is scanned on the first scan, after a narrowed scan without result and
+ * at least once every DEMO_WIFI_CHANNEL_PLANNER_MAX_NARROWED_SCANS + 1 scans, so that new access points are found.
+ */
+class DemoWifiChannelPlanner
+{
+   public:
+    DemoWifiChannelPlanner( );
+    virtual ~DemoWifiChannelPlanner( );
+
+    void                     Reset( );
+    demo_wifi_channel_mask_t Plan( const demo_wifi_channel_mask_t configured_mask );
+    void                     Update( const demo_wifi_scan_all_results_t* results );
+
+   protected:
+    demo_wifi_channel_mask_t GetActiveChannelMask( ) const;
+
+   private:
+    uint8_t                  nb_scans_without_hit[DEMO_WIFI_CHANNEL_PLANNER_NB_CHANNELS];
+    uint8_t                  nb_narrowed_scans;
+    demo_wifi_channel_mask_t planned_mask;
+    bool                     is_planned_full_sweep;
+    bool                     is_full_sweep_requested;
+};
+
+#endif  // __DEMO_WIFI_CHANNEL_PLANNER_H__
@@ -6,6 +6,9 @@
 #define DEMO_WIFI_STR_COUNTRY_CODE_SIZE ( 2 )
 #define DEMO_WIFI_MAX_RESULT_TOTAL ( 32 )
 #define DEMO_TYPE_WIFI_MAC_ADDRESS_LENGTH ( 6 )
+#define DEMO_WIFI_SSID_MAX_LENGTH ( 32 )
+#define DEMO_WIFI_EXTENDED_ARENA_SIZE ( 640 )
+#define DEMO_WIFI_EXTENDED_RECORD_HEADER_SIZE ( 10 )
 
 typedef struct DemoWifiTimings
 {
@@ -33,19 +36,35 @@ typedef struct
     uint8_t                 country_code[DEMO_WIFI_STR_COUNTRY_CODE_SIZE];
 } demo_wifi_scan_single_result_t;
 
+/*
+ * Extended results are stored back to back in a byte arena, so that the memory used depends on the SSID lengths
+ * rather than on the largest possible result. Each record is laid out as:
+ * MAC address (6 bytes) | channel (1) | type (1) | RSSI (1) | SSID length (1) | SSID (SSID length bytes)
+ */
 typedef struct
 {
-    uint8_t                        nbrResults;
-    demo_wifi_scan_single_result_t results[DEMO_WIFI_MAX_RESULT_TOTAL];
-    demo_wifi_timings_t            timings;
-    uint32_t                       global_consumption_uas;
-    bool                           error;
+    uint8_t  nb_records;
+    uint16_t length;
+    uint8_t  arena[DEMO_WIFI_EXTENDED_ARENA_SIZE];
+} demo_wifi_extended_results_t;
+
+typedef struct
+{
+    uint8_t                             nbrResults;
+    demo_wifi_scan_single_result_t      results[DEMO_WIFI_MAX_RESULT_TOTAL];
+    demo_wifi_timings_t                 timings;
+    uint32_t                            global_consumption_uas;
+    bool                                error;
+    bool                                has_country_codes;   // true when a country code search was chained
+    bool                                country_code_error;  // the chained country code search failed
+    const demo_wifi_extended_results_t* extended_results;    // NULL unless extended results are captured
 } demo_wifi_scan_all_results_t;
 
 typedef enum
 {
     DEMO_WIFI_RESULT_TYPE_BASIC_COMPLETE,
     DEMO_WIFI_RESULT_TYPE_BASIC_MAC_TYPE_CHANNEL,
+    DEMO_WIFI_RESULT_TYPE_EXTENDED_FULL,
 } demo_wifi_result_type_t;
 
 typedef uint16_t demo_wifi_channel_mask_t;
@@ -74,6 +93,8 @@ typedef struct
     uint16_t                     timeout;
     bool                         does_abort_on_timeout;
     demo_wifi_result_type_t      result_type;
+    bool                         is_channel_mask_adaptive;
+    bool                         does_search_country_code;
 } demo_wifi_settings_t;
 
 typedef struct
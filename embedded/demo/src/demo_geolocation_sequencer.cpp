@@ -0,0 +1,189 @@
+/**
+ * @file      demo_geolocation_sequencer.cpp
+ *
+ * @brief     Implementation of the Wi-Fi then GNSS geolocation sequencer demo.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "demo_geolocation_sequencer.h"
+
+DemoGeolocationSequencer::DemoGeolocationSequencer( DeviceInterface* device, SignalingInterface* signaling,
+                                                    CommunicationInterface*             communication_interface,
+                                                    DemoInterface*                      wifi_demo,
+                                                    const demo_wifi_scan_all_results_t* wifi_results,
+                                                    DemoInterface*                      gnss_demo,
+                                                    const demo_gnss_all_results_t*      gnss_results )
+    : DemoInterface( device, signaling, communication_interface ),
+      state( DEMO_GEOLOCATION_STATE_INIT ),
+      wifi_demo( wifi_demo ),
+      gnss_demo( gnss_demo ),
+      has_intermediate_results( false )
+{
+    this->results.last_completed_step = DEMO_GEOLOCATION_STEP_NONE;
+    this->results.wifi_results        = wifi_results;
+    this->results.gnss_results        = gnss_results;
+}
+
+DemoGeolocationSequencer::~DemoGeolocationSequencer( )
+{
+    delete this->wifi_demo;
+    delete this->gnss_demo;
+}
+
+void DemoGeolocationSequencer::Reset( )
+{
+    this->DemoInterface::Reset( );
+    this->wifi_demo->Reset( );
+    this->gnss_demo->Reset( );
+    this->state                       = DEMO_GEOLOCATION_STATE_INIT;
+    this->results.last_completed_step = DEMO_GEOLOCATION_STEP_NONE;
+    this->has_intermediate_results    = false;
+}
+
+void DemoGeolocationSequencer::SpecificRuntime( )
+{
+    // The intermediate results are only flagged for the runtime call that produced them
+    this->has_intermediate_results = false;
+
+    switch( this->state )
+    {
+    case DEMO_GEOLOCATION_STATE_INIT:
+    {
+        this->wifi_demo->Start( );
+        this->state = DEMO_GEOLOCATION_STATE_WIFI_SCAN;
+        break;
+    }
+
+    case DEMO_GEOLOCATION_STATE_WIFI_SCAN:
+    {
+        if( this->wifi_demo->Runtime( ) == DEMO_STATUS_TERMINATED )
+        {
+            this->wifi_demo->Stop( );
+
+            // The Wi-Fi results are held back until the GNSS capture is in flight
+            this->gnss_demo->Start( );
+            this->state = DEMO_GEOLOCATION_STATE_GNSS_START;
+        }
+        else if( this->wifi_demo->IsWaitingForInterrupt( ) )
+        {
+            this->SetWaitingForInterrupt( );
+        }
+        break;
+    }
+
+    case DEMO_GEOLOCATION_STATE_GNSS_START:
+    {
+        const demo_status_t gnss_status = this->gnss_demo->Runtime( );
+
+        if( gnss_status == DEMO_STATUS_TERMINATED )
+        {
+            // The GNSS demo ended without capturing (e.g. no location or scan refused): report the Wi-Fi results
+            // now and the GNSS ones on the next runtime call
+            this->gnss_demo->Stop( );
+            this->results.last_completed_step = DEMO_GEOLOCATION_STEP_WIFI;
+            this->has_intermediate_results    = true;
+            this->state                       = DEMO_GEOLOCATION_STATE_TERMINATED;
+        }
+        else if( this->gnss_demo->IsCaptureRunning( ) )
+        {
+            this->results.last_completed_step = DEMO_GEOLOCATION_STEP_WIFI;
+            this->has_intermediate_results    = true;
+            this->state                       = DEMO_GEOLOCATION_STATE_GNSS_SCAN;
+        }
+
+        if( this->gnss_demo->IsWaitingForInterrupt( ) )
+        {
+            this->SetWaitingForInterrupt( );
+        }
+        break;
+    }
+
+    case DEMO_GEOLOCATION_STATE_GNSS_SCAN:
+    {
+        if( this->gnss_demo->Runtime( ) == DEMO_STATUS_TERMINATED )
+        {
+            this->gnss_demo->Stop( );
+            this->results.last_completed_step = DEMO_GEOLOCATION_STEP_GNSS;
+            this->Terminate( );
+        }
+        else if( this->gnss_demo->IsWaitingForInterrupt( ) )
+        {
+            this->SetWaitingForInterrupt( );
+        }
+        break;
+    }
+
+    case DEMO_GEOLOCATION_STATE_TERMINATED:
+    {
+        this->results.last_completed_step = DEMO_GEOLOCATION_STEP_GNSS;
+        this->Terminate( );
+        break;
+    }
+    }
+}
+
+void DemoGeolocationSequencer::SpecificStop( )
+{
+    DemoInterface* active_demo = this->GetActiveDemo( );
+    if( ( active_demo != NULL ) && ( active_demo->IsStarted( ) ) )
+    {
+        active_demo->Stop( );
+    }
+}
+
+void DemoGeolocationSequencer::SpecificInterruptHandler( const InterruptionInterface* interruption )
+{
+    DemoInterface* active_demo = this->GetActiveDemo( );
+    if( active_demo != NULL )
+    {
+        active_demo->InterruptHandler( interruption );
+    }
+}
+
+void DemoGeolocationSequencer::ClearRegisteredIrqs( ) const {}
+
+bool DemoGeolocationSequencer::HasIntermediateResults( ) const { return this->has_intermediate_results; }
+
+const demo_geolocation_results_t* DemoGeolocationSequencer::GetResult( ) const { return &this->results; }
+
+DemoInterface* DemoGeolocationSequencer::GetWifiDemo( ) const { return this->wifi_demo; }
+
+DemoInterface* DemoGeolocationSequencer::GetGnssDemo( ) const { return this->gnss_demo; }
+
+DemoInterface* DemoGeolocationSequencer::GetActiveDemo( ) const
+{
+    switch( this->state )
+    {
+    case DEMO_GEOLOCATION_STATE_WIFI_SCAN:
+        return this->wifi_demo;
+    case DEMO_GEOLOCATION_STATE_GNSS_START:
+    case DEMO_GEOLOCATION_STATE_GNSS_SCAN:
+        return this->gnss_demo;
+    default:
+        return NULL;
+    }
+}
@@ -45,6 +45,8 @@ DemoInterface::DemoInterface( DeviceInterface* device, SignalingInterface* signa
 
 bool DemoInterface::HasIntermediateResults( ) const { return false; }
 
+bool DemoInterface::IsCaptureRunning( ) const { return false; }
+
 DemoInterface::~DemoInterface( ) {}
 
 demo_status_t DemoInterface::GetStatus( ) const { return this->status; }
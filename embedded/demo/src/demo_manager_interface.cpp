@@ -44,14 +44,16 @@ DemoManagerInterface::DemoManagerInterface( EnvironmentInterface*     environmen
       communication_interface( communication_interface ),
       connectivity_interface( connectivity_interface )
 {
-    this->demo_wifi_settings_default.channels              = DEMO_WIFI_CHANNELS_DEFAULT >> 1;
-    this->demo_wifi_settings_default.types                 = DEMO_WIFI_TYPE_SCAN_DEFAULT;
-    this->demo_wifi_settings_default.scan_mode             = DEMO_WIFI_MODE_DEFAULT;
-    this->demo_wifi_settings_default.nbr_retrials          = DEMO_WIFI_NBR_RETRIALS_DEFAULT;
-    this->demo_wifi_settings_default.max_results           = DEMO_WIFI_MAX_RESULTS_DEFAULT;
-    this->demo_wifi_settings_default.timeout               = DEMO_WIFI_TIMEOUT_IN_MS_DEFAULT;
-    this->demo_wifi_settings_default.result_type           = DEMO_WIFI_RESULT_TYPE_DEFAULT;
-    this->demo_wifi_settings_default.does_abort_on_timeout = DEMO_WIFI_DOES_ABORT_ON_TIMEOUT_DEFAULT;
+    this->demo_wifi_settings_default.channels                 = DEMO_WIFI_CHANNELS_DEFAULT >> 1;
+    this->demo_wifi_settings_default.types                    = DEMO_WIFI_TYPE_SCAN_DEFAULT;
+    this->demo_wifi_settings_default.scan_mode                = DEMO_WIFI_MODE_DEFAULT;
+    this->demo_wifi_settings_default.nbr_retrials             = DEMO_WIFI_NBR_RETRIALS_DEFAULT;
+    this->demo_wifi_settings_default.max_results              = DEMO_WIFI_MAX_RESULTS_DEFAULT;
+    this->demo_wifi_settings_default.timeout                  = DEMO_WIFI_TIMEOUT_IN_MS_DEFAULT;
+    this->demo_wifi_settings_default.result_type              = DEMO_WIFI_RESULT_TYPE_DEFAULT;
+    this->demo_wifi_settings_default.does_abort_on_timeout    = DEMO_WIFI_DOES_ABORT_ON_TIMEOUT_DEFAULT;
+    this->demo_wifi_settings_default.is_channel_mask_adaptive = DEMO_WIFI_IS_CHANNEL_MASK_ADAPTIVE_DEFAULT;
+    this->demo_wifi_settings_default.does_search_country_code = DEMO_WIFI_DOES_SEARCH_COUNTRY_CODE_DEFAULT;
 
     this->demo_wifi_country_code_settings_default.channels              = DEMO_WIFI_CHANNELS_DEFAULT >> 1;
     this->demo_wifi_country_code_settings_default.nbr_retrials          = DEMO_WIFI_NBR_RETRIALS_DEFAULT;
@@ -74,6 +76,7 @@ DemoManagerInterface::DemoManagerInterface( EnvironmentInterface*     environmen
     this->demo_radio_settings_default.rf_frequency                      = DEMO_RADIO_RF_FREQUENCY_DEFAULT;
     this->demo_radio_settings_default.tx_power                          = DEMO_RADIO_TX_POWER_DEFAULT;
     this->demo_radio_settings_default.nb_of_packets                     = DEMO_RADIO_NB_OF_PACKET_DEFAULT;
+    this->demo_radio_settings_default.rx_sampling_period_ms             = DEMO_RADIO_RX_SAMPLING_PERIOD_MS_DEFAULT;
     this->demo_radio_settings_default.payload_length                    = DEMO_RADIO_PAYLOAD_LENGTH_DEFAULT;
     this->demo_radio_settings_default.pa_ramp_time                      = DEMO_RADIO_PA_RAMP_TIME_DEFAULT;
     this->demo_radio_settings_default.pa_configuration.pa_duty_cycle    = DEMO_RADIO_PA_DUTY_CYCLE_DEFAULT;
@@ -100,6 +103,29 @@ DemoManagerInterface::DemoManagerInterface( EnvironmentInterface*     environmen
     this->demo_radio_settings_default.packet_gfsk.preamble_detector     = DEMO_RADIO_GFSK_PBL_DETECT_DEFAULT;
     this->demo_radio_settings_default.packet_gfsk.preamble_len_in_bits  = DEMO_RADIO_GFSK_PBL_LENGTH_DEFAULT;
     this->demo_radio_settings_default.packet_gfsk.sync_word_len_in_bits = DEMO_RADIO_GFSK_SW_LENGTH_DEFAULT;
+
+    this->demo_spectrum_sweep_settings_default.start_frequency_hz     = DEMO_SPECTRUM_SWEEP_START_FREQUENCY_DEFAULT;
+    this->demo_spectrum_sweep_settings_default.step_frequency_hz      = DEMO_SPECTRUM_SWEEP_STEP_FREQUENCY_DEFAULT;
+    this->demo_spectrum_sweep_settings_default.nb_channels            = DEMO_SPECTRUM_SWEEP_NB_CHANNELS_DEFAULT;
+    this->demo_spectrum_sweep_settings_default.nb_samples_per_channel = DEMO_SPECTRUM_SWEEP_NB_SAMPLES_DEFAULT;
+    this->demo_spectrum_sweep_settings_default.nb_sweeps              = DEMO_SPECTRUM_SWEEP_NB_SWEEPS_DEFAULT;
+    this->demo_spectrum_sweep_settings_default.rx_bandwidth           = DEMO_SPECTRUM_SWEEP_RX_BW_DEFAULT;
+
+    const uint32_t cad_sniffer_frequencies_hz[DEMO_CAD_SNIFFER_MAX_CHANNELS] = DEMO_CAD_SNIFFER_FREQUENCIES_DEFAULT;
+    for( uint8_t channel = 0; channel < DEMO_CAD_SNIFFER_MAX_CHANNELS; channel++ )
+    {
+        this->demo_cad_sniffer_settings_default.frequencies_hz[channel] = cad_sniffer_frequencies_hz[channel];
+    }
+    this->demo_cad_sniffer_settings_default.nb_channels     = DEMO_CAD_SNIFFER_NB_CHANNELS_DEFAULT;
+    this->demo_cad_sniffer_settings_default.sf_mask         = DEMO_CAD_SNIFFER_SF_MASK_DEFAULT;
+    this->demo_cad_sniffer_settings_default.bandwidth       = DEMO_CAD_SNIFFER_BW_DEFAULT;
+    this->demo_cad_sniffer_settings_default.cad_symb_nb     = DEMO_CAD_SNIFFER_SYMB_NB_DEFAULT;
+    this->demo_cad_sniffer_settings_default.cad_detect_peak = DEMO_CAD_SNIFFER_DETECT_PEAK_DEFAULT;
+    this->demo_cad_sniffer_settings_default.cad_detect_min  = DEMO_CAD_SNIFFER_DETECT_MIN_DEFAULT;
+    this->demo_cad_sniffer_settings_default.nb_cycles       = DEMO_CAD_SNIFFER_NB_CYCLES_DEFAULT;
+
+    this->demo_rx_duty_cycle_settings_default.rx_period_ms    = DEMO_RX_DUTY_CYCLE_RX_PERIOD_MS_DEFAULT;
+    this->demo_rx_duty_cycle_settings_default.sleep_period_ms = DEMO_RX_DUTY_CYCLE_SLEEP_PERIOD_MS_DEFAULT;
 }
 
 DemoManagerInterface::~DemoManagerInterface( ) {}
@@ -115,6 +141,9 @@ void DemoManagerInterface::Init( )
     this->SetConfigToDefault( DEMO_TYPE_RADIO_PER_RX );
     this->SetConfigToDefault( DEMO_TYPE_TX_CW );
     this->SetConfigToDefault( DEMO_TYPE_TEMPERATURE );
+    this->SetConfigToDefault( DEMO_TYPE_SPECTRUM_SWEEP );
+    this->SetConfigToDefault( DEMO_TYPE_CAD_SNIFFER );
+    this->SetConfigToDefault( DEMO_TYPE_RADIO_RX_DUTY_CYCLE );
 }
 
 void DemoManagerInterface::SetConfigToDefault( demo_type_t demo_type )
@@ -153,6 +182,21 @@ void DemoManagerInterface::SetConfigToDefault( demo_type_t demo_type )
         this->demo_radio_settings = this->demo_radio_settings_default;
         break;
     }
+    case DEMO_TYPE_RADIO_RX_DUTY_CYCLE:
+    {
+        this->demo_rx_duty_cycle_settings = this->demo_rx_duty_cycle_settings_default;
+        break;
+    }
+    case DEMO_TYPE_SPECTRUM_SWEEP:
+    {
+        this->demo_spectrum_sweep_settings = this->demo_spectrum_sweep_settings_default;
+        break;
+    }
+    case DEMO_TYPE_CAD_SNIFFER:
+    {
+        this->demo_cad_sniffer_settings = this->demo_cad_sniffer_settings_default;
+        break;
+    }
     case DEMO_TYPE_TEMPERATURE:
     default:
         break;
@@ -166,6 +210,9 @@ void DemoManagerInterface::GetConfigDefault( demo_all_settings_t* settings )
     settings->gnss_autonomous_settings   = this->demo_gnss_autonomous_settings_default;
     settings->gnss_assisted_settings     = this->demo_gnss_assisted_settings_default;
     settings->radio_settings             = this->demo_radio_settings_default;
+    settings->spectrum_sweep_settings    = this->demo_spectrum_sweep_settings_default;
+    settings->cad_sniffer_settings       = this->demo_cad_sniffer_settings_default;
+    settings->rx_duty_cycle_settings     = this->demo_rx_duty_cycle_settings_default;
 }
 
 void DemoManagerInterface::GetConfig( demo_all_settings_t* settings )
@@ -175,6 +222,9 @@ void DemoManagerInterface::GetConfig( demo_all_settings_t* settings )
     settings->gnss_autonomous_settings   = this->demo_gnss_autonomous_settings;
     settings->gnss_assisted_settings     = this->demo_gnss_assisted_settings;
     settings->radio_settings             = this->demo_radio_settings;
+    settings->spectrum_sweep_settings    = this->demo_spectrum_sweep_settings;
+    settings->cad_sniffer_settings       = this->demo_cad_sniffer_settings;
+    settings->rx_duty_cycle_settings     = this->demo_rx_duty_cycle_settings;
 }
 
 void DemoManagerInterface::GetConfigRadio( demo_radio_settings_t* settings ) { *settings = this->demo_radio_settings; }
@@ -191,6 +241,21 @@ void DemoManagerInterface::GetConfigAssistedGnss( demo_gnss_settings_t* settings
     *settings = this->demo_gnss_assisted_settings;
 }
 
+void DemoManagerInterface::GetConfigSpectrumSweep( demo_spectrum_sweep_settings_t* settings )
+{
+    *settings = this->demo_spectrum_sweep_settings;
+}
+
+void DemoManagerInterface::GetConfigCadSniffer( demo_cad_sniffer_settings_t* settings )
+{
+    *settings = this->demo_cad_sniffer_settings;
+}
+
+void DemoManagerInterface::GetConfigRxDutyCycle( demo_rx_duty_cycle_settings_t* settings )
+{
+    *settings = this->demo_rx_duty_cycle_settings;
+}
+
 void DemoManagerInterface::UpdateConfigRadio( demo_radio_settings_t* radio_config )
 {
     this->demo_radio_settings = *radio_config;
@@ -216,6 +281,21 @@ void DemoManagerInterface::UpdateConfigAssistedGnss( const demo_gnss_settings_t*
     this->demo_gnss_assisted_settings = *gnss_assisted_config;
 }
 
+void DemoManagerInterface::UpdateConfigSpectrumSweep( const demo_spectrum_sweep_settings_t* spectrum_sweep_config )
+{
+    this->demo_spectrum_sweep_settings = *spectrum_sweep_config;
+}
+
+void DemoManagerInterface::UpdateConfigCadSniffer( const demo_cad_sniffer_settings_t* cad_sniffer_config )
+{
+    this->demo_cad_sniffer_settings = *cad_sniffer_config;
+}
+
+void DemoManagerInterface::UpdateConfigRxDutyCycle( const demo_rx_duty_cycle_settings_t* rx_duty_cycle_config )
+{
+    this->demo_rx_duty_cycle_settings = *rx_duty_cycle_config;
+}
+
 void DemoManagerInterface::Stop( )
 {
     if( this->running_demo )
@@ -244,6 +324,18 @@ bool DemoManagerInterface::HasIntermediateResults( ) const
     }
 }
 
+bool DemoManagerInterface::IsWaitingForInterrupt( ) const
+{
+    if( this->running_demo )
+    {
+        return this->running_demo->IsWaitingForInterrupt( );
+    }
+    else
+    {
+        return false;
+    }
+}
+
 void DemoManagerInterface::InterruptHandler( const InterruptionInterface* interruption )
 {
     if( this->running_demo )
@@ -252,6 +344,53 @@ void DemoManagerInterface::InterruptHandler( const InterruptionInterface* interr
     }
 }
 
-demo_status_t DemoManagerInterface::Runtime( ) { return this->running_demo->Runtime( ); }
+demo_status_t DemoManagerInterface::Runtime( )
+{
+    if( this->running_demo )
+    {
+        const demo_status_t status = this->running_demo->Runtime( );
+        if( status == DEMO_STATUS_TERMINATED )
+        {
+            this->UpdateWifiChannelPlanner( );
+        }
+        return status;
+    }
+    else
+    {
+        return DEMO_STATUS_SKIPPED;
+    }
+}
 
 demo_type_t DemoManagerInterface::GetType( ) { return this->demo_type_current; }
+
+void DemoManagerInterface::PlanWifiSettings( demo_wifi_settings_t* settings )
+{
+    *settings = this->demo_wifi_settings;
+    if( this->demo_wifi_settings.is_channel_mask_adaptive == true )
+    {
+        settings->channels = this->wifi_channel_planner.Plan( this->demo_wifi_settings.channels );
+    }
+}
+
+void DemoManagerInterface::UpdateWifiChannelPlanner( )
+{
+    switch( this->demo_type_current )
+    {
+    case DEMO_TYPE_WIFI:
+    {
+        this->wifi_channel_planner.Update( ( const demo_wifi_scan_all_results_t* ) this->GetResults( ) );
+        break;
+    }
+    case DEMO_TYPE_GEOLOCATION:
+    {
+        const demo_geolocation_results_t* results = ( const demo_geolocation_results_t* ) this->GetResults( );
+        if( results->last_completed_step != DEMO_GEOLOCATION_STEP_NONE )
+        {
+            this->wifi_channel_planner.Update( results->wifi_results );
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
@@ -38,6 +38,7 @@
 #include "demo_modem_radio_tx_continuous.h"
 #include "demo_modem_radio_tx_cw.h"
 #include "demo_modem_radio_rx_continuous.h"
+#include "demo_geolocation_sequencer.h"
 
 DemoManagerModem::DemoManagerModem( DeviceModem* device, EnvironmentInterface* environment,
                                     AntennaSelectorInterface* antenna_selector, SignalingInterface* signaling,
@@ -90,7 +91,8 @@ void DemoManagerModem::Start( demo_type_t demo_type )
         }
         case DEMO_TYPE_RADIO_PER_RX:
         {
-            this->running_demo = new DemoModemRadioRxContinuous( device, signaling, this->communication_interface );
+            this->running_demo = new DemoModemRadioRxContinuous( device, signaling, this->communication_interface,
+                                                                 environment, timer );
             break;
         }
         case DEMO_TYPE_TX_CW:
@@ -98,6 +100,16 @@ void DemoManagerModem::Start( demo_type_t demo_type )
             this->running_demo = new DemoModemRadioTxCw( device, signaling, this->communication_interface );
             break;
         }
+        case DEMO_TYPE_GEOLOCATION:
+        {
+            DemoModemWifi*           wifi_demo = new DemoModemWifi( device, signaling, this->communication_interface );
+            DemoModemGnssAutonomous* gnss_demo = new DemoModemGnssAutonomous(
+                device, signaling, environment, antenna_selector, timer, this->communication_interface );
+            this->running_demo = new DemoGeolocationSequencer( device, signaling, this->communication_interface,
+                                                               wifi_demo, wifi_demo->GetResult( ), gnss_demo,
+                                                               gnss_demo->GetResult( ) );
+            break;
+        }
         default:
             break;
         }
@@ -105,13 +117,24 @@ void DemoManagerModem::Start( demo_type_t demo_type )
         this->demo_type_current = demo_type;
     }
 
+    // Some demos, such as the spectrum sweep, are only available on the transceiver
+    if( this->running_demo == NULL )
+    {
+        this->demo_type_current = DEMO_TYPE_NONE;
+        return;
+    }
+
     this->running_demo->Reset( );
 
     switch( demo_type )
     {
     case DEMO_TYPE_WIFI:
-        ( ( DemoModemWifi* ) this->running_demo )->Configure( this->demo_wifi_settings );
+    {
+        demo_wifi_settings_t wifi_settings;
+        this->PlanWifiSettings( &wifi_settings );
+        ( ( DemoModemWifi* ) this->running_demo )->Configure( wifi_settings );
         break;
+    }
     case DEMO_TYPE_GNSS_AUTONOMOUS:
         ( ( DemoModemGnssAutonomous* ) this->running_demo )->Configure( this->demo_gnss_autonomous_settings );
         break;
@@ -143,6 +166,15 @@ void DemoManagerModem::Start( demo_type_t demo_type )
         ( ( DemoModemRadioTxCw* ) this->running_demo )->Configure( this->demo_radio_settings );
         break;
     }
+    case DEMO_TYPE_GEOLOCATION:
+    {
+        DemoGeolocationSequencer* sequencer = ( DemoGeolocationSequencer* ) this->running_demo;
+        demo_wifi_settings_t      wifi_settings;
+        this->PlanWifiSettings( &wifi_settings );
+        ( ( DemoModemWifi* ) sequencer->GetWifiDemo( ) )->Configure( wifi_settings );
+        ( ( DemoModemGnssAutonomous* ) sequencer->GetGnssDemo( ) )->Configure( this->demo_gnss_autonomous_settings );
+        break;
+    }
     default:
         break;
     }
@@ -181,6 +213,10 @@ void* DemoManagerModem::GetResults( )
         return ( void* ) ( ( DemoModemRadioTxCw* ) this->running_demo )->GetResults( );
         break;
     }
+    case DEMO_TYPE_GEOLOCATION:
+    {
+        return ( void* ) ( ( DemoGeolocationSequencer* ) this->running_demo )->GetResult( );
+    }
     default:
         return NULL;
     }
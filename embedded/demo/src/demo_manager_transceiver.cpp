@@ -37,6 +37,10 @@
 #include "demo_transceiver_radio_ping_pong.h"
 #include "demo_transceiver_radio_tx_cw.h"
 #include "demo_transceiver_radio_per.h"
+#include "demo_transceiver_radio_spectrum_sweep.h"
+#include "demo_transceiver_radio_cad_sniffer.h"
+#include "demo_transceiver_radio_rx_duty_cycle.h"
+#include "demo_geolocation_sequencer.h"
 
 DemoManagerTransceiver::DemoManagerTransceiver( DeviceTransceiver* device, EnvironmentInterface* environment,
                                                 AntennaSelectorInterface* antenna_selector,
@@ -92,6 +96,29 @@ void DemoManagerTransceiver::Start( demo_type_t demo_type )
             this->running_demo = new DemoTransceiverRadioPer( device, signaling, environment,
                                                               this->communication_interface, DEMO_RADIO_PER_MODE_RX );
             break;
+        case DEMO_TYPE_SPECTRUM_SWEEP:
+            this->running_demo = new DemoTransceiverRadioSpectrumSweep(
+                device, signaling, this->communication_interface, this->environment, this->timer );
+            break;
+        case DEMO_TYPE_CAD_SNIFFER:
+            this->running_demo = new DemoTransceiverRadioCadSniffer( device, signaling, this->communication_interface,
+                                                                     this->environment );
+            break;
+        case DEMO_TYPE_RADIO_RX_DUTY_CYCLE:
+            this->running_demo = new DemoTransceiverRadioRxDutyCycle( device, signaling, this->communication_interface,
+                                                                      this->environment );
+            break;
+        case DEMO_TYPE_GEOLOCATION:
+        {
+            DemoTransceiverWifiScan* wifi_demo =
+                new DemoTransceiverWifiScan( device, signaling, this->communication_interface, this->environment );
+            DemoTransceiverGnssAutonomous* gnss_demo = new DemoTransceiverGnssAutonomous(
+                device, signaling, environment, antenna_selector, timer, this->communication_interface );
+            this->running_demo = new DemoGeolocationSequencer( device, signaling, this->communication_interface,
+                                                               wifi_demo, wifi_demo->GetResult( ), gnss_demo,
+                                                               gnss_demo->GetResult( ) );
+            break;
+        }
         default:
             break;
         }
@@ -104,8 +131,12 @@ void DemoManagerTransceiver::Start( demo_type_t demo_type )
     switch( demo_type )
     {
     case DEMO_TYPE_WIFI:
-        ( ( DemoTransceiverWifiScan* ) this->running_demo )->Configure( this->demo_wifi_settings );
+    {
+        demo_wifi_settings_t wifi_settings;
+        this->PlanWifiSettings( &wifi_settings );
+        ( ( DemoTransceiverWifiScan* ) this->running_demo )->Configure( wifi_settings );
         break;
+    }
     case DEMO_TYPE_WIFI_COUNTRY_CODE:
         ( ( DemoTransceiverWifiCountryCode* ) this->running_demo )->Configure( this->demo_wifi_country_code_settings );
         break;
@@ -121,6 +152,27 @@ void DemoManagerTransceiver::Start( demo_type_t demo_type )
     case DEMO_TYPE_TX_CW:
         ( ( DemoTransceiverRadioInterface* ) this->running_demo )->Configure( this->demo_radio_settings );
         break;
+    case DEMO_TYPE_SPECTRUM_SWEEP:
+        ( ( DemoTransceiverRadioSpectrumSweep* ) this->running_demo )->Configure( this->demo_spectrum_sweep_settings );
+        break;
+    case DEMO_TYPE_CAD_SNIFFER:
+        ( ( DemoTransceiverRadioCadSniffer* ) this->running_demo )->Configure( this->demo_cad_sniffer_settings );
+        break;
+    case DEMO_TYPE_RADIO_RX_DUTY_CYCLE:
+        ( ( DemoTransceiverRadioRxDutyCycle* ) this->running_demo )->Configure( this->demo_radio_settings );
+        ( ( DemoTransceiverRadioRxDutyCycle* ) this->running_demo )
+            ->ConfigureDutyCycle( this->demo_rx_duty_cycle_settings );
+        break;
+    case DEMO_TYPE_GEOLOCATION:
+    {
+        DemoGeolocationSequencer* sequencer = ( DemoGeolocationSequencer* ) this->running_demo;
+        demo_wifi_settings_t      wifi_settings;
+        this->PlanWifiSettings( &wifi_settings );
+        ( ( DemoTransceiverWifiScan* ) sequencer->GetWifiDemo( ) )->Configure( wifi_settings );
+        ( ( DemoTransceiverGnssAutonomous* ) sequencer->GetGnssDemo( ) )
+            ->Configure( this->demo_gnss_autonomous_settings );
+        break;
+    }
     default:
         break;
     }
@@ -145,6 +197,14 @@ void* DemoManagerTransceiver::GetResults( )
     case DEMO_TYPE_RADIO_PER_TX:
     case DEMO_TYPE_RADIO_PER_RX:
         return ( void* ) ( ( DemoTransceiverRadioPer* ) this->running_demo )->GetResult( );
+    case DEMO_TYPE_SPECTRUM_SWEEP:
+        return ( void* ) ( ( DemoTransceiverRadioSpectrumSweep* ) this->running_demo )->GetResult( );
+    case DEMO_TYPE_CAD_SNIFFER:
+        return ( void* ) ( ( DemoTransceiverRadioCadSniffer* ) this->running_demo )->GetResult( );
+    case DEMO_TYPE_RADIO_RX_DUTY_CYCLE:
+        return ( void* ) ( ( DemoTransceiverRadioRxDutyCycle* ) this->running_demo )->GetResult( );
+    case DEMO_TYPE_GEOLOCATION:
+        return ( void* ) ( ( DemoGeolocationSequencer* ) this->running_demo )->GetResult( );
     default:
         return NULL;
     }
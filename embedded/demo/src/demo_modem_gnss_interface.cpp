@@ -46,7 +46,8 @@ DemoModemGnssInterface::DemoModemGnssInterface( DeviceModem* device, SignalingIn
       state( DEMO_MODEM_GNSS_BASE_INIT ),
       environment( environment ),
       instant_start_capture_ms( 0 ),
-      antenna_selector( antenna_selector )
+      antenna_selector( antenna_selector ),
+      nb_scan_retries( 0 )
 {
 }
 
@@ -65,6 +66,7 @@ void DemoModemGnssInterface::Reset( )
     this->result.almanac_too_old           = false;
     this->result.almanac_age_days          = 0;
     this->instant_start_capture_ms         = 0;
+    this->nb_scan_retries                  = 0;
 }
 
 void DemoModemGnssInterface::JumpToErrorState( const demo_gnss_error_t error_code )
@@ -110,7 +112,15 @@ void DemoModemGnssInterface::SpecificRuntime( )
 
         const lr1110_modem_response_code_t scan_response_code = this->CallScan( );
 
-        if( scan_response_code != LR1110_MODEM_RESPONSE_CODE_OK )
+        if( ( scan_response_code == LR1110_MODEM_RESPONSE_CODE_BUSY ) &&
+            ( this->nb_scan_retries < DEMO_GNSS_MODEM_BUSY_MAX_RETRIES ) )
+        {
+            // The modem is still busy with a previous operation (typically an uplink): retry the scan later
+            this->nb_scan_retries++;
+            this->timer->set_and_start( DEMO_GNSS_MODEM_BUSY_RETRY_PERIOD_MS );
+            this->state = DEMO_MODEM_GNSS_BASE_WAIT_FOR_MODEM_READY;
+        }
+        else if( scan_response_code != LR1110_MODEM_RESPONSE_CODE_OK )
         {
             this->communication_interface->Log( "Error code when calling scan: 0x%x\r\n", scan_response_code );
             this->JumpToErrorState( DemoModemGnssInterface::ErrorCodeFromScanResponseCode( scan_response_code ) );
@@ -126,6 +136,19 @@ void DemoModemGnssInterface::SpecificRuntime( )
         break;
     }
 
+    case DEMO_MODEM_GNSS_BASE_WAIT_FOR_MODEM_READY:
+    {
+        if( this->timer->is_timer_elapsed( ) )
+        {
+            this->state = DEMO_MODEM_GNSS_BASE_SCAN;
+        }
+        else
+        {
+            this->SetWaitingForInterrupt( );
+        }
+        break;
+    }
+
     case DEMO_MODEM_GNSS_BASE_WAIT_FOR_SCAN:
     {
         if( this->InterruptHasRaised( ) )
@@ -165,7 +188,13 @@ void DemoModemGnssInterface::SpecificRuntime( )
     }
 }
 
-void DemoModemGnssInterface::SpecificStop( ) { signaling->StopCapture( ); }
+void DemoModemGnssInterface::SpecificStop( )
+{
+    this->timer->clear_timer( );
+    signaling->StopCapture( );
+}
+
+bool DemoModemGnssInterface::IsCaptureRunning( ) const { return this->state == DEMO_MODEM_GNSS_BASE_WAIT_FOR_SCAN; }
 
 bool DemoModemGnssInterface::CanFetchResults( demo_gnss_nav_result_t& nav_message )
 {
@@ -33,9 +33,14 @@
 #include "demo_modem_radio_converters.h"
 
 DemoModemRadioRxContinuous::DemoModemRadioRxContinuous( DeviceModem* device, SignalingInterface* signaling,
-                                                        CommunicationInterface* communication_interface )
+                                                        CommunicationInterface* communication_interface,
+                                                        EnvironmentInterface* environment, TimerInterface* timer )
     : DemoModemInterface( device, signaling, communication_interface ),
-      state( DEMO_MODEM_RADIO_RX_CONTINUOUS_STATE_INIT )
+      state( DEMO_MODEM_RADIO_RX_CONTINUOUS_STATE_INIT ),
+      environment( environment ),
+      timer( timer ),
+      instant_start_ms( 0 ),
+      instant_last_sample_ms( 0 )
 {
     this->results = {};
 }
@@ -60,30 +65,58 @@ void DemoModemRadioRxContinuous::SpecificRuntime( )
         lr1110_modem_test_mode_start( this->device->GetRadio( ) );
         lr1110_modem_test_rx_cont( this->device->GetRadio( ), this->settings.frequency, this->settings.sf,
                                    this->settings.bw, this->settings.cr );
+
+        this->instant_start_ms       = this->environment->GetLocalTimeMilliseconds( );
+        this->instant_last_sample_ms = this->instant_start_ms;
+        this->timer->set_and_start( this->settings.sampling_period_ms );
+        this->SetWaitingForInterrupt( );
         this->state = DEMO_MODEM_RADIO_RX_CONTINUOUS_STATE_RUNNING;
         break;
     }
     case DEMO_MODEM_RADIO_RX_CONTINUOUS_STATE_RUNNING:
     {
-        uint32_t local_rx_counter = 0;
-        lr1110_modem_test_read_packet_counter_rx_cont( this->device->GetRadio( ), &local_rx_counter );
-        if( this->results.count_rx_correct_packet != local_rx_counter )
+        // The packet counter is only read once per sampling period to leave the SPI bus and the MCU idle
+        if( this->timer->is_timer_elapsed( ) == true )
         {
-            this->results.count_rx_correct_packet = local_rx_counter;
-            this->has_intermediate_results        = true;
+            this->SampleRxCounter( );
+            this->timer->set_and_start( this->settings.sampling_period_ms );
         }
+        this->SetWaitingForInterrupt( );
         break;
     }
     }
 }
 
-void DemoModemRadioRxContinuous::SpecificStop( )
+void DemoModemRadioRxContinuous::SampleRxCounter( )
 {
-    uint32_t local_rx_counter = 0;
+    const uint32_t now_ms           = this->environment->GetLocalTimeMilliseconds( );
+    const uint32_t elapsed_ms       = now_ms - this->instant_last_sample_ms;
+    const uint32_t total_elapsed_ms = now_ms - this->instant_start_ms;
+    uint32_t       local_rx_counter = 0;
+
     lr1110_modem_test_read_packet_counter_rx_cont( this->device->GetRadio( ), &local_rx_counter );
+
+    if( elapsed_ms > 0 )
+    {
+        this->results.rx_rate_instant_pps =
+            ( ( float ) ( local_rx_counter - this->results.count_rx_correct_packet ) * 1000.0f ) / elapsed_ms;
+    }
+    if( total_elapsed_ms > 0 )
+    {
+        this->results.rx_rate_average_pps = ( ( float ) local_rx_counter * 1000.0f ) / total_elapsed_ms;
+    }
+
+    this->instant_last_sample_ms          = now_ms;
+    this->results.count_rx_correct_packet = local_rx_counter;
+    this->has_intermediate_results        = true;
+}
+
+void DemoModemRadioRxContinuous::SpecificStop( )
+{
     lr1110_modem_test_exit( this->device->GetRadio( ) );
-    this->state                           = DEMO_MODEM_RADIO_RX_CONTINUOUS_STATE_INIT;
-    this->results.count_rx_correct_packet = 0;
+    this->timer->clear_timer( );
+    this->state   = DEMO_MODEM_RADIO_RX_CONTINUOUS_STATE_INIT;
+    this->results = {};
 }
 
 void DemoModemRadioRxContinuous::Configure( demo_radio_settings_t& settings )
@@ -109,7 +142,15 @@ bool DemoModemRadioRxContinuous::convert_radio_settings(
 {
     bool success = true;
 
-    demo_radio_rx_continuous_settings->frequency = radio_settings->rf_frequency;
+    demo_radio_rx_continuous_settings->frequency          = radio_settings->rf_frequency;
+    demo_radio_rx_continuous_settings->sampling_period_ms = radio_settings->rx_sampling_period_ms;
+
+    if( ( radio_settings->rx_sampling_period_ms < DEMO_RADIO_RX_SAMPLING_PERIOD_MS_MIN ) ||
+        ( radio_settings->rx_sampling_period_ms > DEMO_RADIO_RX_SAMPLING_PERIOD_MS_MAX ) )
+    {
+        demo_radio_rx_continuous_settings->sampling_period_ms = DEMO_RADIO_RX_SAMPLING_PERIOD_MS_DEFAULT;
+        success                                               = false;
+    }
 
     switch( radio_settings->pkt_type )
     {
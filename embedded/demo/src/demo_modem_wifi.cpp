@@ -53,6 +53,9 @@ void DemoModemWifi::Reset( )
     this->state                          = DEMO_MODEM_WIFI_INIT;
     this->results.nbrResults             = 0;
     this->results.global_consumption_uas = 0;
+    this->results.has_country_codes      = false;
+    this->results.country_code_error     = false;
+    this->results.extended_results       = NULL;
 }
 
 void DemoModemWifi::SpecificRuntime( )
@@ -138,7 +141,17 @@ uint32_t DemoModemWifi::ComputeConsumption( const lr1110_modem_system_reg_mode_t
     return consumption_uas;
 }
 
-void DemoModemWifi::Configure( demo_wifi_settings_t& config ) { this->settings = config; }
+void DemoModemWifi::Configure( demo_wifi_settings_t& config )
+{
+    this->settings = config;
+
+    // Parsing extended results from the modem event requires all of them at once, so their memory cost cannot be
+    // bounded: the modem falls back to basic results
+    if( this->settings.result_type == DEMO_WIFI_RESULT_TYPE_EXTENDED_FULL )
+    {
+        this->settings.result_type = DEMO_WIFI_RESULT_TYPE_BASIC_COMPLETE;
+    }
+}
 
 void DemoModemWifi::ExecuteScan( radio_t* radio )
 {
@@ -171,6 +184,8 @@ void DemoModemWifi::FetchAndSaveResults( const uint8_t* buffer, uint16_t buffer_
         this->ParseAndSaveBasicMacChannelTypeResults( buffer, buffer_length );
         break;
     }
+    default:
+        break;
     }
 }
 
@@ -260,6 +275,8 @@ lr1110_modem_wifi_result_format_t DemoModemWifi::ResultFormatFromSetting( demo_w
         result_type = LR1110_MODEM_WIFI_RESULT_FORMAT_BASIC_MAC_TYPE_CHANNEL;
         break;
     }
+    default:
+        break;
     }
     return result_type;
 }
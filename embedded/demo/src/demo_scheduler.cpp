@@ -0,0 +1,128 @@
+/**
+ * @file      demo_scheduler.cpp
+ *
+ * @brief     Implementation of the periodic scan scheduler.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "demo_scheduler.h"
+
+DemoScheduler::DemoScheduler( EnvironmentInterface* environment, TimerInterface* timer )
+    : environment( environment ),
+      timer( timer ),
+      is_running( false ),
+      is_scan_ongoing( false ),
+      nb_scans_done( 0 ),
+      current_interval_s( 0 ),
+      next_scan_instant_ms( 0 )
+{
+    this->settings.demo_type      = DEMO_TYPE_NONE;
+    this->settings.sinks          = DEMO_SCHEDULER_SINK_ALL;
+    this->settings.nb_scans       = 0;
+    this->settings.interval_s     = 0;
+    this->settings.max_interval_s = 0;
+}
+
+DemoScheduler::~DemoScheduler( ) {}
+
+void DemoScheduler::Configure( const demo_scheduler_settings_t& settings ) { this->settings = settings; }
+
+void DemoScheduler::Start( )
+{
+    this->is_running           = true;
+    this->is_scan_ongoing      = false;
+    this->nb_scans_done        = 0;
+    this->current_interval_s   = this->settings.interval_s;
+    this->next_scan_instant_ms = this->environment->GetLocalTimeMilliseconds( );
+}
+
+void DemoScheduler::Stop( )
+{
+    this->is_running      = false;
+    this->is_scan_ongoing = false;
+}
+
+bool DemoScheduler::IsRunning( ) const { return this->is_running; }
+
+bool DemoScheduler::IsScanDue( ) const
+{
+    const uint32_t now_ms = this->environment->GetLocalTimeMilliseconds( );
+
+    return ( this->is_running == true ) && ( this->is_scan_ongoing == false ) &&
+           ( ( int32_t )( now_ms - this->next_scan_instant_ms ) >= 0 );
+}
+
+bool DemoScheduler::IsScanOngoing( ) const { return this->is_scan_ongoing; }
+
+demo_type_t DemoScheduler::GetDemoType( ) const { return this->settings.demo_type; }
+
+uint8_t DemoScheduler::GetSinks( ) const { return this->settings.sinks; }
+
+void DemoScheduler::ScanStarted( ) { this->is_scan_ongoing = true; }
+
+void DemoScheduler::ScanTerminated( const bool has_results )
+{
+    this->is_scan_ongoing = false;
+    this->nb_scans_done++;
+
+    if( ( this->settings.nb_scans != 0 ) && ( this->nb_scans_done >= this->settings.nb_scans ) )
+    {
+        this->is_running = false;
+        return;
+    }
+
+    if( this->settings.max_interval_s > this->settings.interval_s )
+    {
+        if( has_results == true )
+        {
+            this->current_interval_s = this->settings.interval_s;
+        }
+        else
+        {
+            this->current_interval_s = ( this->current_interval_s > ( this->settings.max_interval_s / 2 ) )
+                                           ? this->settings.max_interval_s
+                                           : ( this->current_interval_s * 2 );
+        }
+    }
+
+    this->next_scan_instant_ms = this->environment->GetLocalTimeMilliseconds( ) + this->current_interval_s * 1000;
+    this->ArmWakeUp( );
+}
+
+void DemoScheduler::ArmWakeUp( )
+{
+    if( ( this->is_running == false ) || ( this->is_scan_ongoing == true ) )
+    {
+        return;
+    }
+
+    // The timer is shared with the demos, so it is armed again each time a demo releases it
+    const uint32_t now_ms   = this->environment->GetLocalTimeMilliseconds( );
+    const int32_t  delay_ms = ( int32_t )( this->next_scan_instant_ms - now_ms );
+
+    this->timer->set_and_start( ( delay_ms > 0 ) ? ( uint32_t ) delay_ms : 0 );
+}
@@ -235,6 +235,8 @@ void DemoTransceiverGnssInterface::SpecificRuntime( )
 
 void DemoTransceiverGnssInterface::SpecificStop( ) { signaling->StopCapture( ); }
 
+bool DemoTransceiverGnssInterface::IsCaptureRunning( ) const { return this->state == DEMO_GNSS_BASE_WAIT_FOR_SCAN; }
+
 bool DemoTransceiverGnssInterface::CanFetchResults( demo_gnss_nav_result_t& nav_message )
 {
     if( DemoTransceiverGnssInterface::IsResultToSolver( nav_message ) )
@@ -451,7 +453,7 @@ uint16_t DemoTransceiverGnssInterface::GetAlmanacAgeDaysSinceToday( ) const
 {
     // First, we get the age of the almanac of the satellite id 0
     uint16_t almanac_age = 0;
-    lr1110_gnss_get_almanac_age_for_satellite( this->device->GetRadio( ), 0, &almanac_age );
+    this->device->GetAlmanacAgesForSatelliteId( 0, &almanac_age );
 
     // Then we convert the age from almanac into number of days elapsed since
     // GPS epoch
@@ -0,0 +1,298 @@
+/**
+ * @file      demo_transceiver_radio_cad_sniffer.cpp
+ *
+ * @brief     Implementation of the multi-channel CAD sniffer demo.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "demo_transceiver_radio_cad_sniffer.h"
+#include "lr1110_radio.h"
+
+#define DEMO_CAD_SNIFFER_SF_MIN ( LR1110_RADIO_LORA_SF5 )
+#define DEMO_CAD_SNIFFER_SF_MAX ( LR1110_RADIO_LORA_SF12 )
+#define DEMO_CAD_SNIFFER_LDRO_SYMBOL_TIME_US ( 16380 )
+#define DEMO_CAD_SNIFFER_IRQ_MASK ( LR1110_SYSTEM_IRQ_CAD_DONE | LR1110_SYSTEM_IRQ_CAD_DETECTED )
+
+DemoTransceiverRadioCadSniffer::DemoTransceiverRadioCadSniffer( DeviceTransceiver*      device,
+                                                                SignalingInterface*     signaling,
+                                                                CommunicationInterface* communication_interface,
+                                                                EnvironmentInterface*   environment )
+    : DemoTransceiverInterface( device, signaling, communication_interface, environment ),
+      state( DEMO_CAD_SNIFFER_STATE_INIT ),
+      start_instant_ms( 0 ),
+      current_channel( 0 ),
+      current_sf( 0 ),
+      has_intermediate_results( false )
+{
+    this->settings = {};
+    this->ResetResults( );
+}
+
+DemoTransceiverRadioCadSniffer::~DemoTransceiverRadioCadSniffer( ) {}
+
+void DemoTransceiverRadioCadSniffer::Configure( demo_cad_sniffer_settings_t& settings )
+{
+    this->settings = settings;
+
+    if( this->settings.nb_channels > DEMO_CAD_SNIFFER_MAX_CHANNELS )
+    {
+        this->settings.nb_channels = DEMO_CAD_SNIFFER_MAX_CHANNELS;
+    }
+}
+
+void DemoTransceiverRadioCadSniffer::SpecificRuntime( )
+{
+    this->has_intermediate_results = false;
+
+    switch( this->state )
+    {
+    case DEMO_CAD_SNIFFER_STATE_INIT:
+    {
+        this->current_channel = 0;
+        this->current_sf      = 0;
+
+        if( ( this->settings.nb_channels == 0 ) || ( this->SelectNextSpreadingFactor( ) == false ) )
+        {
+            this->Terminate( );
+            break;
+        }
+
+        this->ResetResults( );
+        this->device->Init( );
+        lr1110_radio_set_pkt_type( this->device->GetRadio( ), LR1110_RADIO_PKT_TYPE_LORA );
+        lr1110_system_set_dio_irq_params( this->device->GetRadio( ), DEMO_CAD_SNIFFER_IRQ_MASK, 0 );
+        lr1110_system_clear_irq_status( this->device->GetRadio( ), LR1110_SYSTEM_IRQ_ALL_MASK );
+
+        this->start_instant_ms = this->environment->GetLocalTimeMilliseconds( );
+        this->state            = DEMO_CAD_SNIFFER_STATE_START_CAD;
+        break;
+    }
+    case DEMO_CAD_SNIFFER_STATE_START_CAD:
+    {
+        this->StartCad( );
+        this->SetWaitingForInterrupt( );
+        this->state = DEMO_CAD_SNIFFER_STATE_WAIT_CAD_DONE;
+        break;
+    }
+    case DEMO_CAD_SNIFFER_STATE_WAIT_CAD_DONE:
+    {
+        if( ( this->InterruptHasRaised( ) == false ) ||
+            ( ( this->last_received_irq_mask & LR1110_SYSTEM_IRQ_CAD_DONE ) == 0 ) )
+        {
+            this->SetWaitingForInterrupt( );
+            break;
+        }
+
+        this->HandleCadDone( );
+        this->state = DEMO_CAD_SNIFFER_STATE_START_CAD;
+
+        if( this->SelectNextSpreadingFactor( ) == false )
+        {
+            this->current_sf = 0;
+            this->SelectNextSpreadingFactor( );
+            this->current_channel++;
+
+            if( this->current_channel == this->settings.nb_channels )
+            {
+                this->current_channel = 0;
+                this->PublishCycle( );
+
+                if( ( this->settings.nb_cycles != 0 ) && ( this->results.nb_cycles >= this->settings.nb_cycles ) )
+                {
+                    lr1110_system_set_standby( this->device->GetRadio( ), LR1110_SYSTEM_STANDBY_CFG_RC );
+                    this->state = DEMO_CAD_SNIFFER_STATE_INIT;
+                    this->Terminate( );
+                }
+            }
+        }
+        break;
+    }
+    }
+}
+
+void DemoTransceiverRadioCadSniffer::SpecificStop( )
+{
+    // Results are kept so that they can still be fetched once the sniffer is stopped
+    lr1110_system_set_standby( this->device->GetRadio( ), LR1110_SYSTEM_STANDBY_CFG_RC );
+    this->state = DEMO_CAD_SNIFFER_STATE_INIT;
+}
+
+void DemoTransceiverRadioCadSniffer::ResetResults( )
+{
+    this->results.nb_channels             = this->settings.nb_channels;
+    this->results.sf_mask                 = this->settings.sf_mask;
+    this->results.nb_cycles               = 0;
+    this->results.elapsed_ms              = 0;
+    this->results.cad_duty_cycle_permille = 0;
+
+    for( uint8_t channel = 0; channel < DEMO_CAD_SNIFFER_MAX_CHANNELS; channel++ )
+    {
+        this->results.channels[channel]              = {};
+        this->results.channels[channel].frequency_hz = this->settings.frequencies_hz[channel];
+        this->cad_time_remainder_us[channel]         = 0;
+    }
+}
+
+void DemoTransceiverRadioCadSniffer::StartCad( ) const
+{
+    const lr1110_radio_lora_sf_t sf = ( lr1110_radio_lora_sf_t ) this->current_sf;
+
+    const uint32_t symbol_time_us = DemoTransceiverRadioCadSniffer::GetCadDurationUs( sf, this->settings.bandwidth, 1 );
+
+    const lr1110_radio_mod_params_lora_t modulation = {
+        .sf   = sf,
+        .bw   = this->settings.bandwidth,
+        .cr   = DEMO_RADIO_LORA_CR_DEFAULT,
+        .ldro = ( uint8_t )( ( symbol_time_us >= DEMO_CAD_SNIFFER_LDRO_SYMBOL_TIME_US ) ? 1 : 0 ),
+    };
+
+    const lr1110_radio_cad_params_t cad_params = {
+        .cad_symb_nb     = this->settings.cad_symb_nb,
+        .cad_detect_peak = this->settings.cad_detect_peak,
+        .cad_detect_min  = this->settings.cad_detect_min,
+        .cad_exit_mode   = LR1110_RADIO_CAD_EXIT_MODE_STANDBYRC,
+        .cad_timeout     = 0,
+    };
+
+    lr1110_radio_set_rf_freq( this->device->GetRadio( ), this->settings.frequencies_hz[this->current_channel] );
+    lr1110_radio_set_lora_mod_params( this->device->GetRadio( ), &modulation );
+    lr1110_radio_set_cad_params( this->device->GetRadio( ), &cad_params );
+    lr1110_radio_set_cad( this->device->GetRadio( ) );
+}
+
+void DemoTransceiverRadioCadSniffer::HandleCadDone( )
+{
+    demo_cad_sniffer_channel_result_t& channel_result = this->results.channels[this->current_channel];
+    uint32_t&                          remainder_us   = this->cad_time_remainder_us[this->current_channel];
+
+    channel_result.nb_cad++;
+
+    if( ( this->last_received_irq_mask & LR1110_SYSTEM_IRQ_CAD_DETECTED ) != 0 )
+    {
+        uint16_t& detections = channel_result.detections_per_sf[this->current_sf - DEMO_CAD_SNIFFER_SF_MIN];
+
+        channel_result.nb_detections++;
+        if( detections < UINT16_MAX )
+        {
+            detections++;
+        }
+        this->signaling->Rx( );
+    }
+
+    // The time spent in CAD is derived from the symbol time as the millisecond tick is too coarse for short CADs
+    remainder_us += DemoTransceiverRadioCadSniffer::GetCadDurationUs(
+        ( lr1110_radio_lora_sf_t ) this->current_sf, this->settings.bandwidth, this->settings.cad_symb_nb );
+    channel_result.cad_time_ms += remainder_us / 1000;
+    remainder_us %= 1000;
+}
+
+bool DemoTransceiverRadioCadSniffer::SelectNextSpreadingFactor( )
+{
+    uint8_t sf = ( this->current_sf < DEMO_CAD_SNIFFER_SF_MIN ) ? DEMO_CAD_SNIFFER_SF_MIN : this->current_sf + 1;
+
+    for( ; sf <= DEMO_CAD_SNIFFER_SF_MAX; sf++ )
+    {
+        if( ( this->settings.sf_mask & ( 1 << sf ) ) != 0 )
+        {
+            this->current_sf = sf;
+            return true;
+        }
+    }
+    return false;
+}
+
+void DemoTransceiverRadioCadSniffer::PublishCycle( )
+{
+    uint32_t total_cad_time_ms = 0;
+
+    this->results.nb_cycles++;
+    this->results.elapsed_ms = this->environment->GetLocalTimeMilliseconds( ) - this->start_instant_ms;
+
+    for( uint8_t channel = 0; channel < this->settings.nb_channels; channel++ )
+    {
+        demo_cad_sniffer_channel_result_t& channel_result = this->results.channels[channel];
+
+        channel_result.activity_permille =
+            ( uint16_t )( ( ( uint64_t ) channel_result.nb_detections * 1000 ) / channel_result.nb_cad );
+        total_cad_time_ms += channel_result.cad_time_ms;
+    }
+
+    if( this->results.elapsed_ms != 0 )
+    {
+        this->results.cad_duty_cycle_permille =
+            ( uint16_t )( ( ( uint64_t ) total_cad_time_ms * 1000 ) / this->results.elapsed_ms );
+    }
+
+    this->has_intermediate_results = true;
+}
+
+uint32_t DemoTransceiverRadioCadSniffer::GetCadDurationUs( const lr1110_radio_lora_sf_t sf,
+                                                           const lr1110_radio_lora_bw_t bw, const uint8_t nb_symbols )
+{
+    uint32_t bandwidth_hz = 0;
+
+    switch( bw )
+    {
+    case LR1110_RADIO_LORA_BW_10:
+        bandwidth_hz = 10417;
+        break;
+    case LR1110_RADIO_LORA_BW_15:
+        bandwidth_hz = 15625;
+        break;
+    case LR1110_RADIO_LORA_BW_20:
+        bandwidth_hz = 20833;
+        break;
+    case LR1110_RADIO_LORA_BW_31:
+        bandwidth_hz = 31250;
+        break;
+    case LR1110_RADIO_LORA_BW_41:
+        bandwidth_hz = 41667;
+        break;
+    case LR1110_RADIO_LORA_BW_62:
+        bandwidth_hz = 62500;
+        break;
+    case LR1110_RADIO_LORA_BW_125:
+        bandwidth_hz = 125000;
+        break;
+    case LR1110_RADIO_LORA_BW_250:
+        bandwidth_hz = 250000;
+        break;
+    case LR1110_RADIO_LORA_BW_500:
+        bandwidth_hz = 500000;
+        break;
+    default:
+        return 0;
+    }
+
+    return ( uint32_t )( ( ( uint64_t ) nb_symbols * ( 1 << sf ) * 1000000 ) / bandwidth_hz );
+}
+
+void DemoTransceiverRadioCadSniffer::ClearRegisteredIrqs( ) const {}
+
+bool DemoTransceiverRadioCadSniffer::HasIntermediateResults( ) const { return this->has_intermediate_results; }
+
+const demo_cad_sniffer_results_t* DemoTransceiverRadioCadSniffer::GetResult( ) const { return &this->results; }
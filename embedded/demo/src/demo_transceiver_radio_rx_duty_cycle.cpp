@@ -0,0 +1,232 @@
+/**
+ * @file      demo_transceiver_radio_rx_duty_cycle.cpp
+ *
+ * @brief     Implementation of the duty-cycled RX demo for the transceiver.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "demo_transceiver_radio_rx_duty_cycle.h"
+#include "lr1110_radio.h"
+
+#define DEMO_RX_DUTY_CYCLE_IRQ_MASK                                                                      \
+    ( LR1110_SYSTEM_IRQ_PREAMBLE_DETECTED | LR1110_SYSTEM_IRQ_RX_DONE | LR1110_SYSTEM_IRQ_HEADER_ERROR | \
+      LR1110_SYSTEM_IRQ_CRC_ERROR | LR1110_SYSTEM_IRQ_TIMEOUT )
+
+DemoTransceiverRadioRxDutyCycle::DemoTransceiverRadioRxDutyCycle( DeviceTransceiver*      device,
+                                                                  SignalingInterface*     signaling,
+                                                                  CommunicationInterface* communication_interface,
+                                                                  EnvironmentInterface*   environment )
+    : DemoTransceiverRadioInterface( device, signaling, communication_interface, environment ),
+      state( DEMO_RX_DUTY_CYCLE_STATE_INIT ),
+      last_accounting_instant_ms( 0 ),
+      is_receiving_packet( false ),
+      has_intermediate_results( false )
+{
+    this->duty_cycle_settings = {};
+    this->results             = {};
+}
+
+DemoTransceiverRadioRxDutyCycle::~DemoTransceiverRadioRxDutyCycle( ) {}
+
+void DemoTransceiverRadioRxDutyCycle::ConfigureDutyCycle( demo_rx_duty_cycle_settings_t& settings )
+{
+    this->duty_cycle_settings = settings;
+}
+
+void DemoTransceiverRadioRxDutyCycle::SpecificRuntime( )
+{
+    this->has_intermediate_results = false;
+
+    switch( this->state )
+    {
+    case DEMO_RX_DUTY_CYCLE_STATE_INIT:
+    {
+        if( ( this->duty_cycle_settings.rx_period_ms == 0 ) || ( this->duty_cycle_settings.sleep_period_ms == 0 ) )
+        {
+            this->Terminate( );
+            break;
+        }
+
+        this->results             = {};
+        this->is_receiving_packet = false;
+        this->ConfigureRadio( );
+        this->state = DEMO_RX_DUTY_CYCLE_STATE_START;
+        break;
+    }
+    case DEMO_RX_DUTY_CYCLE_STATE_START:
+    {
+        // The radio alternates autonomously between RX and sleep until a packet ends the listening session
+        lr1110_radio_set_rx_duty_cycle( this->device->GetRadio( ), this->duty_cycle_settings.rx_period_ms,
+                                        this->duty_cycle_settings.sleep_period_ms, LR1110_RADIO_RX_DUTY_CYCLE_MODE_RX );
+        this->last_accounting_instant_ms = this->environment->GetLocalTimeMilliseconds( );
+        this->SetWaitingForInterrupt( );
+        this->state = DEMO_RX_DUTY_CYCLE_STATE_WAIT_FOR_EVENT;
+        break;
+    }
+    case DEMO_RX_DUTY_CYCLE_STATE_WAIT_FOR_EVENT:
+    {
+        if( this->InterruptHasRaised( ) == false )
+        {
+            this->SetWaitingForInterrupt( );
+            break;
+        }
+
+        this->AccountTimeUntil( this->last_irq_received_instant_ms );
+
+        if( this->HandleEvent( ) == true )
+        {
+            this->state = DEMO_RX_DUTY_CYCLE_STATE_START;
+        }
+        else
+        {
+            this->SetWaitingForInterrupt( );
+        }
+        this->has_intermediate_results = true;
+        break;
+    }
+    }
+}
+
+void DemoTransceiverRadioRxDutyCycle::SpecificStop( )
+{
+    if( this->state == DEMO_RX_DUTY_CYCLE_STATE_WAIT_FOR_EVENT )
+    {
+        this->AccountTimeUntil( this->environment->GetLocalTimeMilliseconds( ) );
+    }
+
+    // Results are kept so that they can still be fetched once the demo is stopped
+    lr1110_system_set_standby( this->device->GetRadio( ), LR1110_SYSTEM_STANDBY_CFG_RC );
+    this->state = DEMO_RX_DUTY_CYCLE_STATE_INIT;
+}
+
+void DemoTransceiverRadioRxDutyCycle::ConfigureRadio( ) const
+{
+    this->device->Init( );
+    lr1110_radio_set_pkt_type( this->device->GetRadio( ), this->settings.pkt_type );
+
+    switch( this->settings.pkt_type )
+    {
+    case LR1110_RADIO_PKT_TYPE_LORA:
+    {
+        lr1110_radio_set_lora_mod_params( this->device->GetRadio( ), &this->settings.modulation_lora );
+        lr1110_radio_set_lora_pkt_params( this->device->GetRadio( ), &this->settings.packet_lora );
+        break;
+    }
+    case LR1110_RADIO_PKT_TYPE_GFSK:
+    {
+        lr1110_radio_set_gfsk_mod_params( this->device->GetRadio( ), &this->settings.modulation_gfsk );
+        lr1110_radio_set_gfsk_pkt_params( this->device->GetRadio( ), &this->settings.packet_gfsk );
+        break;
+    }
+    default:
+    {
+        break;
+    }
+    }
+
+    lr1110_radio_set_rf_freq( this->device->GetRadio( ), this->settings.rf_frequency );
+
+    lr1110_system_set_dio_irq_params( this->device->GetRadio( ), DEMO_RX_DUTY_CYCLE_IRQ_MASK, 0 );
+    lr1110_system_clear_irq_status( this->device->GetRadio( ), LR1110_SYSTEM_IRQ_ALL_MASK );
+}
+
+bool DemoTransceiverRadioRxDutyCycle::HandleEvent( )
+{
+    const uint32_t irq_mask          = this->last_received_irq_mask;
+    bool           is_session_closed = true;
+
+    if( ( irq_mask & LR1110_SYSTEM_IRQ_PREAMBLE_DETECTED ) != 0 )
+    {
+        this->results.count_preamble_detected++;
+        this->is_receiving_packet = true;
+    }
+
+    if( ( irq_mask & ( LR1110_SYSTEM_IRQ_CRC_ERROR | LR1110_SYSTEM_IRQ_HEADER_ERROR ) ) != 0 )
+    {
+        this->results.count_rx_wrong_packet++;
+    }
+    else if( ( irq_mask & LR1110_SYSTEM_IRQ_RX_DONE ) != 0 )
+    {
+        this->signaling->Rx( );
+        this->results.count_rx_correct_packet++;
+    }
+    else if( ( irq_mask & LR1110_SYSTEM_IRQ_TIMEOUT ) != 0 )
+    {
+        // A preamble that is not followed by a packet has been caught too late to be demodulated
+        if( this->is_receiving_packet == true )
+        {
+            this->results.count_missed_preamble++;
+        }
+    }
+    else
+    {
+        is_session_closed = false;
+    }
+
+    if( is_session_closed == true )
+    {
+        this->is_receiving_packet = false;
+    }
+    return is_session_closed;
+}
+
+void DemoTransceiverRadioRxDutyCycle::AccountTimeUntil( const uint32_t instant_ms )
+{
+    const uint32_t elapsed_ms = instant_ms - this->last_accounting_instant_ms;
+
+    this->last_accounting_instant_ms = instant_ms;
+
+    if( this->is_receiving_packet == true )
+    {
+        // Once a preamble is detected the radio stays in RX until the end of the packet
+        this->results.rx_time_ms += elapsed_ms;
+    }
+    else
+    {
+        const uint32_t period_ms  = this->duty_cycle_settings.rx_period_ms + this->duty_cycle_settings.sleep_period_ms;
+        const uint32_t rx_part_ms = ( uint32_t )( ( ( uint64_t ) elapsed_ms * this->duty_cycle_settings.rx_period_ms ) /
+                                                  period_ms );
+
+        this->results.rx_time_ms += rx_part_ms;
+        this->results.sleep_time_ms += elapsed_ms - rx_part_ms;
+    }
+
+    const uint64_t total_time_ms = ( uint64_t ) this->results.rx_time_ms + this->results.sleep_time_ms;
+    if( total_time_ms != 0 )
+    {
+        const uint64_t charge = ( ( uint64_t ) this->results.rx_time_ms * DEMO_RX_DUTY_CYCLE_RX_CURRENT_NA ) +
+                                ( ( uint64_t ) this->results.sleep_time_ms * DEMO_RX_DUTY_CYCLE_SLEEP_CURRENT_NA );
+
+        this->results.average_current_na = ( uint32_t )( charge / total_time_ms );
+    }
+}
+
+void DemoTransceiverRadioRxDutyCycle::ClearRegisteredIrqs( ) const {}
+
+bool DemoTransceiverRadioRxDutyCycle::HasIntermediateResults( ) const { return this->has_intermediate_results; }
+
+const demo_rx_duty_cycle_results_t* DemoTransceiverRadioRxDutyCycle::GetResult( ) const { return &this->results; }
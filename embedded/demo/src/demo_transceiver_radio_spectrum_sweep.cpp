@@ -0,0 +1,239 @@
+/**
+ * @file      demo_transceiver_radio_spectrum_sweep.cpp
+ *
+ * @brief     Implementation of the RSSI spectrum sweep demo for the transceiver.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "demo_transceiver_radio_spectrum_sweep.h"
+#include "lr1110_radio.h"
+
+#define DEMO_SPECTRUM_SWEEP_RX_CONTINUOUS ( 0xFFFFFF )
+
+DemoTransceiverRadioSpectrumSweep::DemoTransceiverRadioSpectrumSweep( DeviceTransceiver*      device,
+                                                                      SignalingInterface*     signaling,
+                                                                      CommunicationInterface* communication_interface,
+                                                                      EnvironmentInterface*   environment,
+                                                                      TimerInterface*         timer )
+    : DemoTransceiverInterface( device, signaling, communication_interface, environment ),
+      timer( timer ),
+      state( DEMO_SPECTRUM_SWEEP_STATE_INIT ),
+      nb_sweeps_in_window( 0 ),
+      current_channel( 0 ),
+      current_sample( 0 ),
+      has_intermediate_results( false )
+{
+    this->settings = {};
+    this->ResetResults( );
+}
+
+DemoTransceiverRadioSpectrumSweep::~DemoTransceiverRadioSpectrumSweep( ) {}
+
+void DemoTransceiverRadioSpectrumSweep::Configure( demo_spectrum_sweep_settings_t& settings )
+{
+    this->settings = settings;
+
+    if( this->settings.nb_channels > DEMO_SPECTRUM_SWEEP_MAX_CHANNELS )
+    {
+        this->settings.nb_channels = DEMO_SPECTRUM_SWEEP_MAX_CHANNELS;
+    }
+    if( this->settings.nb_samples_per_channel > DEMO_SPECTRUM_SWEEP_MAX_SAMPLES_PER_CHANNEL )
+    {
+        this->settings.nb_samples_per_channel = DEMO_SPECTRUM_SWEEP_MAX_SAMPLES_PER_CHANNEL;
+    }
+}
+
+void DemoTransceiverRadioSpectrumSweep::SpecificRuntime( )
+{
+    this->has_intermediate_results = false;
+
+    switch( this->state )
+    {
+    case DEMO_SPECTRUM_SWEEP_STATE_INIT:
+    {
+        if( ( this->settings.nb_channels == 0 ) || ( this->settings.nb_samples_per_channel == 0 ) )
+        {
+            this->Terminate( );
+            break;
+        }
+
+        this->ResetResults( );
+        this->ConfigureRadio( );
+        this->current_channel = 0;
+        this->state           = DEMO_SPECTRUM_SWEEP_STATE_TUNE;
+        break;
+    }
+    case DEMO_SPECTRUM_SWEEP_STATE_TUNE:
+    {
+        // The first RSSI sample is only taken once the receiver has settled on the new channel
+        this->TuneChannel( this->current_channel );
+        this->current_sample = 0;
+        this->timer->set_and_start( DEMO_SPECTRUM_SWEEP_SETTLE_TIME_MS );
+        this->SetWaitingForInterrupt( );
+        this->state = DEMO_SPECTRUM_SWEEP_STATE_SAMPLE;
+        break;
+    }
+    case DEMO_SPECTRUM_SWEEP_STATE_SAMPLE:
+    {
+        if( this->timer->is_timer_elapsed( ) == false )
+        {
+            this->SetWaitingForInterrupt( );
+            break;
+        }
+
+        this->SampleChannel( this->current_channel );
+        this->current_sample++;
+
+        if( this->current_sample < this->settings.nb_samples_per_channel )
+        {
+            this->timer->set_and_start( DEMO_SPECTRUM_SWEEP_SAMPLE_PERIOD_MS );
+            this->SetWaitingForInterrupt( );
+            break;
+        }
+
+        this->current_channel++;
+        this->state = DEMO_SPECTRUM_SWEEP_STATE_TUNE;
+
+        if( this->current_channel == this->settings.nb_channels )
+        {
+            this->current_channel = 0;
+            this->PublishSweep( );
+
+            if( ( this->settings.nb_sweeps != 0 ) && ( this->results.nb_sweeps >= this->settings.nb_sweeps ) )
+            {
+                lr1110_system_set_standby( this->device->GetRadio( ), LR1110_SYSTEM_STANDBY_CFG_RC );
+                this->state = DEMO_SPECTRUM_SWEEP_STATE_INIT;
+                this->Terminate( );
+            }
+        }
+        break;
+    }
+    }
+}
+
+void DemoTransceiverRadioSpectrumSweep::SpecificStop( )
+{
+    // Results are kept so that they can still be fetched once the sweep is stopped
+    this->timer->clear_timer( );
+    lr1110_system_set_standby( this->device->GetRadio( ), LR1110_SYSTEM_STANDBY_CFG_RC );
+    this->state = DEMO_SPECTRUM_SWEEP_STATE_INIT;
+}
+
+void DemoTransceiverRadioSpectrumSweep::ConfigureRadio( ) const
+{
+    const lr1110_radio_mod_params_gfsk_t modulation = {
+        .br_in_bps    = DEMO_RADIO_GFSK_BITRATE_DEFAULT,
+        .pulse_shape  = DEMO_RADIO_GFSK_MODSHAPE_DEFAULT,
+        .bw_dsb_param = this->settings.rx_bandwidth,
+        .fdev_in_hz   = DEMO_RADIO_GFSK_FDEV_DEFAULT,
+    };
+
+    this->device->Init( );
+    lr1110_radio_set_pkt_type( this->device->GetRadio( ), LR1110_RADIO_PKT_TYPE_GFSK );
+    lr1110_radio_set_gfsk_mod_params( this->device->GetRadio( ), &modulation );
+}
+
+void DemoTransceiverRadioSpectrumSweep::ResetResults( )
+{
+    this->results.start_frequency_hz = this->settings.start_frequency_hz;
+    this->results.step_frequency_hz  = this->settings.step_frequency_hz;
+    this->results.nb_channels        = this->settings.nb_channels;
+    this->results.nb_sweeps          = 0;
+    this->nb_sweeps_in_window        = 0;
+
+    for( uint8_t channel = 0; channel < DEMO_SPECTRUM_SWEEP_MAX_CHANNELS; channel++ )
+    {
+        this->results.channels[channel].rssi_min  = INT8_MAX;
+        this->results.channels[channel].rssi_max  = INT8_MIN;
+        this->results.channels[channel].rssi_mean = INT8_MIN;
+        this->rssi_sums[channel]                  = 0;
+    }
+}
+
+void DemoTransceiverRadioSpectrumSweep::TuneChannel( const uint8_t channel ) const
+{
+    const uint32_t frequency_hz = this->settings.start_frequency_hz + channel * this->settings.step_frequency_hz;
+
+    // Keeping the crystal oscillator running avoids restarting it on every channel
+    lr1110_system_set_standby( this->device->GetRadio( ), LR1110_SYSTEM_STANDBY_CFG_XOSC );
+    lr1110_radio_set_rf_freq( this->device->GetRadio( ), frequency_hz );
+    lr1110_radio_set_rx_with_timeout_in_rtc_step( this->device->GetRadio( ), DEMO_SPECTRUM_SWEEP_RX_CONTINUOUS );
+}
+
+void DemoTransceiverRadioSpectrumSweep::SampleChannel( const uint8_t channel )
+{
+    demo_spectrum_sweep_channel_result_t& channel_result = this->results.channels[channel];
+    int8_t                                rssi           = 0;
+
+    lr1110_radio_get_rssi_inst( this->device->GetRadio( ), &rssi );
+
+    if( rssi < channel_result.rssi_min )
+    {
+        channel_result.rssi_min = rssi;
+    }
+    if( rssi > channel_result.rssi_max )
+    {
+        channel_result.rssi_max = rssi;
+    }
+    this->rssi_sums[channel] += rssi;
+}
+
+void DemoTransceiverRadioSpectrumSweep::PublishSweep( )
+{
+    // In continuous mode the sweep count saturates instead of wrapping back to 0
+    if( this->results.nb_sweeps < UINT16_MAX )
+    {
+        this->results.nb_sweeps++;
+    }
+    this->nb_sweeps_in_window++;
+
+    const int32_t nb_samples = ( int32_t ) this->nb_sweeps_in_window * this->settings.nb_samples_per_channel;
+
+    for( uint8_t channel = 0; channel < this->settings.nb_channels; channel++ )
+    {
+        this->results.channels[channel].rssi_mean = ( int8_t )( this->rssi_sums[channel] / nb_samples );
+    }
+
+    if( this->nb_sweeps_in_window == DEMO_SPECTRUM_SWEEP_MEAN_WINDOW_SWEEPS )
+    {
+        // The published means are kept until the first sweep of the next window replaces them
+        this->nb_sweeps_in_window = 0;
+        for( uint8_t channel = 0; channel < this->settings.nb_channels; channel++ )
+        {
+            this->rssi_sums[channel] = 0;
+        }
+    }
+
+    this->signaling->Rx( );
+    this->has_intermediate_results = true;
+}
+
+void DemoTransceiverRadioSpectrumSweep::ClearRegisteredIrqs( ) const {}
+
+bool DemoTransceiverRadioSpectrumSweep::HasIntermediateResults( ) const { return this->has_intermediate_results; }
+
+const demo_spectrum_sweep_results_t* DemoTransceiverRadioSpectrumSweep::GetResult( ) const { return &this->results; }
@@ -53,6 +53,9 @@ void DemoTransceiverWifiInterface::Reset( )
     this->state                          = DEMO_WIFI_INIT;
     this->results.nbrResults             = 0;
     this->results.global_consumption_uas = 0;
+    this->results.has_country_codes      = false;
+    this->results.country_code_error     = false;
+    this->results.extended_results       = NULL;
 
     uint32_t irq_to_en_dio1 = LR1110_SYSTEM_IRQ_WIFI_SCAN_DONE;
     uint32_t irq_to_en_dio2 = 0x00;
@@ -89,7 +92,15 @@ void DemoTransceiverWifiInterface::SpecificRuntime( )
             if( ( this->last_received_irq_mask & LR1110_SYSTEM_IRQ_WIFI_SCAN_DONE ) != 0 )
             {
                 signaling->StopCapture( );
-                if( this->last_received_stat_1.command_status != LR1110_SYSTEM_CMD_STATUS_OK )
+                if( ( this->last_received_stat_1.command_status != LR1110_SYSTEM_CMD_STATUS_OK ) &&
+                    ( this->HasPendingScan( ) == true ) )
+                {
+                    // Only the chained search failed: the results fetched before it are kept
+                    this->AbortPendingScan( );
+                    this->SaveCumulativeTimings( );
+                    this->state = DEMO_WIFI_TERMINATED;
+                }
+                else if( this->last_received_stat_1.command_status != LR1110_SYSTEM_CMD_STATUS_OK )
                 {
                     this->results.error      = true;
                     this->results.nbrResults = 0;
@@ -118,16 +129,16 @@ void DemoTransceiverWifiInterface::SpecificRuntime( )
     case DEMO_WIFI_GET_RESULTS:
     {
         this->FetchAndSaveResults( this->device->GetRadio( ) );
-        lr1110_wifi_cumulative_timings_t wifi_results_timings = { 0 };
 
-        lr1110_wifi_read_cumulative_timing( this->device->GetRadio( ), &wifi_results_timings );
+        // The cumulative timings are only reset on init, so they cover all the searches chained by the demo
+        if( this->HasPendingScan( ) == true )
+        {
+            this->state = DEMO_WIFI_SCAN;
+            break;
+        }
 
-        uint32_t consumption_uas =
-            DemoTransceiverWifiInterface::ComputeConsumption( LR1110_SYSTEM_REG_MODE_DCDC, wifi_results_timings );
-        results.timings = DemoTransceiverWifiInterface::demo_wifi_timing_from_transceiver( wifi_results_timings );
-        results.global_consumption_uas += consumption_uas;
-        results.error = false;
-        this->state   = DEMO_WIFI_TERMINATED;
+        this->SaveCumulativeTimings( );
+        this->state = DEMO_WIFI_TERMINATED;
 
         break;
     }
@@ -162,6 +173,23 @@ const char* DemoTransceiverWifiInterface::state2str( const demo_wifi_state_t sta
 
 const demo_wifi_scan_all_results_t* DemoTransceiverWifiInterface::GetResult( ) const { return &this->results; }
 
+bool DemoTransceiverWifiInterface::HasPendingScan( ) const { return false; }
+
+void DemoTransceiverWifiInterface::AbortPendingScan( ) {}
+
+void DemoTransceiverWifiInterface::SaveCumulativeTimings( )
+{
+    lr1110_wifi_cumulative_timings_t wifi_results_timings = { 0 };
+
+    lr1110_wifi_read_cumulative_timing( this->device->GetRadio( ), &wifi_results_timings );
+
+    uint32_t consumption_uas =
+        DemoTransceiverWifiInterface::ComputeConsumption( LR1110_SYSTEM_REG_MODE_DCDC, wifi_results_timings );
+    this->results.timings = DemoTransceiverWifiInterface::demo_wifi_timing_from_transceiver( wifi_results_timings );
+    this->results.global_consumption_uas += consumption_uas;
+    this->results.error = false;
+}
+
 uint32_t DemoTransceiverWifiInterface::ComputeConsumption( const lr1110_system_reg_mode_t          regMode,
                                                            const lr1110_wifi_cumulative_timings_t& timing )
 {
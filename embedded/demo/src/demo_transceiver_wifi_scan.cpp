@@ -38,23 +38,49 @@
 DemoTransceiverWifiScan::DemoTransceiverWifiScan( DeviceTransceiver* device, SignalingInterface* signaling,
                                                   CommunicationInterface* communication_interface,
                                                   EnvironmentInterface*   environment )
-    : DemoTransceiverWifiInterface( device, signaling, communication_interface, environment )
+    : DemoTransceiverWifiInterface( device, signaling, communication_interface, environment ),
+      is_searching_country_code( false )
 {
 }
 
 DemoTransceiverWifiScan::~DemoTransceiverWifiScan( ) {}
 
+void DemoTransceiverWifiScan::Reset( )
+{
+    this->DemoTransceiverWifiInterface::Reset( );
+    this->is_searching_country_code = false;
+}
+
 void DemoTransceiverWifiScan::ExecuteScan( radio_t* radio )
 {
+    if( this->is_searching_country_code == true )
+    {
+        lr1110_wifi_search_country_code( radio, this->settings.channels, this->settings.max_results,
+                                         this->settings.nbr_retrials, this->settings.timeout,
+                                         this->settings.does_abort_on_timeout );
+        return;
+    }
+
+    // Extended results can only be read after a scan demodulating the beacons until their end
+    const lr1110_wifi_mode_t scan_mode =
+        ( this->settings.result_type == DEMO_WIFI_RESULT_TYPE_EXTENDED_FULL )
+            ? LR1110_WIFI_SCAN_MODE_FULL_BEACON
+            : DemoTransceiverWifiInterface::transceiver_wifi_mode_from_demo( this->settings.scan_mode );
+
     lr1110_wifi_scan( radio, DemoTransceiverWifiInterface::transceiver_wifi_scan_type_from_demo( this->settings.types ),
-                      this->settings.channels,
-                      DemoTransceiverWifiInterface::transceiver_wifi_mode_from_demo( this->settings.scan_mode ),
-                      this->settings.max_results, this->settings.nbr_retrials, this->settings.timeout,
-                      this->settings.does_abort_on_timeout );
+                      this->settings.channels, scan_mode, this->settings.max_results, this->settings.nbr_retrials,
+                      this->settings.timeout, this->settings.does_abort_on_timeout );
 }
 
 void DemoTransceiverWifiScan::FetchAndSaveResults( radio_t* radio )
 {
+    if( this->is_searching_country_code == true )
+    {
+        this->FetchAndJoinCountryCodeResults( radio );
+        this->is_searching_country_code = false;
+        return;
+    }
+
     switch( this->settings.result_type )
     {
     case DEMO_WIFI_RESULT_TYPE_BASIC_COMPLETE:
@@ -67,37 +93,120 @@ void DemoTransceiverWifiScan::FetchAndSaveResults( radio_t* radio )
         this->FetchAndSaveBasicMacChannelTypeResults( radio );
         break;
     }
+    case DEMO_WIFI_RESULT_TYPE_EXTENDED_FULL:
+    {
+        this->FetchAndSaveExtendedFullResults( radio );
+        break;
+    }
+    }
+
+    // The country code search runs right after the scan, without any new configuration of the radio
+    this->is_searching_country_code = this->settings.does_search_country_code;
+    this->results.has_country_codes = this->settings.does_search_country_code;
+}
+
+bool DemoTransceiverWifiScan::HasPendingScan( ) const { return this->is_searching_country_code; }
+
+void DemoTransceiverWifiScan::AbortPendingScan( )
+{
+    this->is_searching_country_code  = false;
+    this->results.country_code_error = true;
+}
+
+void DemoTransceiverWifiScan::FetchAndJoinCountryCodeResults( radio_t* radio )
+{
+    lr1110_wifi_country_code_t wifi_results_country_code[DEMO_WIFI_MAX_RESULTS_PER_SCAN] = { 0 };
+    uint8_t                    nbr_results                                               = 0;
+
+    lr1110_wifi_get_nb_country_code_results( radio, &nbr_results );
+    const uint8_t max_results_to_fetch =
+        ( nbr_results > DEMO_WIFI_MAX_RESULTS_PER_SCAN ) ? DEMO_WIFI_MAX_RESULTS_PER_SCAN : nbr_results;
+    lr1110_wifi_read_country_code_results( radio, 0, max_results_to_fetch, wifi_results_country_code );
+
+    for( uint8_t index_country_code = 0; index_country_code < max_results_to_fetch; index_country_code++ )
+    {
+        const lr1110_wifi_country_code_t* country_code = &wifi_results_country_code[index_country_code];
+
+        for( uint8_t index_result = 0; index_result < this->results.nbrResults; index_result++ )
+        {
+            demo_wifi_scan_single_result_t* local_result = &this->results.results[index_result];
+
+            if( memcmp( local_result->mac_address, country_code->mac_address, LR1110_WIFI_MAC_ADDRESS_LENGTH ) == 0 )
+            {
+                local_result->country_code[0] = country_code->country_code[0];
+                local_result->country_code[1] = country_code->country_code[1];
+            }
+        }
     }
 }
 
 void DemoTransceiverWifiScan::FetchAndSaveBasicCompleteResults( radio_t* radio )
 {
-    lr1110_wifi_basic_complete_result_t wifi_results_mac_addr[DEMO_WIFI_MAX_RESULTS_PER_SCAN] = { 0 };
-    uint8_t                             nbr_results                                           = 0;
+    uint8_t nbr_results = 0;
 
     lr1110_wifi_get_nb_results( radio, &nbr_results );
     const uint8_t max_results_to_fetch =
         ( nbr_results > DEMO_WIFI_MAX_RESULTS_PER_SCAN ) ? DEMO_WIFI_MAX_RESULTS_PER_SCAN : nbr_results;
 
-    lr1110_wifi_read_basic_complete_results( this->device->GetRadio( ), 0, max_results_to_fetch,
-                                             wifi_results_mac_addr );
-
-    AddScanToResults( LR1110_SYSTEM_REG_MODE_DCDC, this->results, wifi_results_mac_addr, max_results_to_fetch );
+    lr1110_wifi_stream_basic_complete_results( radio, 0, max_results_to_fetch,
+                                               DemoTransceiverWifiScan::StreamBasicCompleteResult, this );
 }
 
 void DemoTransceiverWifiScan::FetchAndSaveBasicMacChannelTypeResults( radio_t* radio )
 {
-    lr1110_wifi_basic_mac_type_channel_result_t wifi_results_mac_addr[DEMO_WIFI_MAX_RESULTS_PER_SCAN] = { 0 };
-    uint8_t                                     nbr_results                                           = 0;
+    uint8_t nbr_results = 0;
+
+    lr1110_wifi_get_nb_results( radio, &nbr_results );
+    const uint8_t max_results_to_fetch =
+        ( nbr_results > DEMO_WIFI_MAX_RESULTS_PER_SCAN ) ? DEMO_WIFI_MAX_RESULTS_PER_SCAN : nbr_results;
+
+    lr1110_wifi_stream_basic_mac_type_channel_results( radio, 0, max_results_to_fetch,
+                                                       DemoTransceiverWifiScan::StreamBasicMacChannelTypeResult, this );
+}
+
+void DemoTransceiverWifiScan::FetchAndSaveExtendedFullResults( radio_t* radio )
+{
+    uint8_t nbr_results = 0;
+
+    this->extended_results.nb_records = 0;
+    this->extended_results.length     = 0;
+    this->results.extended_results    = &this->extended_results;
 
     lr1110_wifi_get_nb_results( radio, &nbr_results );
     const uint8_t max_results_to_fetch =
         ( nbr_results > DEMO_WIFI_MAX_RESULTS_PER_SCAN ) ? DEMO_WIFI_MAX_RESULTS_PER_SCAN : nbr_results;
 
-    lr1110_wifi_read_basic_mac_type_channel_results( this->device->GetRadio( ), 0, max_results_to_fetch,
-                                                     wifi_results_mac_addr );
+    // Extended results are large: only their relevant fields are kept while they are streamed out of the SPI buffer
+    lr1110_wifi_stream_extended_full_results( radio, 0, max_results_to_fetch,
+                                              DemoTransceiverWifiScan::StreamExtendedFullResult, this );
+}
+
+bool DemoTransceiverWifiScan::StreamBasicCompleteResult( const lr1110_wifi_basic_complete_result_t* result,
+                                                         void*                                      context )
+{
+    DemoTransceiverWifiScan* self = ( DemoTransceiverWifiScan* ) context;
+
+    AddScanToResults( LR1110_SYSTEM_REG_MODE_DCDC, self->results, result, 1 );
+
+    return self->results.nbrResults < DEMO_WIFI_MAX_RESULT_TOTAL;
+}
+
+bool DemoTransceiverWifiScan::StreamBasicMacChannelTypeResult(
+    const lr1110_wifi_basic_mac_type_channel_result_t* result, void* context )
+{
+    DemoTransceiverWifiScan* self = ( DemoTransceiverWifiScan* ) context;
+
+    AddScanToResults( LR1110_SYSTEM_REG_MODE_DCDC, self->results, result, 1 );
 
-    AddScanToResults( LR1110_SYSTEM_REG_MODE_DCDC, this->results, wifi_results_mac_addr, max_results_to_fetch );
+    return self->results.nbrResults < DEMO_WIFI_MAX_RESULT_TOTAL;
+}
+
+bool DemoTransceiverWifiScan::StreamExtendedFullResult( const lr1110_wifi_extended_full_result_t* result,
+                                                        void*                                     context )
+{
+    DemoTransceiverWifiScan* self = ( DemoTransceiverWifiScan* ) context;
+
+    return AddScanToResults( self->results, self->extended_results, result );
 }
 
 void DemoTransceiverWifiScan::Configure( demo_wifi_settings_t& config ) { this->settings = config; }
@@ -148,4 +257,44 @@ void DemoTransceiverWifiScan::AddScanToResults( const lr1110_system_reg_mode_t
         results.results[results.nbrResults].country_code[1] = '?';
         results.nbrResults++;
     }
-}
\ No newline at end of file
+}
+
+bool DemoTransceiverWifiScan::AddScanToResults( demo_wifi_scan_all_results_t&             results,
+                                                demo_wifi_extended_results_t&             extended_results,
+                                                const lr1110_wifi_extended_full_result_t* scan_result )
+{
+    uint8_t ssid_length = DEMO_WIFI_SSID_MAX_LENGTH;
+    while( ( ssid_length > 0 ) && ( scan_result->ssid_bytes[ssid_length - 1] == 0x00 ) )
+    {
+        ssid_length--;
+    }
+
+    const uint16_t record_length = DEMO_WIFI_EXTENDED_RECORD_HEADER_SIZE + ssid_length;
+    if( ( results.nbrResults >= DEMO_WIFI_MAX_RESULT_TOTAL ) ||
+        ( extended_results.length + record_length > DEMO_WIFI_EXTENDED_ARENA_SIZE ) )
+    {
+        return false;
+    }
+
+    demo_wifi_scan_single_result_t* local_result = &results.results[results.nbrResults];
+    local_result->channel = lr1110_wifi_extract_channel_from_info_byte( scan_result->channel_info_byte );
+    local_result->type    = DemoTransceiverWifiInterface::demo_wifi_types_from_transceiver(
+        lr1110_wifi_extract_signal_type_from_data_rate_info( scan_result->data_rate_info_byte ) );
+    memcpy( local_result->mac_address, scan_result->mac_address_2, LR1110_WIFI_MAC_ADDRESS_LENGTH );
+    local_result->rssi            = scan_result->rssi;
+    local_result->country_code[0] = '?';
+    local_result->country_code[1] = '?';
+    results.nbrResults++;
+
+    uint8_t* record = &extended_results.arena[extended_results.length];
+    memcpy( record, local_result->mac_address, LR1110_WIFI_MAC_ADDRESS_LENGTH );
+    record[6] = local_result->channel;
+    record[7] = ( uint8_t ) local_result->type;
+    record[8] = ( uint8_t ) local_result->rssi;
+    record[9] = ssid_length;
+    memcpy( &record[DEMO_WIFI_EXTENDED_RECORD_HEADER_SIZE], scan_result->ssid_bytes, ssid_length );
+    extended_results.length += record_length;
+    extended_results.nb_records++;
+
+    return true;
+}
@@ -0,0 +1,121 @@
+/**
+ * @file      demo_wifi_channel_planner.cpp
+ *
+ * @brief     Implementation of the Wi-Fi channel planner.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "demo_wifi_channel_planner.h"
+
+DemoWifiChannelPlanner::DemoWifiChannelPlanner( ) { this->Reset( ); }
+
+DemoWifiChannelPlanner::~DemoWifiChannelPlanner( ) {}
+
+void DemoWifiChannelPlanner::Reset( )
+{
+    for( uint8_t index = 0; index < DEMO_WIFI_CHANNEL_PLANNER_NB_CHANNELS; index++ )
+    {
+        this->nb_scans_without_hit[index] = DEMO_WIFI_CHANNEL_PLANNER_MAX_SCANS_WITHOUT_HIT;
+    }
+    this->nb_narrowed_scans       = 0;
+    this->planned_mask            = 0;
+    this->is_planned_full_sweep   = false;
+    this->is_full_sweep_requested = true;
+}
+
+demo_wifi_channel_mask_t DemoWifiChannelPlanner::Plan( const demo_wifi_channel_mask_t configured_mask )
+{
+    const demo_wifi_channel_mask_t active_mask = configured_mask & this->GetActiveChannelMask( );
+
+    if( ( this->is_full_sweep_requested == true ) ||
+        ( this->nb_narrowed_scans >= DEMO_WIFI_CHANNEL_PLANNER_MAX_NARROWED_SCANS ) || ( active_mask == 0 ) )
+    {
+        this->planned_mask            = configured_mask;
+        this->is_planned_full_sweep   = true;
+        this->is_full_sweep_requested = false;
+        this->nb_narrowed_scans       = 0;
+    }
+    else
+    {
+        this->planned_mask          = active_mask;
+        this->is_planned_full_sweep = ( active_mask == configured_mask );
+        this->nb_narrowed_scans++;
+    }
+    return this->planned_mask;
+}
+
+void DemoWifiChannelPlanner::Update( const demo_wifi_scan_all_results_t* results )
+{
+    if( ( this->planned_mask == 0 ) || ( results->error == true ) )
+    {
+        this->planned_mask = 0;
+        return;
+    }
+
+    demo_wifi_channel_mask_t hit_mask = 0;
+    for( uint8_t index = 0; index < results->nbrResults; index++ )
+    {
+        const demo_wifi_channel_t channel = results->results[index].channel;
+        if( ( channel >= 1 ) && ( channel <= DEMO_WIFI_CHANNEL_PLANNER_NB_CHANNELS ) )
+        {
+            hit_mask |= ( demo_wifi_channel_mask_t )( 1 << ( channel - 1 ) );
+        }
+    }
+
+    for( uint8_t index = 0; index < DEMO_WIFI_CHANNEL_PLANNER_NB_CHANNELS; index++ )
+    {
+        const demo_wifi_channel_mask_t channel_mask = ( demo_wifi_channel_mask_t )( 1 << index );
+        if( ( hit_mask & channel_mask ) != 0 )
+        {
+            this->nb_scans_without_hit[index] = 0;
+        }
+        else if( ( ( this->planned_mask & channel_mask ) != 0 ) &&
+                 ( this->nb_scans_without_hit[index] < DEMO_WIFI_CHANNEL_PLANNER_MAX_SCANS_WITHOUT_HIT ) )
+        {
+            this->nb_scans_without_hit[index]++;
+        }
+    }
+
+    if( ( hit_mask == 0 ) && ( this->is_planned_full_sweep == false ) )
+    {
+        this->is_full_sweep_requested = true;
+    }
+    this->planned_mask = 0;
+}
+
+demo_wifi_channel_mask_t DemoWifiChannelPlanner::GetActiveChannelMask( ) const
+{
+    demo_wifi_channel_mask_t active_mask = 0;
+    for( uint8_t index = 0; index < DEMO_WIFI_CHANNEL_PLANNER_NB_CHANNELS; index++ )
+    {
+        if( this->nb_scans_without_hit[index] < DEMO_WIFI_CHANNEL_PLANNER_MAX_SCANS_WITHOUT_HIT )
+        {
+            active_mask |= ( demo_wifi_channel_mask_t )( 1 << index );
+        }
+    }
+    return active_mask;
+}
@@ -73,10 +73,13 @@ class DeviceInterface
 
     virtual void     Init( )                                                                            = 0;
     virtual void     FetchVersion( version_handler_t& version_handler )                                 = 0;
-    virtual void     GetAlmanacAgesAndCrcOfAllSatellites( GnssHelperAlmanacDetails_t* almanac_details ) = 0;
+    virtual bool     GetAlmanacAgesAndCrcOfAllSatellites( GnssHelperAlmanacDetails_t* almanac_details ) = 0;
     virtual void     GetAlmanacAgesForSatelliteId( uint8_t sv_id, uint16_t* almanac_age )               = 0;
     virtual void     UpdateAlmanac( const uint8_t* almanac_buffer, const uint8_t buffer_size )          = 0;
     virtual bool     checkAlmanacUpdate( uint32_t expected_crc )                                        = 0;
+    virtual bool     IsAlmanacDeltaUpdateSupported( ) const                                             = 0;
+    virtual bool     GetAlmanacBlockCrc( const uint8_t sv_id, uint32_t* block_crc ) const              = 0;
+    virtual bool     GetOldestAlmanacAge( uint16_t* oldest_almanac_age )                                = 0;
     virtual bool     FetchInterrupt( InterruptionInterface** interruption )                             = 0;
     virtual bool     IsLorawanPortForDeviceManagement( const uint8_t port ) const                       = 0;
     virtual void     HandleLorawanDeviceManagement( const uint8_t port, const uint8_t* payload,
@@ -44,7 +44,7 @@ class DeviceModem : public DeviceInterface
     explicit DeviceModem( radio_t* radio, EnvironmentInterface* environment );
     void FetchVersion( version_handler_t& version_handler ) override;
     void Init( ) override;
-    void GetAlmanacAgesAndCrcOfAllSatellites( GnssHelperAlmanacDetails_t* almanac_details ) override;
+    bool GetAlmanacAgesAndCrcOfAllSatellites( GnssHelperAlmanacDetails_t* almanac_details ) override;
     void GetAlmanacAgesForSatelliteId( uint8_t sv_id, uint16_t* almanac_age ) override;
     void UpdateAlmanac( const uint8_t* almanac_buffer, const uint8_t buffer_size ) override;
     bool FetchInterrupt( InterruptionInterface** interruption ) override;
@@ -52,6 +52,9 @@ class DeviceModem : public DeviceInterface
     void HandleLorawanDeviceManagement( const uint8_t port, const uint8_t* payload,
                                         const uint8_t payload_length ) override;
     bool checkAlmanacUpdate( uint32_t expected_crc ) override;
+    bool IsAlmanacDeltaUpdateSupported( ) const override;
+    bool GetAlmanacBlockCrc( const uint8_t sv_id, uint32_t* block_crc ) const override;
+    bool GetOldestAlmanacAge( uint16_t* oldest_almanac_age ) override;
     void NotifyEnvironmentChange( ) override;
     void FetchAssistanceLocation( DeviceAssistedLocation_t* assistance_location ) override;
     void FetchLastApplicationServerEvent( ApplicationServerEvent_t* last_application_server_event ) override;
@@ -62,6 +65,9 @@ class DeviceModem : public DeviceInterface
                                              lr1110_modem_gnss_solver_assistance_position_t& gnss_position );
     bool        HasAssistedLocationUpdated( ) override;
     bool        HasApplicationServerEvent( ) override;
+    uint32_t    ReadAlmanacCrc( ) const;
+    bool        ValidateAlmanacCache( );
+    bool        RefreshAlmanacCache( const uint32_t almanac_crc );
 
     InterruptionModem interruption;
 
@@ -69,6 +75,11 @@ class DeviceModem : public DeviceInterface
     bool                     has_assisted_location_update;
     bool                     has_application_server_event;
     ApplicationServerEvent_t last_application_server_event;
+    // Almanac ages read from the chip, valid as long as the global almanac CRC equals almanac_cache.crc_almanac
+    GnssHelperAlmanacDetails_t almanac_cache;
+    // Oldest date among the satellites of almanac_cache having an almanac, 0 if none
+    uint16_t                   oldest_almanac_age;
+    bool                       is_almanac_cache_valid;
 };
 
 #endif  // __DEVICE_MODEM_H__
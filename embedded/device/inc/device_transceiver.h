@@ -42,7 +42,7 @@ class DeviceTransceiver : public DeviceInterface
     explicit DeviceTransceiver( radio_t* radio, EnvironmentInterface* environment );
     void FetchVersion( version_handler_t& version_handler ) override;
     void Init( ) override;
-    void GetAlmanacAgesAndCrcOfAllSatellites( GnssHelperAlmanacDetails_t* almanac_details ) override;
+    bool GetAlmanacAgesAndCrcOfAllSatellites( GnssHelperAlmanacDetails_t* almanac_details ) override;
     void GetAlmanacAgesForSatelliteId( uint8_t sv_id, uint16_t* almanac_age ) override;
     void UpdateAlmanac( const uint8_t* almanac_buffer, const uint8_t buffer_size ) override;
     bool FetchInterrupt( InterruptionInterface** interruption ) override;
@@ -50,6 +50,9 @@ class DeviceTransceiver : public DeviceInterface
     void HandleLorawanDeviceManagement( const uint8_t port, const uint8_t* payload,
                                         const uint8_t payload_length ) override;
     bool checkAlmanacUpdate( uint32_t expected_crc ) override;
+    bool IsAlmanacDeltaUpdateSupported( ) const override;
+    bool GetAlmanacBlockCrc( const uint8_t sv_id, uint32_t* block_crc ) const override;
+    bool GetOldestAlmanacAge( uint16_t* oldest_almanac_age ) override;
     void NotifyEnvironmentChange( ) override;
     void FetchAssistanceLocation( DeviceAssistedLocation_t* assistance_location ) override;
     void FetchLastApplicationServerEvent( ApplicationServerEvent_t* last_application_server_event ) override;
@@ -58,8 +61,25 @@ class DeviceTransceiver : public DeviceInterface
     bool HasAssistedLocationUpdated( ) override;
     bool HasApplicationServerEvent( ) override;
 
+    uint32_t ReadAlmanacCrc( ) const;
+    bool     SeedAlmanacIndex( );
+    void     IndexAlmanacBlock( const uint8_t* almanac_block );
+    void     RefreshOldestAlmanacAge( );
+
+    static uint32_t ComputeAlmanacBlockCrc( const uint8_t* almanac_block, const uint8_t block_size );
+
    private:
     InterruptionIrq last_interrupt;
+    // Almanac ages indexed by satellite id, seeded once from the chip then maintained from the blocks written by
+    // UpdateAlmanac
+    GnssHelperAlmanacDetails_t almanac_index;
+    // Oldest date among the satellites having an almanac, and how many satellites share it, 0 if none
+    uint16_t                   oldest_almanac_age;
+    uint8_t                    n_satellites_with_oldest_age;
+    bool                       is_almanac_index_valid;
+    bool                       is_almanac_crc_valid;
+    // CRC32 of the last block written for each satellite since reset, 0 when unknown
+    uint32_t                   almanac_block_crcs[GNSS_HELPER_NUMBER_SATELLITES_ALMANAC_READ];
 };
 
 #endif  // __DEVICE_TRANSCEIVER_H__
\ No newline at end of file
@@ -40,12 +40,19 @@
 
 #define DEVICE_MODEM_PORT_HANDLE_SOLVER_MESSAGE ( 150 )
 #define DEVICE_MODEM_PORT_HANDLE_APPLICATION_SERVER_MESSAGE ( 151 )
+// The almanac read command returns at most 11 satellites (242 bytes) per call
+#define DEVICE_MODEM_ALMANAC_READ_MAX_SATELLITES ( 11 )
+#define DEVICE_MODEM_ALMANAC_READ_CHUNK_SIZE \
+    ( DEVICE_MODEM_ALMANAC_READ_MAX_SATELLITES * LR1110_MODEM_GNSS_SINGLE_ALMANAC_READ_SIZE )
 
 DeviceModem::DeviceModem( radio_t* radio, EnvironmentInterface* environment )
     : DeviceInterface( radio, environment ),
       has_assisted_location_update( false ),
       has_application_server_event( false ),
-      last_application_server_event( APPLICATION_SERVER_NO_EVENT )
+      last_application_server_event( APPLICATION_SERVER_NO_EVENT ),
+      almanac_cache( ),
+      oldest_almanac_age( 0 ),
+      is_almanac_cache_valid( false )
 {
 }
 
@@ -72,21 +79,36 @@ void DeviceModem::Init( )
     this->SetAssistancePositionFromEnvironment( );
 }
 
-void DeviceModem::GetAlmanacAgesAndCrcOfAllSatellites( GnssHelperAlmanacDetails_t* almanac_details )
+bool DeviceModem::GetAlmanacAgesAndCrcOfAllSatellites( GnssHelperAlmanacDetails_t* almanac_details )
 {
-    for( uint8_t index_satellite = 0; index_satellite < GNSS_HELPER_NUMBER_SATELLITES_ALMANAC_READ; index_satellite++ )
+    if( this->ValidateAlmanacCache( ) == false )
     {
-        almanac_details->ages_per_almanacs[index_satellite].sv_id = index_satellite;
-        this->GetAlmanacAgesForSatelliteId( index_satellite,
-                                            &almanac_details->ages_per_almanacs[index_satellite].almanac_age );
+        return false;
     }
-    lr1110_modem_gnss_context_t gnss_context = { 0 };
-    lr1110_modem_gnss_get_context( this->radio, &gnss_context );
-    almanac_details->crc_almanac = gnss_context.global_almanac_crc;
+
+    *almanac_details = this->almanac_cache;
+    return true;
+}
+
+bool DeviceModem::GetOldestAlmanacAge( uint16_t* oldest_almanac_age )
+{
+    if( this->ValidateAlmanacCache( ) == false )
+    {
+        return false;
+    }
+
+    ( *oldest_almanac_age ) = this->oldest_almanac_age;
+    return true;
 }
 
 void DeviceModem::GetAlmanacAgesForSatelliteId( uint8_t sv_id, uint16_t* almanac_age )
 {
+    if( ( this->is_almanac_cache_valid == true ) && ( sv_id < GNSS_HELPER_NUMBER_SATELLITES_ALMANAC_READ ) )
+    {
+        ( *almanac_age ) = this->almanac_cache.ages_per_almanacs[sv_id].almanac_age;
+        return;
+    }
+
     uint8_t local_almanac[LR1110_MODEM_GNSS_SINGLE_ALMANAC_READ_SIZE] = { 0 };
     lr1110_modem_gnss_almanac_read_by_index( this->radio, sv_id, 1, local_almanac,
                                              LR1110_MODEM_GNSS_SINGLE_ALMANAC_READ_SIZE );
@@ -97,10 +119,80 @@ void DeviceModem::UpdateAlmanac( const uint8_t* almanac_buffer, const uint8_t bu
 {
     if( buffer_size == LR1110_MODEM_GNSS_SINGLE_ALMANAC_WRITE_SIZE )
     {
+        this->is_almanac_cache_valid = false;
         lr1110_modem_gnss_one_chunk_almanac_update( this->radio, almanac_buffer );
     }
 }
 
+uint32_t DeviceModem::ReadAlmanacCrc( ) const
+{
+    lr1110_modem_gnss_context_t gnss_context = { 0 };
+    lr1110_modem_gnss_get_context( this->radio, &gnss_context );
+    return gnss_context.global_almanac_crc;
+}
+
+bool DeviceModem::ValidateAlmanacCache( )
+{
+    const uint32_t almanac_crc = this->ReadAlmanacCrc( );
+
+    if( ( this->is_almanac_cache_valid == false ) || ( this->almanac_cache.crc_almanac != almanac_crc ) )
+    {
+        // On failure the cache stays invalid with its previous CRC, so the next call reads the ages again
+        return this->RefreshAlmanacCache( almanac_crc );
+    }
+
+    return true;
+}
+
+bool DeviceModem::RefreshAlmanacCache( const uint32_t almanac_crc )
+{
+    uint8_t  almanac_chunk[DEVICE_MODEM_ALMANAC_READ_CHUNK_SIZE] = { 0 };
+    uint16_t oldest_almanac_age                                  = 0;
+
+    this->is_almanac_cache_valid = false;
+
+    for( uint8_t index_satellite = 0; index_satellite < GNSS_HELPER_NUMBER_SATELLITES_ALMANAC_READ;
+         index_satellite += DEVICE_MODEM_ALMANAC_READ_MAX_SATELLITES )
+    {
+        const uint8_t remaining_satellites = GNSS_HELPER_NUMBER_SATELLITES_ALMANAC_READ - index_satellite;
+        const uint8_t n_satellites = ( remaining_satellites < DEVICE_MODEM_ALMANAC_READ_MAX_SATELLITES )
+                                         ? remaining_satellites
+                                         : DEVICE_MODEM_ALMANAC_READ_MAX_SATELLITES;
+
+        const lr1110_modem_response_code_t response_code = lr1110_modem_gnss_almanac_read_by_index(
+            this->radio, index_satellite, n_satellites, almanac_chunk,
+            n_satellites * LR1110_MODEM_GNSS_SINGLE_ALMANAC_READ_SIZE );
+        if( response_code != LR1110_MODEM_RESPONSE_CODE_OK )
+        {
+            return false;
+        }
+
+        for( uint8_t index_chunk = 0; index_chunk < n_satellites; index_chunk++ )
+        {
+            const uint8_t* local_almanac = &almanac_chunk[index_chunk * LR1110_MODEM_GNSS_SINGLE_ALMANAC_READ_SIZE];
+            GnssHelperAgeAlmanac_t* age_almanac =
+                &this->almanac_cache.ages_per_almanacs[index_satellite + index_chunk];
+
+            age_almanac->sv_id = index_satellite + index_chunk;
+            age_almanac->almanac_age =
+                ( ( uint16_t )( local_almanac[1] ) << 0 ) + ( ( uint16_t )( local_almanac[2] ) << 8 );
+
+            // A date of 0 means the satellite has no almanac, so it does not take part in the oldest age
+            if( ( age_almanac->almanac_age != 0 ) &&
+                ( ( oldest_almanac_age == 0 ) || ( age_almanac->almanac_age < oldest_almanac_age ) ) )
+            {
+                oldest_almanac_age = age_almanac->almanac_age;
+            }
+        }
+    }
+
+    this->almanac_cache.crc_almanac = almanac_crc;
+    this->oldest_almanac_age        = oldest_almanac_age;
+    this->is_almanac_cache_valid    = true;
+
+    return true;
+}
+
 bool DeviceModem::FetchInterrupt( InterruptionInterface** interruption )
 {
     lr1110_modem_event_fields_t event = { };
@@ -133,6 +225,8 @@ void DeviceModem::HandleLorawanDeviceManagement( const uint8_t port, const uint8
     {
     case DEVICE_MODEM_PORT_HANDLE_SOLVER_MESSAGE:
     {
+        // Solver messages may carry almanac updates
+        this->is_almanac_cache_valid = false;
         lr1110_modem_gnss_push_solver_msg( this->radio, payload, payload_length );
         this->has_assisted_location_update = true;
         break;
@@ -157,9 +251,30 @@ void DeviceModem::HandleLorawanDeviceManagement( const uint8_t port, const uint8
 
 bool DeviceModem::checkAlmanacUpdate( uint32_t expected_crc )
 {
-    lr1110_modem_gnss_context_t gnss_context = { };
-    lr1110_modem_gnss_get_context( this->radio, &gnss_context );
-    return expected_crc == gnss_context.global_almanac_crc;
+    if( ( this->is_almanac_cache_valid == true ) && ( this->almanac_cache.crc_almanac == expected_crc ) )
+    {
+        // Nothing has been written since the cache was filled with the expected almanac
+        return true;
+    }
+
+    const uint32_t almanac_crc = this->ReadAlmanacCrc( );
+    if( almanac_crc != this->almanac_cache.crc_almanac )
+    {
+        this->is_almanac_cache_valid = false;
+    }
+    return expected_crc == almanac_crc;
+}
+
+bool DeviceModem::IsAlmanacDeltaUpdateSupported( ) const
+{
+    // The modem only accepts almanac chunks as a complete sequence
+    return false;
+}
+
+bool DeviceModem::GetAlmanacBlockCrc( const uint8_t sv_id, uint32_t* block_crc ) const
+{
+    ( *block_crc ) = 0;
+    return false;
 }
 
 void DeviceModem::NotifyEnvironmentChange( ) { this->SetAssistancePositionFromEnvironment( ); }
@@ -189,9 +304,11 @@ void DeviceModem::FetchVersion( version_handler_t& version_handler )
     strcpy( version_handler.version_driver, lr1110_modem_driver_version_get_version_string( ) );
 
     GnssHelperAlmanacDetails_t almanac_ages_crc = { 0 };
-    this->GetAlmanacAgesAndCrcOfAllSatellites( &almanac_ages_crc );
-    version_handler.almanac_date = almanac_ages_crc.ages_per_almanacs[0].almanac_age;
-    version_handler.almanac_crc  = almanac_ages_crc.crc_almanac;
+    if( this->GetAlmanacAgesAndCrcOfAllSatellites( &almanac_ages_crc ) == true )
+    {
+        version_handler.almanac_date = almanac_ages_crc.ages_per_almanacs[0].almanac_age;
+        version_handler.almanac_crc  = almanac_ages_crc.crc_almanac;
+    }
 }
 
 void DeviceModem::FetchAssistanceLocation( DeviceAssistedLocation_t* assistance_location )
@@ -43,7 +43,13 @@
     } while( 0 )
 
 DeviceTransceiver::DeviceTransceiver( radio_t* radio, EnvironmentInterface* environment )
-    : DeviceInterface( radio, environment )
+    : DeviceInterface( radio, environment ),
+      almanac_index( ),
+      oldest_almanac_age( 0 ),
+      n_satellites_with_oldest_age( 0 ),
+      is_almanac_index_valid( false ),
+      is_almanac_crc_valid( false ),
+      almanac_block_crcs( )
 {
 }
 
@@ -72,35 +78,175 @@ void DeviceTransceiver::Init( )
     lr1110_system_clear_irq_status( this->radio, LR1110_SYSTEM_IRQ_ALL_MASK );
 }
 
-void DeviceTransceiver::GetAlmanacAgesAndCrcOfAllSatellites( GnssHelperAlmanacDetails_t* almanac_details )
+bool DeviceTransceiver::GetAlmanacAgesAndCrcOfAllSatellites( GnssHelperAlmanacDetails_t* almanac_details )
 {
-    lr1110_gnss_almanac_full_read_bytestream_t almanac_bytestream = { 0 };
-    lr1110_gnss_read_almanac( this->radio, almanac_bytestream );
-    uint16_t index_bytestream = 0;
-    for( uint8_t index_satellite = 0; ( index_bytestream < ( LR1110_GNSS_FULL_ALMANAC_READ_BUFFER_SIZE - 4 ) ) &&
-                                      ( index_satellite < GNSS_HELPER_NUMBER_SATELLITES_ALMANAC_READ );
-         index_bytestream += 22, index_satellite++ )
+    if( ( this->is_almanac_index_valid == false ) && ( this->SeedAlmanacIndex( ) == false ) )
     {
-        almanac_details->ages_per_almanacs[index_satellite].sv_id = almanac_bytestream[index_bytestream];
-        almanac_details->ages_per_almanacs[index_satellite].almanac_age =
-            ( almanac_bytestream[index_bytestream + 1] ) + ( almanac_bytestream[index_bytestream + 2] << 8 );
+        return false;
     }
-    almanac_details->crc_almanac = almanac_bytestream[GNSS_HELPER_NUMBER_SATELLITES_ALMANAC_READ - 1] +
-                                   ( almanac_bytestream[GNSS_HELPER_NUMBER_SATELLITES_ALMANAC_READ - 2] << 8 ) +
-                                   ( almanac_bytestream[GNSS_HELPER_NUMBER_SATELLITES_ALMANAC_READ - 3] << 16 ) +
-                                   ( almanac_bytestream[GNSS_HELPER_NUMBER_SATELLITES_ALMANAC_READ - 4] << 24 );
+
+    if( this->is_almanac_crc_valid == false )
+    {
+        this->almanac_index.crc_almanac = this->ReadAlmanacCrc( );
+        this->is_almanac_crc_valid      = true;
+    }
+
+    *almanac_details = this->almanac_index;
+    return true;
 }
 
 void DeviceTransceiver::GetAlmanacAgesForSatelliteId( uint8_t sv_id, uint16_t* almanac_age )
 {
+    if( ( this->is_almanac_index_valid == true ) || ( this->SeedAlmanacIndex( ) == true ) )
+    {
+        if( sv_id < GNSS_HELPER_NUMBER_SATELLITES_ALMANAC_READ )
+        {
+            ( *almanac_age ) = this->almanac_index.ages_per_almanacs[sv_id].almanac_age;
+            return;
+        }
+    }
+
     lr1110_gnss_get_almanac_age_for_satellite( this->radio, sv_id, almanac_age );
 }
 
+bool DeviceTransceiver::GetOldestAlmanacAge( uint16_t* oldest_almanac_age )
+{
+    if( ( this->is_almanac_index_valid == false ) && ( this->SeedAlmanacIndex( ) == false ) )
+    {
+        return false;
+    }
+
+    ( *oldest_almanac_age ) = this->oldest_almanac_age;
+    return true;
+}
+
 void DeviceTransceiver::UpdateAlmanac( const uint8_t* almanac_buffer, const uint8_t buffer_size )
 {
     if( buffer_size == LR1110_GNSS_SINGLE_ALMANAC_WRITE_SIZE )
     {
-        lr1110_gnss_almanac_update( this->radio, almanac_buffer, 1 );
+        const lr1110_status_t status = lr1110_gnss_almanac_update( this->radio, almanac_buffer, 1 );
+        const uint8_t         sv_id  = almanac_buffer[0];
+
+        this->is_almanac_crc_valid = false;
+        if( status != LR1110_STATUS_OK )
+        {
+            this->is_almanac_index_valid = false;
+            if( sv_id < GNSS_HELPER_NUMBER_SATELLITES_ALMANAC_READ )
+            {
+                this->almanac_block_crcs[sv_id] = 0;
+            }
+        }
+        else
+        {
+            if( sv_id < GNSS_HELPER_NUMBER_SATELLITES_ALMANAC_READ )
+            {
+                this->almanac_block_crcs[sv_id] =
+                    DeviceTransceiver::ComputeAlmanacBlockCrc( almanac_buffer, buffer_size );
+            }
+            if( this->is_almanac_index_valid == true )
+            {
+                this->IndexAlmanacBlock( almanac_buffer );
+            }
+        }
+    }
+}
+
+uint32_t DeviceTransceiver::ReadAlmanacCrc( ) const
+{
+    lr1110_gnss_context_status_bytestream_t context_status_buffer;
+    lr1110_gnss_context_status_t            context_status = { };
+    lr1110_gnss_get_context_status( this->radio, context_status_buffer );
+    lr1110_gnss_parse_context_status_buffer( context_status_buffer, &context_status );
+    return context_status.global_almanac_crc;
+}
+
+bool DeviceTransceiver::SeedAlmanacIndex( )
+{
+    this->is_almanac_index_valid = false;
+
+    // Only the 2-byte date of each satellite is read, instead of the full almanac memory
+    for( uint8_t index_satellite = 0; index_satellite < GNSS_HELPER_NUMBER_SATELLITES_ALMANAC_READ; index_satellite++ )
+    {
+        GnssHelperAgeAlmanac_t* age_almanac = &this->almanac_index.ages_per_almanacs[index_satellite];
+
+        age_almanac->sv_id = index_satellite;
+        if( lr1110_gnss_get_almanac_age_for_satellite( this->radio, index_satellite, &age_almanac->almanac_age ) !=
+            LR1110_STATUS_OK )
+        {
+            return false;
+        }
+    }
+
+    this->RefreshOldestAlmanacAge( );
+    this->is_almanac_crc_valid   = false;
+    this->is_almanac_index_valid = true;
+
+    return true;
+}
+
+void DeviceTransceiver::IndexAlmanacBlock( const uint8_t* almanac_block )
+{
+    const uint8_t sv_id = almanac_block[0];
+
+    // The header block of an almanac update does not carry the age of a satellite
+    if( sv_id >= GNSS_HELPER_NUMBER_SATELLITES_ALMANAC_READ )
+    {
+        return;
+    }
+
+    const uint16_t new_age = ( ( uint16_t )( almanac_block[1] ) << 0 ) + ( ( uint16_t )( almanac_block[2] ) << 8 );
+    const uint16_t previous_age = this->almanac_index.ages_per_almanacs[sv_id].almanac_age;
+
+    this->almanac_index.ages_per_almanacs[sv_id].almanac_age = new_age;
+
+    if( new_age == previous_age )
+    {
+        return;
+    }
+
+    // A date of 0 means the satellite has no almanac, so it does not take part in the oldest age
+    if( ( new_age != 0 ) && ( ( this->n_satellites_with_oldest_age == 0 ) || ( new_age < this->oldest_almanac_age ) ) )
+    {
+        this->oldest_almanac_age           = new_age;
+        this->n_satellites_with_oldest_age = 1;
+    }
+    else if( ( new_age != 0 ) && ( new_age == this->oldest_almanac_age ) )
+    {
+        this->n_satellites_with_oldest_age++;
+    }
+    else if( ( previous_age != 0 ) && ( previous_age == this->oldest_almanac_age ) )
+    {
+        // Only scan the index again once the last satellite holding the oldest age has been updated
+        this->n_satellites_with_oldest_age--;
+        if( this->n_satellites_with_oldest_age == 0 )
+        {
+            this->RefreshOldestAlmanacAge( );
+        }
+    }
+}
+
+void DeviceTransceiver::RefreshOldestAlmanacAge( )
+{
+    this->oldest_almanac_age           = 0;
+    this->n_satellites_with_oldest_age = 0;
+
+    for( uint8_t index_satellite = 0; index_satellite < GNSS_HELPER_NUMBER_SATELLITES_ALMANAC_READ; index_satellite++ )
+    {
+        const uint16_t almanac_age = this->almanac_index.ages_per_almanacs[index_satellite].almanac_age;
+        if( almanac_age == 0 )
+        {
+            continue;
+        }
+
+        if( ( this->n_satellites_with_oldest_age == 0 ) || ( almanac_age < this->oldest_almanac_age ) )
+        {
+            this->oldest_almanac_age           = almanac_age;
+            this->n_satellites_with_oldest_age = 1;
+        }
+        else if( almanac_age == this->oldest_almanac_age )
+        {
+            this->n_satellites_with_oldest_age++;
+        }
     }
 }
 
@@ -158,11 +304,9 @@ bool DeviceTransceiver::checkAlmanacUpdate( uint32_t expected_crc )
         lr1110_gnss_read_results( this->radio, result_buffer, result_size );
         if( ( result_buffer[0] == 0 ) && ( result_buffer[1] == 0 ) )
         {
-            lr1110_gnss_context_status_bytestream_t context_status_buffer;
-            lr1110_gnss_context_status_t            context_status;
-            lr1110_gnss_get_context_status( this->radio, context_status_buffer );
-            lr1110_gnss_parse_context_status_buffer( context_status_buffer, &context_status );
-            update_success = ( expected_crc == context_status.global_almanac_crc );
+            this->almanac_index.crc_almanac = this->ReadAlmanacCrc( );
+            this->is_almanac_crc_valid      = true;
+            update_success                  = ( expected_crc == this->almanac_index.crc_almanac );
         }
         else
         {
@@ -173,9 +317,47 @@ bool DeviceTransceiver::checkAlmanacUpdate( uint32_t expected_crc )
     {
         update_success = false;
     }
+
+    if( update_success == false )
+    {
+        // The chip may have rejected some of the blocks indexed so far
+        this->is_almanac_index_valid = false;
+        memset( this->almanac_block_crcs, 0, sizeof( this->almanac_block_crcs ) );
+    }
     return update_success;
 }
 
+bool DeviceTransceiver::IsAlmanacDeltaUpdateSupported( ) const { return true; }
+
+bool DeviceTransceiver::GetAlmanacBlockCrc( const uint8_t sv_id, uint32_t* block_crc ) const
+{
+    if( sv_id >= GNSS_HELPER_NUMBER_SATELLITES_ALMANAC_READ )
+    {
+        ( *block_crc ) = 0;
+        return false;
+    }
+
+    ( *block_crc ) = this->almanac_block_crcs[sv_id];
+    return ( *block_crc ) != 0;
+}
+
+uint32_t DeviceTransceiver::ComputeAlmanacBlockCrc( const uint8_t* almanac_block, const uint8_t block_size )
+{
+    // Standard CRC32 (polynomial 0xEDB88320), the same as zlib.crc32 used by the host to compare blocks
+    uint32_t crc = 0xFFFFFFFF;
+
+    for( uint8_t index = 0; index < block_size; index++ )
+    {
+        crc ^= almanac_block[index];
+        for( uint8_t bit = 0; bit < 8; bit++ )
+        {
+            crc = ( crc & 1 ) ? ( ( crc >> 1 ) ^ 0xEDB88320 ) : ( crc >> 1 );
+        }
+    }
+
+    return ~crc;
+}
+
 void DeviceTransceiver::NotifyEnvironmentChange( )
 {
     // Intentionally does nothing
@@ -200,9 +382,11 @@ void DeviceTransceiver::FetchVersion( version_handler_t& version_handler )
     strcpy( version_handler.version_driver, lr1110_driver_version_get_version_string( ) );
 
     GnssHelperAlmanacDetails_t almanac_ages_crc = { 0 };
-    this->GetAlmanacAgesAndCrcOfAllSatellites( &almanac_ages_crc );
-    version_handler.almanac_date = almanac_ages_crc.ages_per_almanacs[0].almanac_age;
-    version_handler.almanac_crc  = almanac_ages_crc.crc_almanac;
+    if( this->GetAlmanacAgesAndCrcOfAllSatellites( &almanac_ages_crc ) == true )
+    {
+        version_handler.almanac_date = almanac_ages_crc.ages_per_almanacs[0].almanac_age;
+        version_handler.almanac_crc  = almanac_ages_crc.crc_almanac;
+    }
 }
 
 void DeviceTransceiver::FetchAssistanceLocation( DeviceAssistedLocation_t* assistance_location )
@@ -40,6 +40,7 @@ void display_init( void );
 
 void display_send_command( const uint8_t command );
 void display_send_data( const uint16_t data );
+void display_send_data_block( const uint16_t* data, uint32_t length );
 
 #ifdef __cplusplus
 }
@@ -41,12 +41,25 @@ extern "C" {
 
 void touch_init( void );
 
+/*!
+ * @brief Record an edge of the touch interrupt line, to be called from its EXTI handler
+ */
+void touch_interrupt_handler( void );
+
+/*!
+ * @brief Return true, and clear it, if the touch interrupt line changed since the last call
+ */
+bool touch_has_pending_interrupt( void );
+
 uint8_t touch_read_register( uint8_t reg );
 
 void touch_write_register( uint8_t reg, uint8_t val );
 
 bool touch_is_touched( void );
 
+/*!
+ * @brief Read the touch status and the coordinates of the first touch point in a single I2C transfer
+ */
 void readTouchData( uint16_t* posX, uint16_t* posY, bool* touching );
 
 long map( long x, long in_min, long in_max, long out_min, long out_max );
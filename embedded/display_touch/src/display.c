@@ -46,13 +46,13 @@ void display_send_data_8bit( const uint8_t data ) { system_spi_write( SPI1, &dat
 
 void display_send_data( const uint16_t data )
 {
-    uint8_t dh = data >> 8;
-    uint8_t dl = data & 0xff;
+    uint8_t buf[2] = { data >> 8, data & 0xff };
 
-    system_spi_write( SPI1, &dh, 1 );
-    system_spi_write( SPI1, &dl, 1 );
+    system_spi_write( SPI1, buf, 2 );
 }
 
+void display_send_data_block( const uint16_t* data, uint32_t length ) { system_spi_write_16bit( SPI1, data, length ); }
+
 void display_init( void )
 {
     LL_GPIO_ResetOutputPin( DISPLAY_NSS_PORT, DISPLAY_NSS_PIN );
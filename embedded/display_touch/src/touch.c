@@ -37,6 +37,10 @@
 #define FT6x06_DEV_MODE 0x00
 #define FT6x06_GEST_ID 0x01
 #define FT6x06_TD_STATUS 0x02
+#define FT6x06_P1_XH 0x03
+#define FT6x06_P1_XL 0x04
+#define FT6x06_P1_YH 0x05
+#define FT6x06_P1_YL 0x06
 #define FT6x06_TH_GROUP 0x80
 #define FT6x06_PERIODACTIVE 0x88
 #define FT6x06_CHIPER 0xA3
@@ -45,8 +49,30 @@
 #define FT6x06_FOCALTECH_ID 0xA8
 #define FT6x06_RELEASE_CODE_ID 0xAF
 
+// Registers from TD_STATUS to P1_YL, read in a single transfer
+#define FT6x06_TOUCH_DATA_LENGTH ( FT6x06_P1_YL - FT6x06_TD_STATUS + 1 )
+
+// Set at startup so that the first read gets the initial state of the touch panel
+static volatile bool touch_interrupt_pending = true;
+
+static bool touch_is_status_touched( uint8_t td_status );
+
 void touch_init( void ) { touch_write_register( FT6x06_G_MODE, 0x00 ); }
 
+void touch_interrupt_handler( void ) { touch_interrupt_pending = true; }
+
+bool touch_has_pending_interrupt( void )
+{
+    if( touch_interrupt_pending == false )
+    {
+        return false;
+    }
+
+    // Cleared before the caller reads the touch data, so that an edge raised during the read is not lost
+    touch_interrupt_pending = false;
+    return true;
+}
+
 uint8_t touch_read_register( uint8_t reg )
 {
     uint8_t buf[1] = { reg };
@@ -65,36 +91,30 @@ void touch_write_register( uint8_t reg, uint8_t val )
     system_i2c_write( FT6x06_ADDR, buf, 2, false );
 }
 
-bool touch_is_touched( )
-{
-    bool    status = false;
-    uint8_t val;
-
-    val = touch_read_register( FT6x06_TD_STATUS );
-    if( ( val == 1 ) || ( val == 2 ) )
-    {
-        status = true;
-    }
-
-    return status;
-}
+bool touch_is_touched( ) { return touch_is_status_touched( touch_read_register( FT6x06_TD_STATUS ) ); }
 
 void readTouchData( uint16_t* posX, uint16_t* posY, bool* touching )
 {
-    posX[0] = touch_read_register( 0x03 ) & 0x0F;
-    posX[0] <<= 8;
-    posX[0] |= touch_read_register( 0x04 );
-    posY[0] = touch_read_register( 0x05 ) & 0x0F;
-    posY[0] <<= 8;
-    posY[0] |= touch_read_register( 0x06 );
+    uint8_t buf[1]                         = { FT6x06_TD_STATUS };
+    uint8_t data[FT6x06_TOUCH_DATA_LENGTH] = { 0 };
+
+    system_i2c_write( FT6x06_ADDR, buf, 1, true );
+    system_i2c_read( FT6x06_ADDR, data, FT6x06_TOUCH_DATA_LENGTH, false );
+
+    posX[0] = ( ( uint16_t )( data[FT6x06_P1_XH - FT6x06_TD_STATUS] & 0x0F ) << 8 ) |
+              data[FT6x06_P1_XL - FT6x06_TD_STATUS];
+    posY[0] = ( ( uint16_t )( data[FT6x06_P1_YH - FT6x06_TD_STATUS] & 0x0F ) << 8 ) |
+              data[FT6x06_P1_YL - FT6x06_TD_STATUS];
 
     posX[0] = map( posX[0], 0, 240, 240, 0 );
     posY[0] = map( posY[0], 0, 320, 320, 0 );
 
-    touching[0] = touch_is_touched( );
+    touching[0] = touch_is_status_touched( data[0] );
 }
 
 long map( long x, long in_min, long in_max, long out_min, long out_max )
 {
     return ( x - in_min ) * ( out_max - out_min ) / ( in_max - in_min ) + out_min;
 }
+
+static bool touch_is_status_touched( uint8_t td_status ) { return ( td_status == 1 ) || ( td_status == 2 ); }
@@ -0,0 +1,493 @@
+/**
+ * @file      gui_bench.cpp
+ *
+ * @brief     Host benchmark rendering every GUI page with synthetic results.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "gui.h"
+#include "lvgl.h"
+#include "lv_port_img_rle.h"
+#include "lv_port_disp_headless.h"
+#include "system_time.h"
+
+#define GUI_BENCH_DEFAULT_ITERATIONS ( 20 )
+#define GUI_BENCH_PATH_LENGTH ( 256 )
+
+typedef struct
+{
+    const char* name;
+    GuiCommon* ( *create )( void );
+    void ( *update )( void );
+} gui_bench_page_t;
+
+typedef struct
+{
+    uint64_t build_us;
+    uint64_t render_us;
+    uint64_t refresh_us;
+    uint32_t render_px;
+    uint32_t refresh_px;
+    uint32_t heap_used_max;
+} gui_bench_measure_t;
+
+static version_handler_t                gui_bench_version;
+static GuiDemoSettings_t                gui_bench_settings;
+static GuiDemoSettings_t                gui_bench_settings_default;
+static GuiDemoResult_t                  gui_bench_results;
+static GuiNetworkConnectivitySettings_t gui_bench_connectivity_settings;
+static GuiGnssDemoAssistancePosition_t  gui_bench_assistance_position;
+static GuiGnssDemoAssistancePosition_t  gui_bench_assistance_position_default;
+
+// LVGL v6 does not track the heap high-water mark, so the used size is sampled after each step of the benchmark
+static uint32_t gui_bench_heap_used_max;
+
+uint32_t system_time_GetTicker( void )
+{
+    struct timespec now;
+    clock_gettime( CLOCK_MONOTONIC, &now );
+    return ( uint32_t )( ( now.tv_sec * 1000 ) + ( now.tv_nsec / 1000000 ) );
+}
+
+static uint64_t gui_bench_get_time_us( void )
+{
+    struct timespec now;
+    clock_gettime( CLOCK_MONOTONIC, &now );
+    return ( ( uint64_t ) now.tv_sec * 1000000 ) + ( now.tv_nsec / 1000 );
+}
+
+static void gui_bench_sample_heap( void )
+{
+    lv_mem_monitor_t monitor;
+    lv_mem_monitor( &monitor );
+
+    const uint32_t used = monitor.total_size - monitor.free_size;
+    if( used > gui_bench_heap_used_max )
+    {
+        gui_bench_heap_used_max = used;
+    }
+}
+
+static uint32_t gui_bench_render( uint64_t* duration_us )
+{
+    lv_port_disp_headless_stats_t stats;
+
+    lv_port_disp_headless_reset_stats( );
+    const uint64_t start_us = gui_bench_get_time_us( );
+    lv_refr_now( NULL );
+    *duration_us += gui_bench_get_time_us( ) - start_us;
+    lv_port_disp_headless_get_stats( &stats );
+
+    gui_bench_sample_heap( );
+
+    return stats.nb_flushed_pixels;
+}
+
+static void gui_bench_init_data( void )
+{
+    gui_bench_version.device_type = VERSION_DEVICE_TRANSCEIVER;
+    strncpy( gui_bench_version.version_sw, "1.0.0", VERSION_STRING_LENGTH );
+    strncpy( gui_bench_version.version_driver, "v5.0.1", VERSION_STRING_LENGTH );
+    for( uint8_t i = 0; i < EUI_LENGTH; i++ )
+    {
+        gui_bench_version.chip_uid[i] = 0x10 + i;
+        gui_bench_version.dev_eui[i]  = 0x20 + i;
+        gui_bench_version.join_eui[i] = 0x30 + i;
+    }
+    gui_bench_version.almanac_date                  = 1234;
+    gui_bench_version.almanac_crc                   = 0x12345678;
+    gui_bench_version.transceiver.version_chip_type = 0x01;
+    gui_bench_version.transceiver.version_chip_hw   = 0x22;
+    gui_bench_version.transceiver.version_chip_fw   = 0x0307;
+
+    GuiRadioSetting_t* radio     = &gui_bench_settings.radio_settings;
+    radio->rf_freq_in_hz         = 868100000;
+    radio->pwr_in_dbm            = 14;
+    radio->nb_of_packets         = 100;
+    radio->payload_length        = 16;
+    radio->rx_sampling_period_ms = 1000;
+    radio->is_hp_pa_enabled      = false;
+    radio->is_lora               = true;
+    radio->lora.sf               = 7;
+    radio->lora.bw               = 125;
+    radio->lora.cr               = 1;
+    radio->lora.is_crc_activated = true;
+    radio->gfsk.br_in_bps        = 50000;
+    radio->gfsk.fdev_in_hz       = 25000;
+    radio->refresh_rate          = GUI_REFRESH_RATE_DEFAULT;
+
+    gui_bench_settings.wifi_settings.channel_mask = 0x3FFF;
+    gui_bench_settings.wifi_settings.is_type_b    = true;
+    gui_bench_settings.wifi_settings.is_type_g    = true;
+
+    gui_bench_settings.gnss_autonomous_settings.is_gps_enabled    = true;
+    gui_bench_settings.gnss_autonomous_settings.is_beidou_enabled = true;
+    gui_bench_settings.gnss_assisted_settings                     = gui_bench_settings.gnss_autonomous_settings;
+    gui_bench_settings_default                                    = gui_bench_settings;
+
+    gui_bench_assistance_position.latitude  = 45.181f;
+    gui_bench_assistance_position.longitude = 5.720f;
+    gui_bench_assistance_position_default   = gui_bench_assistance_position;
+
+    GuiWifiResult_t* wifi = &gui_bench_results.wifi_result;
+    wifi->status          = GUI_DEMO_STATUS_OK;
+    for( uint8_t channel = 0; channel < 6; channel++ )
+    {
+        GuiWifiResultChannel_t* result_channel = &wifi->typeB.channel[channel * 2];
+        for( uint8_t i = 0; i < GUI_MAX_WIFI_MAC_ADDRESSES; i++ )
+        {
+            snprintf( result_channel->data[i].macAddr, GUI_WIFI_STRING_LENGTH, "AA:BB:CC:%02X:%02X:%02X", channel,
+                      i, channel * i );
+            strncpy( result_channel->data[i].countryCode, "FR", GUI_WIFI_STRING_COUNTRY_CODE_LENGTH );
+            result_channel->data[i].rssi = -40 - ( channel * 5 ) - i;
+        }
+        result_channel->nbMacAddr = GUI_MAX_WIFI_MAC_ADDRESSES;
+        wifi->nbMacAddrTotal += GUI_MAX_WIFI_MAC_ADDRESSES;
+    }
+    wifi->powerConsTotal = 12000;
+    wifi->timingTotal    = 1500;
+    strncpy( wifi->reverse_geo_loc.city, "Meylan", GUI_RESULT_GEO_LOC_CITY_LENGTH );
+    strncpy( wifi->reverse_geo_loc.country, "France", GUI_RESULT_GEO_LOC_COUNTRY_LENGTH );
+
+    GuiGnssResult_t* gnss = &gui_bench_results.gnss_result;
+    gnss->status          = GUI_DEMO_STATUS_OK;
+    gnss->nb_satellites   = 12;
+    for( uint8_t i = 0; i < gnss->nb_satellites; i++ )
+    {
+        gnss->satellite_ids[i].satellite_id  = i * 3;
+        gnss->satellite_ids[i].snr           = 30 + i;
+        gnss->satellite_ids[i].constellation = ( ( i % 2 ) == 0 ) ? GUI_GNSS_CONSTELLATION_GPS
+                                                                  : GUI_GNSS_CONSTELLATION_BEIDOU;
+    }
+    gnss->powerConsTotal = 8000;
+    gnss->timingTotal    = 2500;
+
+    GuiSpectrumSweepResult_t* sweep = &gui_bench_results.spectrum_sweep_result;
+    sweep->start_frequency_hz       = 863000000;
+    sweep->step_frequency_hz        = 100000;
+    sweep->nb_channels              = GUI_SPECTRUM_SWEEP_MAX_CHANNELS;
+    for( uint8_t i = 0; i < sweep->nb_channels; i++ )
+    {
+        sweep->rssi_min[i]  = -120 + ( i % 8 );
+        sweep->rssi_mean[i] = -100 + ( i % 16 );
+        sweep->rssi_max[i]  = -80 + ( i % 24 );
+    }
+
+    gui_bench_results.temperature_result.temperature = 24.5f;
+}
+
+static void gui_bench_update_per( void )
+{
+    gui_bench_results.radio_per_result.count_rx_correct_packet++;
+    gui_bench_results.radio_per_result.rx_rate_instant_pps = 4.2f;
+}
+
+static void gui_bench_update_ping_pong( void )
+{
+    gui_bench_results.radio_pingpong_result.count_tx++;
+    gui_bench_results.radio_pingpong_result.count_rx_correct_packet++;
+}
+
+static void gui_bench_update_spectrum_sweep( void )
+{
+    GuiSpectrumSweepResult_t* sweep = &gui_bench_results.spectrum_sweep_result;
+
+    sweep->nb_sweeps++;
+    for( uint8_t i = 0; i < sweep->nb_channels; i++ )
+    {
+        sweep->rssi_mean[i] = -100 + ( ( i + sweep->nb_sweeps ) % 16 );
+    }
+}
+
+static void gui_bench_update_wifi( void )
+{
+    gui_bench_results.wifi_result.typeB.channel[0].data[0].rssi--;
+    gui_bench_results.wifi_result.timingTotal++;
+}
+
+static void gui_bench_update_gnss( void )
+{
+    gui_bench_results.gnss_result.satellite_ids[0].snr++;
+    gui_bench_results.gnss_result.timingTotal++;
+}
+
+static void gui_bench_update_temperature( void ) { gui_bench_results.temperature_result.temperature += 0.5f; }
+
+static void gui_bench_update_file_upload( void )
+{
+    gui_bench_results.file_upload_result.terminated = true;
+    gui_bench_results.file_upload_result.success    = true;
+}
+
+static GuiCommon* gui_bench_create_splash_screen( void ) { return new GuiSplashScreen( &gui_bench_version ); }
+static GuiCommon* gui_bench_create_about( void ) { return new GuiAbout( &gui_bench_version ); }
+static GuiCommon* gui_bench_create_eui( void ) { return new GuiEui( &gui_bench_version ); }
+static GuiCommon* gui_bench_create_menu( void ) { return new GuiMenu( &gui_bench_version ); }
+static GuiCommon* gui_bench_create_menu_demo( void ) { return new GuiMenuDemo( &gui_bench_version ); }
+static GuiCommon* gui_bench_create_menu_geoloc_demo( void ) { return new GuiMenuGeolocDemo( &gui_bench_version ); }
+static GuiCommon* gui_bench_create_menu_radio_demo( void ) { return new GuiMenuRadioDemo( &gui_bench_version ); }
+
+static GuiCommon* gui_bench_create_menu_radio_test_modes( void )
+{
+    return new GuiMenuRadioTestModes( &gui_bench_version );
+}
+
+static GuiCommon* gui_bench_create_connectivity( void )
+{
+    return new GuiConnectivity( &gui_bench_connectivity_settings );
+}
+
+static GuiCommon* gui_bench_create_config_radio_test_modes( void )
+{
+    return new GuiConfigRadioTestModes( &gui_bench_settings.radio_settings, &gui_bench_settings_default.radio_settings,
+                                        &gui_bench_version );
+}
+
+static GuiCommon* gui_bench_create_radio_tx_cw( void )
+{
+    return new GuiRadioTxCw( &gui_bench_settings.radio_settings );
+}
+
+static GuiCommon* gui_bench_create_radio_per( void )
+{
+    return new GuiRadioPer( &gui_bench_settings.radio_settings, &gui_bench_results.radio_per_result );
+}
+
+static GuiCommon* gui_bench_create_radio_ping_pong( void )
+{
+    return new GuiRadioPingPong( &gui_bench_settings.radio_settings, &gui_bench_results.radio_pingpong_result );
+}
+
+static GuiCommon* gui_bench_create_radio_spectrum_sweep( void )
+{
+    return new GuiRadioSpectrumSweep( &gui_bench_results.spectrum_sweep_result );
+}
+
+static GuiCommon* gui_bench_create_wifi_test( void ) { return new GuiTestWifi( &gui_bench_results.wifi_result, true ); }
+static GuiCommon* gui_bench_create_wifi_results( void ) { return new GuiResultsWifi( &gui_bench_results.wifi_result ); }
+
+static GuiCommon* gui_bench_create_wifi_config( void )
+{
+    return new GuiConfigWifi( &gui_bench_settings.wifi_settings, &gui_bench_settings_default.wifi_settings );
+}
+
+static GuiCommon* gui_bench_create_gnss_test( void )
+{
+    return new GuiTestGnss( &gui_bench_results.gnss_result, GUI_PAGE_GNSS_AUTONOMOUS_TEST, true );
+}
+
+static GuiCommon* gui_bench_create_gnss_results( void )
+{
+    return new GuiResultsGnss( &gui_bench_results.gnss_result, GUI_PAGE_GNSS_AUTONOMOUS_RESULTS );
+}
+
+static GuiCommon* gui_bench_create_gnss_config( void )
+{
+    return new GuiConfigGnss( GUI_PAGE_GNSS_AUTONOMOUS_CONFIG, &gui_bench_settings.gnss_autonomous_settings,
+                              &gui_bench_settings_default.gnss_autonomous_settings, &gui_bench_version );
+}
+
+static GuiCommon* gui_bench_create_gnss_assistance_position_config( void )
+{
+    return new GuiConfigGnssAssistancePosition( &gui_bench_assistance_position,
+                                                &gui_bench_assistance_position_default );
+}
+
+static GuiCommon* gui_bench_create_temperature( void )
+{
+    return new GuiTemperature( &gui_bench_results.temperature_result );
+}
+
+static GuiCommon* gui_bench_create_file_upload( void )
+{
+    return new GuiFileUpload( &gui_bench_results.file_upload_result );
+}
+
+static const gui_bench_page_t gui_bench_pages[] = {
+    { "splash_screen", gui_bench_create_splash_screen, NULL },
+    { "about", gui_bench_create_about, NULL },
+    { "eui", gui_bench_create_eui, NULL },
+    { "menu", gui_bench_create_menu, NULL },
+    { "connectivity", gui_bench_create_connectivity, NULL },
+    { "menu_radio_test_modes", gui_bench_create_menu_radio_test_modes, NULL },
+    { "config_radio_test_modes", gui_bench_create_config_radio_test_modes, NULL },
+    { "radio_tx_cw", gui_bench_create_radio_tx_cw, NULL },
+    { "radio_per", gui_bench_create_radio_per, gui_bench_update_per },
+    { "radio_ping_pong", gui_bench_create_radio_ping_pong, gui_bench_update_ping_pong },
+    { "radio_spectrum_sweep", gui_bench_create_radio_spectrum_sweep, gui_bench_update_spectrum_sweep },
+    { "menu_demo", gui_bench_create_menu_demo, NULL },
+    { "menu_geoloc_demo", gui_bench_create_menu_geoloc_demo, NULL },
+    { "menu_radio_demo", gui_bench_create_menu_radio_demo, NULL },
+    { "wifi_test", gui_bench_create_wifi_test, gui_bench_update_wifi },
+    { "wifi_results", gui_bench_create_wifi_results, NULL },
+    { "wifi_config", gui_bench_create_wifi_config, NULL },
+    { "gnss_test", gui_bench_create_gnss_test, gui_bench_update_gnss },
+    { "gnss_results", gui_bench_create_gnss_results, NULL },
+    { "gnss_config", gui_bench_create_gnss_config, NULL },
+    { "gnss_assistance_position_config", gui_bench_create_gnss_assistance_position_config, NULL },
+    { "temperature", gui_bench_create_temperature, gui_bench_update_temperature },
+    { "file_upload", gui_bench_create_file_upload, gui_bench_update_file_upload },
+};
+
+static bool gui_bench_save_ppm( const char* directory, const char* name )
+{
+    char path[GUI_BENCH_PATH_LENGTH];
+    snprintf( path, GUI_BENCH_PATH_LENGTH, "%s/%s.ppm", directory, name );
+
+    FILE* file = fopen( path, "wb" );
+    if( file == NULL )
+    {
+        return false;
+    }
+
+    const lv_color_t* framebuffer = lv_port_disp_headless_get_framebuffer( );
+    fprintf( file, "P6\n%d %d\n255\n", LV_PORT_DISP_HEADLESS_HOR_RES, LV_PORT_DISP_HEADLESS_VER_RES );
+    for( uint32_t i = 0; i < ( LV_PORT_DISP_HEADLESS_HOR_RES * LV_PORT_DISP_HEADLESS_VER_RES ); i++ )
+    {
+        lv_color32_t color;
+        color.full = lv_color_to32( framebuffer[i] );
+
+        const uint8_t rgb[3] = { color.ch.red, color.ch.green, color.ch.blue };
+        fwrite( rgb, 1, sizeof( rgb ), file );
+    }
+    fclose( file );
+
+    return true;
+}
+
+static void gui_bench_run_page( const gui_bench_page_t* page, uint32_t iterations, const char* snapshot_directory,
+                                gui_bench_measure_t* measure )
+{
+    memset( measure, 0, sizeof( gui_bench_measure_t ) );
+    gui_bench_heap_used_max = 0;
+
+    for( uint32_t iteration = 0; iteration < iterations; iteration++ )
+    {
+        const uint64_t start_us = gui_bench_get_time_us( );
+        GuiCommon*     gui_page = page->create( );
+        measure->build_us += gui_bench_get_time_us( ) - start_us;
+        gui_bench_sample_heap( );
+
+        measure->render_px = gui_bench_render( &( measure->render_us ) );
+
+        if( ( snapshot_directory != NULL ) && ( iteration == 0 ) &&
+            ( gui_bench_save_ppm( snapshot_directory, page->name ) == false ) )
+        {
+            fprintf( stderr, "Cannot write the snapshot of %s in %s\n", page->name, snapshot_directory );
+        }
+
+        if( page->update != NULL )
+        {
+            const uint64_t refresh_start_us = gui_bench_get_time_us( );
+            page->update( );
+            gui_page->refresh( );
+            measure->refresh_us += gui_bench_get_time_us( ) - refresh_start_us;
+
+            measure->refresh_px = gui_bench_render( &( measure->refresh_us ) );
+        }
+
+        delete gui_page;
+    }
+
+    measure->build_us /= iterations;
+    measure->render_us /= iterations;
+    measure->refresh_us /= iterations;
+    measure->heap_used_max = gui_bench_heap_used_max;
+}
+
+static void gui_bench_usage( const char* program )
+{
+    printf( "Usage: %s [-n iterations] [-s snapshot_directory]\n", program );
+    printf( "  -n  number of times each page is built, rendered and refreshed (default %d)\n",
+            GUI_BENCH_DEFAULT_ITERATIONS );
+    printf( "  -s  write the first render of each page as <page>.ppm in the directory\n" );
+}
+
+int main( int argc, char** argv )
+{
+    uint32_t    iterations         = GUI_BENCH_DEFAULT_ITERATIONS;
+    const char* snapshot_directory = NULL;
+    int         option;
+
+    while( ( option = getopt( argc, argv, "n:s:h" ) ) != -1 )
+    {
+        switch( option )
+        {
+        case 'n':
+            iterations = strtoul( optarg, NULL, 10 );
+            break;
+        case 's':
+            snapshot_directory = optarg;
+            break;
+        default:
+            gui_bench_usage( argv[0] );
+            return ( option == 'h' ) ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+    if( iterations == 0 )
+    {
+        gui_bench_usage( argv[0] );
+        return EXIT_FAILURE;
+    }
+
+    lv_init( );
+    lv_port_img_rle_init( );
+    lv_port_disp_headless_init( );
+
+    gui_bench_init_data( );
+
+    printf( "%-32s %10s %10s %10s %10s %10s %10s\n", "page", "build_us", "render_us", "render_px", "refresh_us",
+            "refresh_px", "heap_max" );
+
+    for( uint32_t i = 0; i < ( sizeof( gui_bench_pages ) / sizeof( gui_bench_pages[0] ) ); i++ )
+    {
+        gui_bench_measure_t measure;
+
+        gui_bench_run_page( &gui_bench_pages[i], iterations, snapshot_directory, &measure );
+
+        printf( "%-32s %10llu %10llu %10u ", gui_bench_pages[i].name, ( unsigned long long ) measure.build_us,
+                ( unsigned long long ) measure.render_us, measure.render_px );
+        if( gui_bench_pages[i].update != NULL )
+        {
+            printf( "%10llu %10u ", ( unsigned long long ) measure.refresh_us, measure.refresh_px );
+        }
+        else
+        {
+            printf( "%10s %10s ", "-", "-" );
+        }
+        printf( "%10u\n", measure.heap_used_max );
+    }
+
+    printf( "LVGL heap: %u bytes\n", LV_MEM_SIZE );
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,83 @@
+/**
+ * @file      lv_port_disp_headless.c
+ *
+ * @brief     LVGL display driver rendering into an in-memory framebuffer.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+#include "lv_port_disp_headless.h"
+
+#define LV_PORT_DISP_HEADLESS_BUFFER_ROWS ( 10 )
+
+static void lv_port_disp_headless_flush( lv_disp_drv_t* disp_drv, const lv_area_t* area, lv_color_t* color_p );
+
+static lv_color_t lv_port_disp_headless_framebuffer[LV_PORT_DISP_HEADLESS_HOR_RES * LV_PORT_DISP_HEADLESS_VER_RES];
+static lv_port_disp_headless_stats_t lv_port_disp_headless_stats;
+
+void lv_port_disp_headless_init( void )
+{
+    static lv_disp_buf_t disp_buf;
+    static lv_color_t    buf[LV_HOR_RES_MAX * LV_PORT_DISP_HEADLESS_BUFFER_ROWS];
+    lv_disp_buf_init( &disp_buf, buf, NULL, LV_HOR_RES_MAX * LV_PORT_DISP_HEADLESS_BUFFER_ROWS );
+
+    lv_disp_drv_t disp_drv;
+    lv_disp_drv_init( &disp_drv );
+    disp_drv.hor_res  = LV_PORT_DISP_HEADLESS_HOR_RES;
+    disp_drv.ver_res  = LV_PORT_DISP_HEADLESS_VER_RES;
+    disp_drv.flush_cb = lv_port_disp_headless_flush;
+    disp_drv.buffer   = &disp_buf;
+    lv_disp_drv_register( &disp_drv );
+
+    lv_port_disp_headless_reset_stats( );
+}
+
+const lv_color_t* lv_port_disp_headless_get_framebuffer( void ) { return lv_port_disp_headless_framebuffer; }
+
+void lv_port_disp_headless_get_stats( lv_port_disp_headless_stats_t* stats ) { *stats = lv_port_disp_headless_stats; }
+
+void lv_port_disp_headless_reset_stats( void )
+{
+    memset( &lv_port_disp_headless_stats, 0, sizeof( lv_port_disp_headless_stats ) );
+}
+
+static void lv_port_disp_headless_flush( lv_disp_drv_t* disp_drv, const lv_area_t* area, lv_color_t* color_p )
+{
+    const uint32_t width = lv_area_get_width( area );
+
+    for( int32_t y = area->y1; y <= area->y2; y++ )
+    {
+        memcpy( &lv_port_disp_headless_framebuffer[y * LV_PORT_DISP_HEADLESS_HOR_RES + area->x1], color_p,
+                width * sizeof( lv_color_t ) );
+        color_p += width;
+    }
+
+    lv_port_disp_headless_stats.nb_flushes++;
+    lv_port_disp_headless_stats.nb_flushed_pixels += lv_area_get_size( area );
+
+    lv_disp_flush_ready( disp_drv );
+}
@@ -0,0 +1,75 @@
+/**
+ * @file      lv_port_disp_headless.h
+ *
+ * @brief     Definition of the LVGL display driver rendering into an in-memory framebuffer.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __LV_PORT_DISP_HEADLESS_H__
+#define __LV_PORT_DISP_HEADLESS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "lvgl.h"
+
+#define LV_PORT_DISP_HEADLESS_HOR_RES ( 240 )
+#define LV_PORT_DISP_HEADLESS_VER_RES ( 320 )
+
+typedef struct
+{
+    uint32_t nb_flushes;
+    uint32_t nb_flushed_pixels;
+} lv_port_disp_headless_stats_t;
+
+/*!
+ * @brief Register a display of the size of the EVK screen that draws into an in-memory framebuffer
+ *
+ * The draw buffer has the same size as the one of lv_port_disp.c, so that LVGL splits the invalidated areas the same
+ * way as on the target.
+ */
+void lv_port_disp_headless_init( void );
+
+/*!
+ * @brief Get the framebuffer, LV_PORT_DISP_HEADLESS_HOR_RES x LV_PORT_DISP_HEADLESS_VER_RES pixels row by row
+ */
+const lv_color_t* lv_port_disp_headless_get_framebuffer( void );
+
+/*!
+ * @brief Get the number of flushes and flushed pixels since the last reset
+ */
+void lv_port_disp_headless_get_stats( lv_port_disp_headless_stats_t* stats );
+
+void lv_port_disp_headless_reset_stats( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // __LV_PORT_DISP_HEADLESS_H__
@@ -41,6 +41,7 @@
 #include "guiRadioTxCw.h"
 #include "guiRadioPer.h"
 #include "guiRadioPingPong.h"
+#include "guiRadioSpectrumSweep.h"
 #include "guiMenuDemo.h"
 #include "guiMenuGeolocDemo.h"
 #include "guiMenuRadioDemo.h"
@@ -68,6 +69,7 @@ typedef enum
     GUI_LAST_EVENT_START_DEMO_PER_TX,
     GUI_LAST_EVENT_START_DEMO_PER_RX,
     GUI_LAST_EVENT_START_DEMO_PING_PONG,
+    GUI_LAST_EVENT_START_DEMO_SPECTRUM_SWEEP,
     GUI_LAST_EVENT_START_DEMO_WIFI,
     GUI_LAST_EVENT_START_DEMO_GNSS_AUTONOMOUS,
     GUI_LAST_EVENT_START_DEMO_GNSS_ASSISTED,
@@ -86,6 +88,51 @@ typedef enum
     GUI_LAST_EVENT_RESET_SEMTECH_DEFAULT_COMMISSIONING,
 } GuiLastEvent_t;
 
+/*!
+ * @brief Union of the pages constructed on each navigation, only used to size and align their shared storage
+ */
+typedef union
+{
+    GuiSplashScreen                 splash_screen;
+    GuiAbout                        about;
+    GuiConnectivity                 connectivity;
+    GuiEui                          eui;
+    GuiConfigRadioTestModes         config_radio_test_modes;
+    GuiRadioTxCw                    radio_tx_cw;
+    GuiRadioPer                     radio_per;
+    GuiRadioPingPong                radio_ping_pong;
+    GuiRadioSpectrumSweep           radio_spectrum_sweep;
+    GuiTestWifi                     test_wifi;
+    GuiConfigWifi                   config_wifi;
+    GuiResultsWifi                  results_wifi;
+    GuiTestGnss                     test_gnss;
+    GuiConfigGnss                   config_gnss;
+    GuiResultsGnss                  results_gnss;
+    GuiConfigGnssAssistancePosition config_gnss_assistance_position;
+    GuiTemperature                  temperature;
+    GuiFileUpload                   file_upload;
+} GuiPageStorage_t;
+
+/*!
+ * @brief Union of the menu pages, which are built once and kept alive with their LVGL screen
+ */
+typedef union
+{
+    GuiMenu               menu;
+    GuiMenuDemo           menu_demo;
+    GuiMenuGeolocDemo     menu_geoloc_demo;
+    GuiMenuRadioDemo      menu_radio_demo;
+    GuiMenuRadioTestModes menu_radio_test_modes;
+} GuiCachedPageStorage_t;
+
+#define GUI_NB_CACHED_PAGES ( 5 )
+
+typedef struct
+{
+    GuiCommon* page;
+    alignas( GuiCachedPageStorage_t ) uint8_t storage[sizeof( GuiCachedPageStorage_t )];
+} GuiCachedPage_t;
+
 class Gui
 {
    public:
@@ -119,6 +166,7 @@ class Gui
     virtual GuiLastEvent_t GetLastEvent( );
     void                   UpdateRadioPingPongResult( GuiRadioPingPongResult_t& gui_demo_result );
     void                   UpdateRadioPerResult( GuiRadioPerResult_t& demo_result );
+    void                   UpdateSpectrumSweepResult( GuiSpectrumSweepResult_t& demo_result );
     void                   UpdateWifiDemoResult( GuiWifiResult_t& gui_demo_result );
     void                   UpdateGnssDemoResult( GuiGnssResult_t& gui_demo_result );
     void                   UpdateTemperatureResult( GuiTemperatureResult_t& gui_demo_result );
@@ -126,6 +174,8 @@ class Gui
     void                   UpdateReverseGeoCoding( const GuiResultGeoLoc_t& new_reverse_geo_coding );
     void                   SetDemoStatus( GuiDemoStatus_t& demo_status );
     bool                   HasRefreshPending( ) const;
+    bool                   GetRefreshDelay( uint32_t* delay_ms ) const;
+    bool                   IsIdle( ) const;
 
     static const char* event2str( GuiLastEvent_t event )
     {
@@ -156,13 +206,23 @@ class Gui
 
    private:
     void                 CreateNewPage( guiPageType_t page_type );
+    void                 ReleaseCurrentPage( );
+    GuiCommon*           GetCachedPage( guiPageType_t page_type ) const;
+    void*                GetPageStorage( guiPageType_t page_type );
+    static bool          IsPageCached( guiPageType_t page_type );
+    uint32_t             GetRefreshPeriod( ) const;
+    static uint32_t      RefreshRateToPeriod( GuiRefreshRate_t refresh_rate );
     bool                 refresh_pending;
+    uint32_t             last_refresh_time_ms;
     static volatile bool interruptPending;
     static bool          isTouched;
     GuiLastEvent_t       event;
     GuiDemoResult_t      demo_results;
     version_handler_t*   version_handler;
     GuiCommon*           guiCurrent;
+    alignas( GuiPageStorage_t ) uint8_t page_storage[sizeof( GuiPageStorage_t )];
+    GuiCachedPage_t cached_pages[GUI_NB_CACHED_PAGES];
+    uint8_t         nb_cached_pages;
 };
 
 #endif  // __GUI_H__
@@ -56,6 +56,7 @@ typedef enum
     GUI_PAGE_RADIO_TX_CW,
     GUI_PAGE_RADIO_PER,
     GUI_PAGE_RADIO_PING_PONG,
+    GUI_PAGE_RADIO_SPECTRUM_SWEEP,
     GUI_PAGE_MENU_DEMO,
     GUI_PAGE_MENU_GEOLOC_DEMO,
     GUI_PAGE_MENU_RADIO_DEMO,
@@ -96,6 +97,7 @@ typedef enum
     GUI_EVENT_START_PER_TX,
     GUI_EVENT_START_PER_RX,
     GUI_EVENT_START_PING_PONG,
+    GUI_EVENT_START_SPECTRUM_SWEEP,
     GUI_EVENT_START_WIFI,
     GUI_EVENT_START_GNSS_AUTONOMOUS,
     GUI_EVENT_START_GNSS_ASSISTED,
@@ -125,6 +127,7 @@ class GuiCommon
     virtual void refresh( ){ };
     virtual void start( ){ };
     virtual void stop( ){ };
+    void         show( );
 
     guiEvent_t    getAndClearEvent( );
     guiPageType_t getType( );
@@ -68,7 +68,9 @@ class GuiConfigRadioTestModes : public GuiCommon
     lv_obj_t* ta_freq;
     lv_obj_t* ta_pl_len;
     lv_obj_t* ta_pkt;
+    lv_obj_t* ta_rx_sampling;
     lv_obj_t* ddlist_pwr;
+    lv_obj_t* ddlist_refresh_rate;
     lv_obj_t* lora_ddlist_sf;
     lv_obj_t* lora_ddlist_bw;
     lv_obj_t* lora_ddlist_cr;
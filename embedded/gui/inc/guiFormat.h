@@ -49,6 +49,8 @@
 
 #define GUI_WIFI_CHANNELS 14
 
+#define GUI_SPECTRUM_SWEEP_MAX_CHANNELS 64
+
 #define GUI_RESULT_GEO_LOC_STREET_LENGTH 32
 #define GUI_RESULT_GEO_LOC_CITY_LENGTH 32
 #define GUI_RESULT_GEO_LOC_COUNTRY_LENGTH 32
@@ -158,8 +160,21 @@ typedef struct
     uint32_t count_rx_wrong_packet;
     uint32_t count_tx;
     uint32_t count_rx_timeout;
+    float    rx_rate_instant_pps;
+    float    rx_rate_average_pps;
 } GuiRadioPerResult_t;
 
+typedef struct
+{
+    uint32_t start_frequency_hz;
+    uint32_t step_frequency_hz;
+    uint8_t  nb_channels;
+    uint16_t nb_sweeps;
+    int8_t   rssi_min[GUI_SPECTRUM_SWEEP_MAX_CHANNELS];
+    int8_t   rssi_max[GUI_SPECTRUM_SWEEP_MAX_CHANNELS];
+    int8_t   rssi_mean[GUI_SPECTRUM_SWEEP_MAX_CHANNELS];
+} GuiSpectrumSweepResult_t;
+
 typedef struct
 {
     float temperature;
@@ -180,6 +195,7 @@ typedef struct
     GuiGnssResult_t          gnss_result;
     GuiTemperatureResult_t   temperature_result;
     GuiFileUploadResult_t    file_upload_result;
+    GuiSpectrumSweepResult_t spectrum_sweep_result;
 } GuiDemoResult_t;
 
 typedef struct
@@ -232,16 +248,30 @@ typedef struct
     bool     is_hdr_implicit;
 } GuiRadioSettingGfsk_t;
 
+/*!
+ * @brief Maximum rate at which the radio test pages display new results
+ */
+typedef enum
+{
+    GUI_REFRESH_RATE_10_HZ,
+    GUI_REFRESH_RATE_4_HZ,
+    GUI_REFRESH_RATE_1_HZ,
+} GuiRefreshRate_t;
+
+#define GUI_REFRESH_RATE_DEFAULT GUI_REFRESH_RATE_4_HZ
+
 typedef struct
 {
     uint32_t              rf_freq_in_hz;
     int16_t               pwr_in_dbm;
     uint16_t              nb_of_packets;
     uint16_t              payload_length;
+    uint16_t              rx_sampling_period_ms;
     bool                  is_hp_pa_enabled;
     bool                  is_lora;
     GuiRadioSettingLora_t lora;
     GuiRadioSettingGfsk_t gfsk;
+    GuiRefreshRate_t      refresh_rate;
 } GuiRadioSetting_t;
 
 typedef struct
@@ -42,6 +42,13 @@ class GuiMenuCommon : public GuiCommon
 
     void createTestEntry( uint8_t index, lv_obj_t** lbl, lv_obj_t** btn, lv_obj_t** lbl_btn, const char* lbl_name,
                           bool is_clickable, lv_event_cb_t event_cb );
+
+   protected:
+    void setTestEntrySpacing( int16_t base, int16_t distance );
+
+   private:
+    int16_t test_entry_base;
+    int16_t test_entry_distance;
 };
 
 #endif
@@ -53,6 +53,9 @@ class GuiMenuRadioTestModes : public GuiMenuCommon
     lv_obj_t* lbl_radio_ping_pong;
     lv_obj_t* btn_radio_ping_pong;
     lv_obj_t* lbl_btn_radio_ping_pong;
+    lv_obj_t* lbl_radio_spectrum_sweep;
+    lv_obj_t* btn_radio_spectrum_sweep;
+    lv_obj_t* lbl_btn_radio_spectrum_sweep;
     lv_obj_t* btn_back;
     lv_obj_t* btn_config;
 };
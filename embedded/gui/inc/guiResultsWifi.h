@@ -34,6 +34,23 @@
 
 #include "guiCommon.h"
 
+#define GUI_RESULTS_WIFI_RSSI_LENGTH ( 8 )
+
+/*!
+ * @brief Cells of a result row, and the result they display
+ */
+typedef struct
+{
+    lv_obj_t*           cell_mac_address;
+    lv_obj_t*           lbl_mac_address;
+    lv_obj_t*           cell_rssi;
+    lv_obj_t*           lbl_rssi;
+    bool                is_displayed;
+    GuiWifiMacAddress_t mac_address;
+    int16_t             rssi;
+    char                rssi_text[GUI_RESULTS_WIFI_RSSI_LENGTH];
+} GuiResultsWifiRow_t;
+
 class GuiResultsWifi : public GuiCommon
 {
    public:
@@ -52,9 +69,13 @@ class GuiResultsWifi : public GuiCommon
     void                          findAndDisplayFirstNonEmptyChannel( );
     void                          findAndDisplayNextChannel( bool up );
     void                          setChannelResults( );
+    void                          createRows( );
+    void                          updateRow( GuiResultsWifiRow_t* row, const GuiWifiResultData_t* data );
+    static void                   setRowDisplayed( GuiResultsWifiRow_t* row, bool is_displayed );
     uint8_t                       _index;
     const GuiWifiResult_t*        _results;
     const GuiWifiResultChannel_t* _current_chan;
+    GuiResultsWifiRow_t           _rows[GUI_MAX_WIFI_MAC_ADDRESSES];
 };
 
 #endif
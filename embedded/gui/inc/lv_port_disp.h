@@ -23,16 +23,41 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/*Set to 1 to display the frame statistics in an overlay, updated every second*/
+#ifndef LV_PORT_DISP_STATS_OVERLAY
+#define LV_PORT_DISP_STATS_OVERLAY 0
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/*Statistics of the frames drawn since the last reset. The render time of a frame is the time spent in the refresh
+ * task minus the time spent flushing to the display. The area is the number of pixels flushed*/
+typedef struct
+{
+    uint32_t frame_count;
+    uint32_t frames_per_second;
+    uint32_t render_time_us_last;
+    uint32_t render_time_us_max;
+    uint32_t render_time_us_total;
+    uint32_t flush_time_us_last;
+    uint32_t flush_time_us_max;
+    uint32_t flush_time_us_total;
+    uint32_t area_px_last;
+    uint32_t area_px_max;
+    uint32_t area_px_total;
+} lv_port_disp_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
 void lv_port_disp_init( void );
 
+void lv_port_disp_get_stats( lv_port_disp_stats_t* stats );
+void lv_port_disp_reset_stats( void );
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,75 @@
+/**
+ * @file      lv_port_font_subset.h
+ *
+ * @brief     Definition of the glyph lookup of the subsetted fonts.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __LV_PORT_FONT_SUBSET_H__
+#define __LV_PORT_FONT_SUBSET_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "lvgl.h"
+
+/*!
+ * @brief Letter drawn in place of the letters left out of a subsetted font
+ *
+ * It is always part of the subsets generated by gui/tools/lv_font_subset.py
+ */
+#define LV_PORT_FONT_SUBSET_FALLBACK_LETTER '?'
+
+/*!
+ * @brief Get the glyph descriptor of a letter, or of the fallback letter if the font has no glyph for it
+ *
+ * @param [in] font Subsetted font
+ * @param [out] dsc_out Descriptor of the glyph
+ * @param [in] unicode_letter Letter to draw
+ * @param [in] unicode_letter_next Letter following it, for the kerning
+ *
+ * @returns true if a glyph is drawn, false for the control characters
+ */
+bool lv_port_font_subset_get_glyph_dsc( const lv_font_t* font, lv_font_glyph_dsc_t* dsc_out, uint32_t unicode_letter,
+                                        uint32_t unicode_letter_next );
+
+/*!
+ * @brief Get the glyph bitmap of a letter, or of the fallback letter if the font has no glyph for it
+ *
+ * @param [in] font Subsetted font
+ * @param [in] unicode_letter Letter to draw
+ *
+ * @returns Pointer to the bitmap, NULL for the control characters
+ */
+const uint8_t* lv_port_font_subset_get_glyph_bitmap( const lv_font_t* font, uint32_t unicode_letter );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // __LV_PORT_FONT_SUBSET_H__
@@ -0,0 +1,61 @@
+/**
+ * @file      lv_port_img_rle.h
+ *
+ * @brief     Definition of the LVGL decoder for run-length encoded palette images.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __LV_PORT_IMG_RLE_H__
+#define __LV_PORT_IMG_RLE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "lvgl.h"
+
+/*!
+ * @brief Color format of the run-length encoded palette images
+ *
+ * The image data is made of:
+ *   - the number of colors of the palette, on one byte
+ *   - the palette, as red, green and blue bytes for each color
+ *   - the index of the first run of each row, on two bytes little endian
+ *   - the runs, as a length byte followed by a palette index byte. A run never spans two rows
+ */
+#define LV_IMG_CF_RLE_PALETTE LV_IMG_CF_USER_ENCODED_0
+
+/*!
+ * @brief Register the decoder so that LVGL can draw the run-length encoded palette images row by row
+ */
+void lv_port_img_rle_init( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // __LV_PORT_IMG_RLE_H__
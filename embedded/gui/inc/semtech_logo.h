@@ -37,6 +37,7 @@ extern "C" {
 #endif
 
 #include "lvgl.h"
+#include "lv_port_img_rle.h"
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
 #define LV_ATTRIBUTE_MEM_ALIGN
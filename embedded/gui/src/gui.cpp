@@ -31,11 +31,33 @@
 
 #include "gui.h"
 #include "lvgl.h"
+#include <new>
+
+// Keep running long enough after the last touch for LVGL to read the release and process the click
+#define GUI_IDLE_INACTIVITY_MS ( 500 )
+
+#define GUI_REFRESH_PERIOD_10_HZ_MS ( 100 )
+#define GUI_REFRESH_PERIOD_4_HZ_MS ( 250 )
+#define GUI_REFRESH_PERIOD_1_HZ_MS ( 1000 )
+
+// Pages kept alive once built, they are built first so that they sit together at the bottom of the LVGL memory pool
+static const guiPageType_t gui_cached_page_types[GUI_NB_CACHED_PAGES] = {
+    GUI_PAGE_MENU,
+    GUI_PAGE_MENU_DEMO,
+    GUI_PAGE_MENU_GEOLOC_DEMO,
+    GUI_PAGE_MENU_RADIO_DEMO,
+    GUI_PAGE_MENU_RADIO_TEST_MODES,
+};
 
 volatile bool Gui::interruptPending = false;
 bool          Gui::isTouched        = false;
 
-Gui::Gui( ) : refresh_pending( false ), event( GUI_LAST_EVENT_NONE )
+Gui::Gui( )
+    : refresh_pending( false ),
+      last_refresh_time_ms( 0 ),
+      event( GUI_LAST_EVENT_NONE ),
+      guiCurrent( NULL ),
+      nb_cached_pages( 0 )
 {
     this->demo_results.wifi_result.nbMacAddrTotal = 0;
     this->demo_results.wifi_result.powerConsTotal = 0;
@@ -56,7 +78,13 @@ void Gui::Init( GuiDemoSettings_t* settings, GuiDemoSettings_t* settings_default
     this->network_connectivity_settings.adr_profile   = GUI_NETWORK_CONNECTIVITY_ADR_NETWORK_SERVER_CONTROLLED;
     this->network_connectivity_settings.lorawan_class = GUI_NETWORK_CONNECTIVITY_LORAWAN_CLASS_A;
 
-    this->guiCurrent = new GuiSplashScreen( this->version_handler );
+    // Building the cached pages before any transient page keeps them from fragmenting the LVGL memory pool
+    for( uint8_t index = 0; index < GUI_NB_CACHED_PAGES; index++ )
+    {
+        this->CreateNewPage( gui_cached_page_types[index] );
+    }
+
+    this->CreateNewPage( GUI_PAGE_SPLASHSCREEN );
 }
 
 void Gui::Runtime( )
@@ -175,6 +203,9 @@ void Gui::Runtime( )
             case GUI_EVENT_START_PING_PONG:
                 next_page_type = GUI_PAGE_RADIO_PING_PONG;
                 break;
+            case GUI_EVENT_START_SPECTRUM_SWEEP:
+                next_page_type = GUI_PAGE_RADIO_SPECTRUM_SWEEP;
+                break;
             case GUI_EVENT_CONFIG:
                 next_page_type = GUI_PAGE_RADIO_TEST_MODES_CONFIG;
                 break;
@@ -274,6 +305,28 @@ void Gui::Runtime( )
             break;
         }
 
+        case GUI_PAGE_RADIO_SPECTRUM_SWEEP:
+        {
+            switch( event_from_display )
+            {
+            case GUI_EVENT_START_SPECTRUM_SWEEP:
+                this->guiCurrent->start( );
+                this->event = GUI_LAST_EVENT_START_DEMO_SPECTRUM_SWEEP;
+                break;
+            case GUI_EVENT_STOP:
+                this->guiCurrent->stop( );
+                this->event = GUI_LAST_EVENT_STOP_DEMO;
+                break;
+            case GUI_EVENT_BACK:
+                next_page_type = GUI_PAGE_MENU_RADIO_TEST_MODES;
+                this->event    = GUI_LAST_EVENT_STOP_DEMO;
+                break;
+            default:
+                break;
+            }
+            break;
+        }
+
         case GUI_PAGE_MENU_DEMO:
         {
             switch( event_from_display )
@@ -588,9 +641,12 @@ void Gui::Runtime( )
 
     this->CreateNewPage( next_page_type );
 
-    if( this->refresh_pending == true )
+    // Results received in between are coalesced: the page displays the last ones on its next refresh
+    if( ( this->refresh_pending == true ) &&
+        ( lv_tick_elaps( this->last_refresh_time_ms ) >= this->GetRefreshPeriod( ) ) )
     {
-        this->refresh_pending = false;
+        this->refresh_pending      = false;
+        this->last_refresh_time_ms = lv_tick_get( );
         this->guiCurrent->refresh( );
     }
 
@@ -680,6 +736,12 @@ void Gui::UpdateRadioPerResult( GuiRadioPerResult_t& demo_result )
     this->refresh_pending               = true;
 }
 
+void Gui::UpdateSpectrumSweepResult( GuiSpectrumSweepResult_t& demo_result )
+{
+    this->demo_results.spectrum_sweep_result = demo_result;
+    this->refresh_pending                    = true;
+}
+
 void Gui::UpdateTemperatureResult( GuiTemperatureResult_t& gui_demo_result )
 {
     this->demo_results.temperature_result = gui_demo_result;
@@ -701,150 +763,220 @@ void Gui::UpdateReverseGeoCoding( const GuiResultGeoLoc_t& new_reverse_geo_codin
 
 void Gui::SetDemoStatus( GuiDemoStatus_t& demo_status ) {}
 
+uint32_t Gui::GetRefreshPeriod( ) const
+{
+    switch( this->guiCurrent->getType( ) )
+    {
+    case GUI_PAGE_RADIO_TX_CW:
+    case GUI_PAGE_RADIO_PER:
+    case GUI_PAGE_RADIO_PING_PONG:
+    case GUI_PAGE_RADIO_SPECTRUM_SWEEP:
+        return Gui::RefreshRateToPeriod( this->demo_settings.radio_settings.refresh_rate );
+    default:
+        // The other pages get their results once, at the end of the demo
+        return 0;
+    }
+}
+
+uint32_t Gui::RefreshRateToPeriod( GuiRefreshRate_t refresh_rate )
+{
+    switch( refresh_rate )
+    {
+    case GUI_REFRESH_RATE_10_HZ:
+        return GUI_REFRESH_PERIOD_10_HZ_MS;
+    case GUI_REFRESH_RATE_1_HZ:
+        return GUI_REFRESH_PERIOD_1_HZ_MS;
+    case GUI_REFRESH_RATE_4_HZ:
+    default:
+        return GUI_REFRESH_PERIOD_4_HZ_MS;
+    }
+}
+
 bool Gui::HasRefreshPending( ) const { return this->refresh_pending; }
 
+bool Gui::GetRefreshDelay( uint32_t* delay_ms ) const
+{
+    if( this->refresh_pending == false )
+    {
+        return false;
+    }
+
+    const uint32_t elapsed_ms = lv_tick_elaps( this->last_refresh_time_ms );
+    const uint32_t period_ms  = this->GetRefreshPeriod( );
+
+    *delay_ms = ( elapsed_ms < period_ms ) ? ( period_ms - elapsed_ms ) : 0;
+    return true;
+}
+
+bool Gui::IsIdle( ) const
+{
+    lv_disp_t* display = lv_disp_get_default( );
+
+    // A pending refresh does not keep the GUI busy: it is throttled until a deadline given by GetRefreshDelay
+    return ( Gui::isTouched == false ) && ( lv_disp_get_inv_buf_size( display ) == 0 ) &&
+           ( lv_anim_count_running( ) == 0 ) && ( lv_disp_get_inactive_time( display ) > GUI_IDLE_INACTIVITY_MS );
+}
+
 void Gui::CreateNewPage( guiPageType_t page_type )
 {
     if( page_type != GUI_PAGE_NONE )
     {
-        delete this->guiCurrent;
-        this->guiCurrent = NULL;
+        this->ReleaseCurrentPage( );
+
+        this->guiCurrent = this->GetCachedPage( page_type );
+        if( this->guiCurrent != NULL )
+        {
+            this->guiCurrent->show( );
+            return;
+        }
+
+        void* storage = this->GetPageStorage( page_type );
 
         switch( page_type )
         {
         case GUI_PAGE_SPLASHSCREEN:
         {
-            this->guiCurrent = new GuiSplashScreen( this->version_handler );
+            this->guiCurrent = new( storage ) GuiSplashScreen( this->version_handler );
             break;
         }
         case GUI_PAGE_ABOUT:
         {
-            this->guiCurrent = new GuiAbout( this->version_handler );
+            this->guiCurrent = new( storage ) GuiAbout( this->version_handler );
             break;
         }
         case GUI_PAGE_MENU:
         {
-            this->guiCurrent = new GuiMenu( this->version_handler );
+            this->guiCurrent = new( storage ) GuiMenu( this->version_handler );
             break;
         }
         case GUI_PAGE_CONNECTIVITY:
         {
-            this->guiCurrent = new GuiConnectivity( &( this->network_connectivity_settings ) );
+            this->guiCurrent = new( storage ) GuiConnectivity( &( this->network_connectivity_settings ) );
             break;
         }
         case GUI_PAGE_MENU_DEMO:
         {
-            this->guiCurrent = new GuiMenuDemo( this->version_handler );
+            this->guiCurrent = new( storage ) GuiMenuDemo( this->version_handler );
             break;
         }
         case GUI_PAGE_MENU_GEOLOC_DEMO:
         {
-            this->guiCurrent = new GuiMenuGeolocDemo( this->version_handler );
+            this->guiCurrent = new( storage ) GuiMenuGeolocDemo( this->version_handler );
             break;
         }
         case GUI_PAGE_MENU_RADIO_DEMO:
         {
-            this->guiCurrent = new GuiMenuRadioDemo( this->version_handler );
+            this->guiCurrent = new( storage ) GuiMenuRadioDemo( this->version_handler );
             break;
         }
         case GUI_PAGE_MENU_RADIO_TEST_MODES:
         {
-            this->guiCurrent = new GuiMenuRadioTestModes( this->version_handler );
+            this->guiCurrent = new( storage ) GuiMenuRadioTestModes( this->version_handler );
             break;
         }
         case GUI_PAGE_EUI:
         {
-            this->guiCurrent = new GuiEui( this->version_handler );
+            this->guiCurrent = new( storage ) GuiEui( this->version_handler );
             break;
         }
         case GUI_PAGE_WIFI_TEST:
         {
-            this->guiCurrent = new GuiTestWifi( &demo_results.wifi_result, this->at_least_one_scan_done );
+            this->guiCurrent =
+                new( storage ) GuiTestWifi( &demo_results.wifi_result, this->at_least_one_scan_done );
             break;
         }
         case GUI_PAGE_WIFI_CONFIG:
         {
-            this->guiCurrent = new GuiConfigWifi( &( this->demo_settings.wifi_settings ),
-                                                  &( this->demo_settings_default.wifi_settings ) );
+            this->guiCurrent = new( storage ) GuiConfigWifi( &( this->demo_settings.wifi_settings ),
+                                                             &( this->demo_settings_default.wifi_settings ) );
             break;
         }
         case GUI_PAGE_WIFI_RESULTS:
         {
-            this->guiCurrent = new GuiResultsWifi( &demo_results.wifi_result );
+            this->guiCurrent = new( storage ) GuiResultsWifi( &demo_results.wifi_result );
             break;
         }
         case GUI_PAGE_GNSS_AUTONOMOUS_TEST:
         {
-            this->guiCurrent = new GuiTestGnss( &demo_results.gnss_result, GUI_PAGE_GNSS_AUTONOMOUS_TEST,
-                                                this->at_least_one_scan_done );
+            this->guiCurrent = new( storage ) GuiTestGnss( &demo_results.gnss_result, GUI_PAGE_GNSS_AUTONOMOUS_TEST,
+                                                           this->at_least_one_scan_done );
             break;
         }
         case GUI_PAGE_GNSS_AUTONOMOUS_CONFIG:
         {
             this->guiCurrent =
-                new GuiConfigGnss( GUI_PAGE_GNSS_AUTONOMOUS_CONFIG, &demo_settings.gnss_autonomous_settings,
-                                   &demo_settings_default.gnss_autonomous_settings, this->version_handler );
+                new( storage ) GuiConfigGnss( GUI_PAGE_GNSS_AUTONOMOUS_CONFIG, &demo_settings.gnss_autonomous_settings,
+                                              &demo_settings_default.gnss_autonomous_settings, this->version_handler );
             break;
         }
         case GUI_PAGE_GNSS_AUTONOMOUS_RESULTS:
         {
-            this->guiCurrent = new GuiResultsGnss( &demo_results.gnss_result, GUI_PAGE_GNSS_AUTONOMOUS_RESULTS );
+            this->guiCurrent =
+                new( storage ) GuiResultsGnss( &demo_results.gnss_result, GUI_PAGE_GNSS_AUTONOMOUS_RESULTS );
             break;
         }
         case GUI_PAGE_GNSS_ASSISTED_TEST:
         {
             this->guiCurrent =
-                new GuiTestGnss( &demo_results.gnss_result, GUI_PAGE_GNSS_ASSISTED_TEST, this->at_least_one_scan_done );
+                new( storage ) GuiTestGnss( &demo_results.gnss_result, GUI_PAGE_GNSS_ASSISTED_TEST,
+                                            this->at_least_one_scan_done );
             break;
         }
         case GUI_PAGE_GNSS_ASSISTED_CONFIG:
         {
             this->guiCurrent =
-                new GuiConfigGnss( GUI_PAGE_GNSS_ASSISTED_CONFIG, &demo_settings.gnss_assisted_settings,
-                                   &demo_settings_default.gnss_assisted_settings, this->version_handler );
+                new( storage ) GuiConfigGnss( GUI_PAGE_GNSS_ASSISTED_CONFIG, &demo_settings.gnss_assisted_settings,
+                                              &demo_settings_default.gnss_assisted_settings, this->version_handler );
             break;
         }
         case GUI_PAGE_GNSS_ASSISTED_RESULTS:
         {
-            this->guiCurrent = new GuiResultsGnss( &demo_results.gnss_result, GUI_PAGE_GNSS_ASSISTED_RESULTS );
+            this->guiCurrent =
+                new( storage ) GuiResultsGnss( &demo_results.gnss_result, GUI_PAGE_GNSS_ASSISTED_RESULTS );
             break;
         }
         case GUI_PAGE_GNSS_ASSISTANCE_POSITION_CONFIG:
         {
-            this->guiCurrent = new GuiConfigGnssAssistancePosition( &( this->gnss_assistance_position ),
-                                                                    &( this->gnss_assistance_position_default ) );
+            this->guiCurrent = new( storage ) GuiConfigGnssAssistancePosition(
+                &( this->gnss_assistance_position ), &( this->gnss_assistance_position_default ) );
             break;
         }
         case GUI_PAGE_RADIO_TEST_MODES_CONFIG:
         {
-            this->guiCurrent = new GuiConfigRadioTestModes(
+            this->guiCurrent = new( storage ) GuiConfigRadioTestModes(
                 &demo_settings.radio_settings, &demo_settings_default.radio_settings, this->version_handler );
             break;
         }
         case GUI_PAGE_RADIO_TX_CW:
         {
-            this->guiCurrent = new GuiRadioTxCw( &demo_settings.radio_settings );
+            this->guiCurrent = new( storage ) GuiRadioTxCw( &demo_settings.radio_settings );
             break;
         }
         case GUI_PAGE_RADIO_PER:
         {
-            this->guiCurrent = new GuiRadioPer( &demo_settings.radio_settings, &demo_results.radio_per_result );
+            this->guiCurrent =
+                new( storage ) GuiRadioPer( &demo_settings.radio_settings, &demo_results.radio_per_result );
             break;
         }
         case GUI_PAGE_RADIO_PING_PONG:
         {
             this->guiCurrent =
-                new GuiRadioPingPong( &demo_settings.radio_settings, &demo_results.radio_pingpong_result );
+                new( storage ) GuiRadioPingPong( &demo_settings.radio_settings, &demo_results.radio_pingpong_result );
+            break;
+        }
+        case GUI_PAGE_RADIO_SPECTRUM_SWEEP:
+        {
+            this->guiCurrent = new( storage ) GuiRadioSpectrumSweep( &demo_results.spectrum_sweep_result );
             break;
         }
         case GUI_PAGE_TEMPERATURE_DEMO:
         {
-            this->guiCurrent = new GuiTemperature( &demo_results.temperature_result );
+            this->guiCurrent = new( storage ) GuiTemperature( &demo_results.temperature_result );
             break;
         }
         case GUI_PAGE_FILE_UPLOAD_DEMO:
         {
-            this->guiCurrent = new GuiFileUpload( &demo_results.file_upload_result );
+            this->guiCurrent = new( storage ) GuiFileUpload( &demo_results.file_upload_result );
             break;
         }
         default:
@@ -852,5 +984,55 @@ void Gui::CreateNewPage( guiPageType_t page_type )
             break;
         }
         }
+
+        if( Gui::IsPageCached( page_type ) == true )
+        {
+            this->cached_pages[this->nb_cached_pages].page = this->guiCurrent;
+            this->nb_cached_pages++;
+        }
+    }
+}
+
+void Gui::ReleaseCurrentPage( )
+{
+    // Cached pages keep their object and LVGL screen alive, the other ones are destroyed in place
+    if( ( this->guiCurrent != NULL ) && ( Gui::IsPageCached( this->guiCurrent->getType( ) ) == false ) )
+    {
+        this->guiCurrent->~GuiCommon( );
+    }
+    this->guiCurrent = NULL;
+}
+
+GuiCommon* Gui::GetCachedPage( guiPageType_t page_type ) const
+{
+    for( uint8_t index = 0; index < this->nb_cached_pages; index++ )
+    {
+        if( this->cached_pages[index].page->getType( ) == page_type )
+        {
+            return this->cached_pages[index].page;
+        }
+    }
+    return NULL;
+}
+
+void* Gui::GetPageStorage( guiPageType_t page_type )
+{
+    // A cached page is only constructed once, so there is always a free slot for it
+    if( Gui::IsPageCached( page_type ) == true )
+    {
+        return this->cached_pages[this->nb_cached_pages].storage;
+    }
+    return this->page_storage;
+}
+
+bool Gui::IsPageCached( guiPageType_t page_type )
+{
+    for( uint8_t index = 0; index < GUI_NB_CACHED_PAGES; index++ )
+    {
+        if( gui_cached_page_types[index] == page_type )
+        {
+            return true;
+        }
     }
+    return false;
 }
@@ -67,7 +67,8 @@ lv_style_t GuiCommon::tab;
 lv_style_t GuiCommon::led_on;
 lv_style_t GuiCommon::led_off;
 
-GuiCommon::GuiCommon( guiPageType_t pageType ) : _pageType( pageType )
+GuiCommon::GuiCommon( guiPageType_t pageType )
+    : _pageType( pageType ), _label_connectivity_icon( NULL ), _label_fake_led_icon( NULL )
 {
     this->screen = lv_obj_create( NULL, NULL );
 
@@ -89,7 +90,7 @@ GuiCommon::GuiCommon( guiPageType_t pageType ) : _pageType( pageType )
         GuiCommon::title_style.body.main_color = LV_COLOR_BLACK;
         GuiCommon::title_style.body.grad_color = LV_COLOR_BLACK;
         GuiCommon::title_style.text.color      = LV_COLOR_WHITE;
-        GuiCommon::title_style.text.font       = &lv_font_roboto_22;
+        GuiCommon::title_style.text.font       = &lv_font_roboto_22_subset;
 
         lv_style_copy( &( GuiCommon::info_frame_style_init ), &lv_style_scr );
         GuiCommon::info_frame_style_init.body.main_color   = LV_COLOR_BLACK;
@@ -175,6 +176,22 @@ guiEvent_t GuiCommon::getAndClearEvent( )
 
 guiPageType_t GuiCommon::getType( ) { return _pageType; }
 
+void GuiCommon::show( )
+{
+    // The header icons and the connectivity dependent buttons may have changed while the screen was not displayed
+    if( this->_label_connectivity_icon != NULL )
+    {
+        this->updateNetworkConnectivityIcon( );
+    }
+    if( this->_label_fake_led_icon != NULL )
+    {
+        this->updateFakeLedIconState( );
+    }
+    this->propagateHostConnectivityStateChange( );
+    this->propagateNetworkConnectivityStateChange( );
+    lv_scr_load( this->screen );
+}
+
 void GuiCommon::createHeader( const char* text )
 {
     lv_obj_t* header = lv_cont_create( this->screen, NULL );
@@ -75,10 +75,21 @@ GuiConfigRadioTestModes::GuiConfigRadioTestModes( GuiRadioSetting_t*       setti
         this->create_ta( &( this->ta_pkt ), this->tab_generic, 80, "Nb of packets", 5, "100",
                          GuiConfigRadioTestModes::callback_ta );
     }
+    else
+    {
+        this->create_ta( &( this->ta_rx_sampling ), this->tab_generic, 80, "Sampling (ms)", 5, "1000",
+                         GuiConfigRadioTestModes::callback_ta );
+    }
 
     this->createDropDownList( &( this->ddlist_pwr ), this->tab_generic, 115, "Power (dBm)", lp_pa_options,
                               GuiConfigRadioTestModes::callback_ddlist, DDLIST_WIDTH, 0 );
 
+    this->createDropDownList( &( this->ddlist_refresh_rate ), this->tab_generic, 150, "Display refresh",
+                              "10 Hz\n"
+                              "4 Hz\n"
+                              "1 Hz",
+                              GuiConfigRadioTestModes::callback_ddlist, DDLIST_WIDTH, 0 );
+
     this->createChoiceSwitch( &( this->sw_pkt_type ), this->tab_generic, "LoRa", "GFSK",
                               GuiConfigRadioTestModes::callback_sw, 30, true );
 
@@ -216,10 +227,17 @@ void GuiConfigRadioTestModes::ConfigParamGeneric( )
         snprintf( str, TMP_BUFFER_CONFIG_PARAM_GENERIC_LENGTH, "%d", this->settings_temp.nb_of_packets );
         lv_ta_set_text( this->ta_pkt, str );
     }
+    else
+    {
+        snprintf( str, TMP_BUFFER_CONFIG_PARAM_GENERIC_LENGTH, "%d", this->settings_temp.rx_sampling_period_ms );
+        lv_ta_set_text( this->ta_rx_sampling, str );
+    }
 
     snprintf( str, TMP_BUFFER_CONFIG_PARAM_GENERIC_LENGTH, "%d", this->settings_temp.payload_length );
     lv_ta_set_text( this->ta_pl_len, str );
 
+    lv_ddlist_set_selected( this->ddlist_refresh_rate, this->settings_temp.refresh_rate );
+
     if( this->settings_temp.is_lora == true )
     {
         lv_sw_off( this->sw_pkt_type, LV_ANIM_OFF );
@@ -338,6 +356,10 @@ bool GuiConfigRadioTestModes::IsConfigTempEqualTo( const GuiRadioSetting_t* sett
     {
         return false;
     }
+    else if( this->settings_temp.rx_sampling_period_ms != settings_to_compare->rx_sampling_period_ms )
+    {
+        return false;
+    }
     else if( this->settings_temp.is_lora != settings_to_compare->is_lora )
     {
         return false;
@@ -390,6 +412,10 @@ bool GuiConfigRadioTestModes::IsConfigTempEqualTo( const GuiRadioSetting_t* sett
     {
         return false;
     }
+    else if( this->settings_temp.refresh_rate != settings_to_compare->refresh_rate )
+    {
+        return false;
+    }
 
     return true;
 }
@@ -518,6 +544,16 @@ void GuiConfigRadioTestModes::callback_kb( lv_obj_t* obj, lv_event_t event )
             snprintf( str, TMP_BUFFER_CALLBACK_LENGTH, "%d", self->settings_temp.nb_of_packets );
             lv_ta_set_text( ta, str );
         }
+        else if( ta == self->ta_rx_sampling )
+        {
+            self->settings_temp.rx_sampling_period_ms = ( uint32_t ) atoi( txt );
+
+            self->settings_temp.rx_sampling_period_ms =
+                GuiCommon::check_value_limits( self->settings_temp.rx_sampling_period_ms, 100, 60000 );
+
+            snprintf( str, TMP_BUFFER_CALLBACK_LENGTH, "%d", self->settings_temp.rx_sampling_period_ms );
+            lv_ta_set_text( ta, str );
+        }
         else if( ta == self->ta_pl_len )
         {
             self->settings_temp.payload_length = ( uint32_t ) atoi( txt );
@@ -602,6 +638,11 @@ void GuiConfigRadioTestModes::callback_ddlist( lv_obj_t* obj, lv_event_t event )
             }
         }
 
+        else if( obj == self->ddlist_refresh_rate )
+        {
+            self->settings_temp.refresh_rate = ( GuiRefreshRate_t ) id;
+        }
+
         else if( obj == self->lora_ddlist_sf )
         {
             // The "+ 2" trick is done because modem and transceiver does not behave the same
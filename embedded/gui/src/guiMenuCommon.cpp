@@ -39,7 +39,10 @@
 #define TEST_ENTRY_BASE -80
 #define TEST_ENTRY_DISTANCE 60
 
-GuiMenuCommon::GuiMenuCommon( guiPageType_t pageType ) : GuiCommon( pageType ) {}
+GuiMenuCommon::GuiMenuCommon( guiPageType_t pageType )
+    : GuiCommon( pageType ), test_entry_base( TEST_ENTRY_BASE ), test_entry_distance( TEST_ENTRY_DISTANCE )
+{
+}
 
 GuiMenuCommon::~GuiMenuCommon( ) {}
 
@@ -53,7 +56,7 @@ void GuiMenuCommon::createTestEntry( uint8_t index, lv_obj_t** lbl, lv_obj_t** b
     lv_label_set_align( *lbl, LV_LABEL_ALIGN_LEFT );
     lv_label_set_text( *lbl, lbl_name );
     lv_obj_set_width( *lbl, LABEL_WIDTH );
-    lv_obj_align( *lbl, NULL, LV_ALIGN_IN_LEFT_MID, MARGIN, TEST_ENTRY_BASE + index * TEST_ENTRY_DISTANCE );
+    lv_obj_align( *lbl, NULL, LV_ALIGN_IN_LEFT_MID, MARGIN, this->test_entry_base + index * this->test_entry_distance );
 
     // Create the button
     *btn = lv_btn_create( this->screen, NULL );
@@ -62,9 +65,15 @@ void GuiMenuCommon::createTestEntry( uint8_t index, lv_obj_t** lbl, lv_obj_t** b
     lv_obj_set_width( *btn, BUTTON_WIDTH );
     lv_obj_set_event_cb( *btn, event_cb );
     lv_obj_set_user_data( *btn, this );
-    lv_obj_align( *btn, NULL, LV_ALIGN_IN_RIGHT_MID, -MARGIN, TEST_ENTRY_BASE + index * TEST_ENTRY_DISTANCE );
+    lv_obj_align( *btn, NULL, LV_ALIGN_IN_RIGHT_MID, -MARGIN, this->test_entry_base + index * this->test_entry_distance );
 
     // Create the label attached to the button
     *lbl_btn = lv_label_create( *btn, NULL );
     lv_label_set_text( *lbl_btn, "GO!" );
 }
+
+void GuiMenuCommon::setTestEntrySpacing( int16_t base, int16_t distance )
+{
+    this->test_entry_base     = base;
+    this->test_entry_distance = distance;
+}
@@ -38,6 +38,12 @@ GuiMenuRadioTestModes::GuiMenuRadioTestModes( version_handler_t* version_handler
 
     this->createHeaderWithIcons( "RADIO TEST MODES" );
 
+    if( version_handler->device_type == VERSION_DEVICE_TRANSCEIVER )
+    {
+        // The four transceiver entries only clear the bottom buttons when spaced tighter than in the other menus
+        this->setTestEntrySpacing( -90, 50 );
+    }
+
     this->createTestEntry( index++, &( this->lbl_radio_tx_cw ), &( this->btn_radio_tx_cw ),
                            &( this->lbl_btn_radio_tx_cw ), "TX Cont. Wave", true, GuiMenuRadioTestModes::callback );
 
@@ -48,6 +54,10 @@ GuiMenuRadioTestModes::GuiMenuRadioTestModes( version_handler_t* version_handler
     {
         this->createTestEntry( index++, &( this->lbl_radio_ping_pong ), &( this->btn_radio_ping_pong ),
                                &( this->lbl_btn_radio_ping_pong ), "Ping Pong", true, GuiMenuRadioTestModes::callback );
+
+        this->createTestEntry( index++, &( this->lbl_radio_spectrum_sweep ), &( this->btn_radio_spectrum_sweep ),
+                               &( this->lbl_btn_radio_spectrum_sweep ), "Spectrum Sweep", true,
+                               GuiMenuRadioTestModes::callback );
     }
 
     this->createActionButton( &( this->btn_back ), "BACK", GuiMenuRadioTestModes::callback, GUI_BUTTON_POS_CENTER, -5,
@@ -79,6 +89,10 @@ void GuiMenuRadioTestModes::callback( lv_obj_t* obj, lv_event_t event )
         {
             GuiCommon::_event = GUI_EVENT_START_PING_PONG;
         }
+        else if( obj == self->btn_radio_spectrum_sweep )
+        {
+            GuiCommon::_event = GUI_EVENT_START_SPECTRUM_SWEEP;
+        }
         else if( obj == self->btn_back )
         {
             GuiCommon::_event = GUI_EVENT_BACK;
@@ -109,6 +109,14 @@ void GuiRadioPer::refresh( )
 
         snprintf( buffer, TMP_BUFFER_REFRESH_LENGTH, "Packet errors = %i", this->results->count_rx_wrong_packet );
         lv_label_set_text( this->lbl_info_frame_2, buffer );
+
+        // Packet rates are only reported by the demos sampling the packet counter
+        if( ( this->results->rx_rate_instant_pps > 0 ) || ( this->results->rx_rate_average_pps > 0 ) )
+        {
+            snprintf( buffer, TMP_BUFFER_REFRESH_LENGTH, "%.1f pkt/s (avg %.1f)", this->results->rx_rate_instant_pps,
+                      this->results->rx_rate_average_pps );
+            lv_label_set_text( this->lbl_info_frame_3, buffer );
+        }
     }
 }
 
@@ -0,0 +1,161 @@
+/**
+ * @file      guiRadioSpectrumSweep.cpp
+ *
+ * @brief     Implementation of the gui RSSI spectrum sweep page.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "guiRadioSpectrumSweep.h"
+
+#define TMP_BUFFER_REFRESH_LENGTH ( 35 )
+
+#define GUI_SPECTRUM_SWEEP_CHART_HEIGHT ( 60 )
+#define GUI_SPECTRUM_SWEEP_CHART_WIDTH ( 210 )
+#define GUI_SPECTRUM_SWEEP_RSSI_MIN ( -140 )
+#define GUI_SPECTRUM_SWEEP_RSSI_MAX ( -20 )
+
+GuiRadioSpectrumSweep::GuiRadioSpectrumSweep( const GuiSpectrumSweepResult_t* results )
+    : GuiCommon( GUI_PAGE_RADIO_SPECTRUM_SWEEP ), results( results )
+{
+    this->createHeaderWithIcons( "SPECTRUM SWEEP" );
+
+    this->createInfoFrame( &( this->info_frame ), &( this->lbl_info_frame_1 ), "PRESS START TO BEGIN",
+                           &( this->lbl_info_frame_2 ), "", &( this->lbl_info_frame_3 ), "" );
+
+    this->chart = lv_chart_create( this->info_frame, NULL );
+    lv_obj_set_size( this->chart, GUI_SPECTRUM_SWEEP_CHART_WIDTH, GUI_SPECTRUM_SWEEP_CHART_HEIGHT );
+    lv_chart_set_type( this->chart, LV_CHART_TYPE_LINE );
+    lv_chart_set_range( this->chart, GUI_SPECTRUM_SWEEP_RSSI_MIN, GUI_SPECTRUM_SWEEP_RSSI_MAX );
+    lv_chart_set_div_line_count( this->chart, 3, 0 );
+    lv_chart_set_point_count( this->chart, GUI_SPECTRUM_SWEEP_MAX_CHANNELS );
+    this->series_max  = lv_chart_add_series( this->chart, LV_COLOR_RED );
+    this->series_mean = lv_chart_add_series( this->chart, LV_COLOR_CYAN );
+    lv_chart_init_points( this->chart, this->series_max, GUI_SPECTRUM_SWEEP_RSSI_MIN );
+    lv_chart_init_points( this->chart, this->series_mean, GUI_SPECTRUM_SWEEP_RSSI_MIN );
+
+    this->createActionButton( &( this->btn_start ), "START", GuiRadioSpectrumSweep::callback, GUI_BUTTON_POS_CENTER,
+                              -60, true );
+
+    this->createActionButton( &( this->btn_stop ), "STOP", GuiRadioSpectrumSweep::callback, GUI_BUTTON_POS_CENTER, -60,
+                              true );
+
+    this->createActionButton( &( this->btn_back ), "BACK", GuiRadioSpectrumSweep::callback, GUI_BUTTON_POS_CENTER, -5,
+                              true );
+
+    lv_obj_set_hidden( this->btn_start, false );
+    lv_obj_set_hidden( this->btn_stop, true );
+
+    lv_scr_load( this->screen );
+}
+
+GuiRadioSpectrumSweep::~GuiRadioSpectrumSweep( ) {}
+
+void GuiRadioSpectrumSweep::start( )
+{
+    lv_cont_set_style( this->info_frame, LV_CONT_STYLE_MAIN, &( GuiCommon::info_frame_style_ongoing ) );
+
+    lv_label_set_text( this->lbl_info_frame_1, "Sweeps = 0" );
+    lv_label_set_text( this->lbl_info_frame_2, "" );
+    lv_label_set_text( this->lbl_info_frame_3, "" );
+}
+
+void GuiRadioSpectrumSweep::stop( )
+{
+    lv_cont_set_style( this->info_frame, LV_CONT_STYLE_MAIN, &( GuiCommon::info_frame_style_init ) );
+
+    lv_label_set_text( this->lbl_info_frame_1, "PRESS START TO BEGIN" );
+}
+
+void GuiRadioSpectrumSweep::refresh( )
+{
+    char       buffer[TMP_BUFFER_REFRESH_LENGTH]            = { 0 };
+    lv_coord_t points_max[GUI_SPECTRUM_SWEEP_MAX_CHANNELS]  = { 0 };
+    lv_coord_t points_mean[GUI_SPECTRUM_SWEEP_MAX_CHANNELS] = { 0 };
+    uint8_t    peak_channel                                 = 0;
+    int8_t     noise_floor                                  = INT8_MAX;
+
+    if( ( this->results->nb_channels == 0 ) || ( this->results->nb_sweeps == 0 ) )
+    {
+        return;
+    }
+
+    for( uint8_t channel = 0; channel < this->results->nb_channels; channel++ )
+    {
+        points_max[channel]  = this->results->rssi_max[channel];
+        points_mean[channel] = this->results->rssi_mean[channel];
+
+        if( this->results->rssi_max[channel] > this->results->rssi_max[peak_channel] )
+        {
+            peak_channel = channel;
+        }
+        if( this->results->rssi_mean[channel] < noise_floor )
+        {
+            noise_floor = this->results->rssi_mean[channel];
+        }
+    }
+
+    lv_chart_set_point_count( this->chart, this->results->nb_channels );
+    lv_chart_set_points( this->chart, this->series_max, points_max );
+    lv_chart_set_points( this->chart, this->series_mean, points_mean );
+
+    snprintf( buffer, TMP_BUFFER_REFRESH_LENGTH, "Sweeps = %u", this->results->nb_sweeps );
+    lv_label_set_text( this->lbl_info_frame_1, buffer );
+
+    const uint32_t peak_frequency_khz =
+        ( this->results->start_frequency_hz + peak_channel * this->results->step_frequency_hz ) / 1000;
+    snprintf( buffer, TMP_BUFFER_REFRESH_LENGTH, "Peak %i dBm @ %u.%03u MHz", this->results->rssi_max[peak_channel],
+              ( unsigned int )( peak_frequency_khz / 1000 ), ( unsigned int )( peak_frequency_khz % 1000 ) );
+    lv_label_set_text( this->lbl_info_frame_2, buffer );
+
+    snprintf( buffer, TMP_BUFFER_REFRESH_LENGTH, "Floor %i dBm", noise_floor );
+    lv_label_set_text( this->lbl_info_frame_3, buffer );
+}
+
+void GuiRadioSpectrumSweep::callback( lv_obj_t* obj, lv_event_t event )
+{
+    GuiRadioSpectrumSweep* self = ( GuiRadioSpectrumSweep* ) lv_obj_get_user_data( obj );
+
+    if( ( event == LV_EVENT_RELEASED ) && ( lv_btn_get_state( obj ) != LV_BTN_STATE_INA ) )
+    {
+        if( obj == self->btn_start )
+        {
+            lv_obj_set_hidden( self->btn_start, true );
+            lv_obj_set_hidden( self->btn_stop, false );
+            GuiCommon::_event = GUI_EVENT_START_SPECTRUM_SWEEP;
+        }
+        else if( obj == self->btn_stop )
+        {
+            lv_obj_set_hidden( self->btn_start, false );
+            lv_obj_set_hidden( self->btn_stop, true );
+            GuiCommon::_event = GUI_EVENT_STOP;
+        }
+        else if( obj == self->btn_back )
+        {
+            GuiCommon::_event = GUI_EVENT_BACK;
+        }
+    }
+}
@@ -33,6 +33,10 @@
 
 #define TMP_BUFFER_CHANNEL_RESULTS_LENGTH ( 25 )
 
+#define GUI_RESULTS_WIFI_COL_MAC_ADDRESS_WIDTH ( 150 )
+#define GUI_RESULTS_WIFI_COL_RSSI_WIDTH ( 80 )
+#define GUI_RESULTS_WIFI_RSSI_NONE ( INT16_MAX )
+
 GuiResultsWifi::GuiResultsWifi( const GuiWifiResult_t* results )
     : GuiCommon( GUI_PAGE_WIFI_RESULTS ), _results( results ), _current_chan( NULL )
 {
@@ -46,14 +50,7 @@ GuiResultsWifi::GuiResultsWifi( const GuiWifiResult_t* results )
     lv_obj_set_width( this->lbl_info_page, 240 );
     lv_obj_align( this->lbl_info_page, NULL, LV_ALIGN_IN_TOP_MID, 0, 50 );
 
-    this->table = lv_table_create( this->screen, NULL );
-    lv_table_set_style( this->table, LV_TABLE_STYLE_CELL1, &( GuiCommon::table_cell1 ) );
-    lv_table_set_style( this->table, LV_TABLE_STYLE_BG, &lv_style_transp_tight );
-    lv_table_set_col_cnt( this->table, 2 );
-    lv_table_set_row_cnt( this->table, 6 );
-    lv_table_set_col_width( this->table, 0, 150 );
-    lv_table_set_col_width( this->table, 1, 80 );
-    lv_obj_align( this->table, NULL, LV_ALIGN_IN_TOP_MID, 0, 80 );
+    this->createRows( );
 
     this->findAndDisplayFirstNonEmptyChannel( );
 
@@ -89,18 +86,101 @@ void GuiResultsWifi::setChannelResults( )
         snprintf( buffer, TMP_BUFFER_CHANNEL_RESULTS_LENGTH, "Wi-Fi G Ch%i", ( this->_index + 1 ) % GUI_WIFI_CHANNELS );
     }
 
-    lv_label_set_text( this->lbl_info_page, buffer );
+    if( strcmp( lv_label_get_text( this->lbl_info_page ), buffer ) != 0 )
+    {
+        lv_label_set_text( this->lbl_info_page, buffer );
+    }
+
+    // Only the cells whose content changes are invalidated, so only those are redrawn
+    for( uint8_t index = 0; index < GUI_MAX_WIFI_MAC_ADDRESSES; index++ )
+    {
+        if( index < this->_current_chan->nbMacAddr )
+        {
+            this->updateRow( &this->_rows[index], &this->_current_chan->data[index] );
+            GuiResultsWifi::setRowDisplayed( &this->_rows[index], true );
+        }
+        else
+        {
+            GuiResultsWifi::setRowDisplayed( &this->_rows[index], false );
+        }
+    }
+}
+
+void GuiResultsWifi::createRows( )
+{
+    const lv_style_t* cell_style = &( GuiCommon::table_cell1 );
+    const lv_coord_t  row_height = lv_font_get_line_height( cell_style->text.font ) + cell_style->body.padding.top +
+                                  cell_style->body.padding.bottom;
+
+    this->table = lv_obj_create( this->screen, NULL );
+    lv_obj_set_style( this->table, &lv_style_transp_tight );
+    lv_obj_set_size( this->table, GUI_RESULTS_WIFI_COL_MAC_ADDRESS_WIDTH + GUI_RESULTS_WIFI_COL_RSSI_WIDTH,
+                     row_height * GUI_MAX_WIFI_MAC_ADDRESSES );
+    lv_obj_align( this->table, NULL, LV_ALIGN_IN_TOP_MID, 0, 80 );
+
+    for( uint8_t index = 0; index < GUI_MAX_WIFI_MAC_ADDRESSES; index++ )
+    {
+        GuiResultsWifiRow_t* row = &this->_rows[index];
+
+        row->cell_mac_address = lv_obj_create( this->table, NULL );
+        lv_obj_set_style( row->cell_mac_address, cell_style );
+        lv_obj_set_size( row->cell_mac_address, GUI_RESULTS_WIFI_COL_MAC_ADDRESS_WIDTH, row_height );
+        lv_obj_set_pos( row->cell_mac_address, 0, index * row_height );
+
+        row->cell_rssi = lv_obj_create( this->table, row->cell_mac_address );
+        lv_obj_set_size( row->cell_rssi, GUI_RESULTS_WIFI_COL_RSSI_WIDTH, row_height );
+        lv_obj_set_pos( row->cell_rssi, GUI_RESULTS_WIFI_COL_MAC_ADDRESS_WIDTH, index * row_height );
+
+        row->mac_address[0] = '\0';
+        row->rssi           = GUI_RESULTS_WIFI_RSSI_NONE;
+        row->rssi_text[0]   = '\0';
+        row->is_displayed   = false;
 
-    lv_table_set_row_cnt( this->table, this->_current_chan->nbMacAddr );
+        row->lbl_mac_address = lv_label_create( row->cell_mac_address, NULL );
+        lv_label_set_long_mode( row->lbl_mac_address, LV_LABEL_LONG_CROP );
+        lv_label_set_align( row->lbl_mac_address, LV_LABEL_ALIGN_LEFT );
+        lv_label_set_static_text( row->lbl_mac_address, row->mac_address );
+        lv_obj_set_width( row->lbl_mac_address, GUI_RESULTS_WIFI_COL_MAC_ADDRESS_WIDTH -
+                                                    cell_style->body.padding.left - cell_style->body.padding.right );
+        lv_obj_set_pos( row->lbl_mac_address, cell_style->body.padding.left, cell_style->body.padding.top );
+
+        row->lbl_rssi = lv_label_create( row->cell_rssi, NULL );
+        lv_label_set_long_mode( row->lbl_rssi, LV_LABEL_LONG_CROP );
+        lv_label_set_align( row->lbl_rssi, LV_LABEL_ALIGN_RIGHT );
+        lv_label_set_static_text( row->lbl_rssi, row->rssi_text );
+        lv_obj_set_width( row->lbl_rssi, GUI_RESULTS_WIFI_COL_RSSI_WIDTH - cell_style->body.padding.left -
+                                             cell_style->body.padding.right );
+        lv_obj_set_pos( row->lbl_rssi, cell_style->body.padding.left, cell_style->body.padding.top );
+
+        lv_obj_set_hidden( row->cell_mac_address, true );
+        lv_obj_set_hidden( row->cell_rssi, true );
+    }
+}
 
-    for( uint8_t index = 0; index < this->_current_chan->nbMacAddr; index++ )
+void GuiResultsWifi::updateRow( GuiResultsWifiRow_t* row, const GuiWifiResultData_t* data )
+{
+    if( strncmp( row->mac_address, data->macAddr, GUI_WIFI_STRING_LENGTH ) != 0 )
+    {
+        strncpy( row->mac_address, data->macAddr, GUI_WIFI_STRING_LENGTH - 1 );
+        row->mac_address[GUI_WIFI_STRING_LENGTH - 1] = '\0';
+        lv_label_set_static_text( row->lbl_mac_address, row->mac_address );
+    }
+
+    if( row->rssi != data->rssi )
     {
-        lv_table_set_cell_value( this->table, index, 0, this->_current_chan->data[index].macAddr );
-        lv_table_set_cell_align( this->table, index, 0, LV_LABEL_ALIGN_LEFT );
+        row->rssi = data->rssi;
+        snprintf( row->rssi_text, GUI_RESULTS_WIFI_RSSI_LENGTH, "%idBm", data->rssi );
+        lv_label_set_static_text( row->lbl_rssi, row->rssi_text );
+    }
+}
 
-        snprintf( buffer, TMP_BUFFER_CHANNEL_RESULTS_LENGTH, "%idBm", this->_current_chan->data[index].rssi );
-        lv_table_set_cell_value( this->table, index, 1, buffer );
-        lv_table_set_cell_align( this->table, index, 1, LV_LABEL_ALIGN_RIGHT );
+void GuiResultsWifi::setRowDisplayed( GuiResultsWifiRow_t* row, bool is_displayed )
+{
+    if( row->is_displayed != is_displayed )
+    {
+        row->is_displayed = is_displayed;
+        lv_obj_set_hidden( row->cell_mac_address, !is_displayed );
+        lv_obj_set_hidden( row->cell_rssi, !is_displayed );
     }
 }
 
@@ -0,0 +1,1232 @@
+/*
+ * Glyph subset of lv_font_roboto_16.c generated by gui/tools/lv_font_subset.py.
+ * Do not edit: regenerated by the build when the strings of the GUI change.
+ * Letters:
+ *   0x20 0x21 0x22 0x23 0x24 0x25 0x26 0x27 0x28 0x29 0x2A 0x2B 0x2C 0x2D 0x2E 0x2F
+ *   0x30 0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39 0x3A 0x3B 0x3C 0x3D 0x3E 0x3F
+ *   0x40 0x41 0x42 0x43 0x44 0x45 0x46 0x47 0x48 0x49 0x4A 0x4B 0x4C 0x4D 0x4E 0x4F
+ *   0x50 0x51 0x52 0x53 0x54 0x55 0x56 0x57 0x58 0x59 0x5A 0x5B 0x5C 0x5D 0x5E 0x5F
+ *   0x60 0x61 0x62 0x63 0x64 0x65 0x66 0x67 0x68 0x69 0x6A 0x6B 0x6C 0x6D 0x6E 0x6F
+ *   0x70 0x71 0x72 0x73 0x74 0x75 0x76 0x77 0x78 0x79 0x7A 0x7B 0x7C 0x7D 0x7E 0xF00C
+ *   0xF00D 0xF053 0xF054 0xF078 0xF0E7 0xF1EB 0xF55A 0xF8A2
+ */
+
+#include "lvgl.h"
+#include "lv_port_font_subset.h"
+
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+20 " " */
+
+    /* U+21 "!" */
+    0xad, 0xac, 0xac, 0xac, 0xac, 0xac, 0x9b, 0x9b,
+    0x56, 0x0, 0x57, 0x8c,
+
+    /* U+22 "\"" */
+    0xe2, 0xd4, 0xe2, 0xd3, 0xe0, 0xd2, 0xe0, 0xd1,
+    0x0, 0x0,
+
+    /* U+23 "#" */
+    0x0, 0x1, 0xf0, 0xe, 0x30, 0x0, 0x4, 0xc0,
+    0x2f, 0x0, 0x0, 0x8, 0x90, 0x5c, 0x0, 0xd,
+    0xff, 0xff, 0xff, 0xf4, 0x1, 0x2e, 0x42, 0xc7,
+    0x20, 0x0, 0x1f, 0x0, 0xe3, 0x0, 0x0, 0x4d,
+    0x1, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xa0,
+    0x12, 0xb8, 0x28, 0xb2, 0x10, 0x0, 0xc4, 0xa,
+    0x70, 0x0, 0x0, 0xf2, 0xc, 0x50, 0x0, 0x1,
+    0xf0, 0xf, 0x20, 0x0,
+
+    /* U+24 "$" */
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0xe, 0x40,
+    0x0, 0x0, 0x2, 0xe6, 0x0, 0x0, 0xa, 0xff,
+    0xfc, 0x10, 0x6, 0xf5, 0x4, 0xfa, 0x0, 0xac,
+    0x0, 0x8, 0xe0, 0x9, 0xe0, 0x0, 0x26, 0x0,
+    0x3f, 0xb3, 0x0, 0x0, 0x0, 0x3c, 0xfd, 0x50,
+    0x0, 0x0, 0x3, 0xaf, 0x70, 0x1, 0x0, 0x0,
+    0x9f, 0x0, 0xf6, 0x0, 0x5, 0xf1, 0xc, 0xd1,
+    0x1, 0xce, 0x0, 0x3e, 0xfe, 0xfe, 0x40, 0x0,
+    0x5, 0xf6, 0x10, 0x0, 0x0, 0xf, 0x20, 0x0,
+
+    /* U+25 "%" */
+    0x5, 0xde, 0x80, 0x0, 0x0, 0x0, 0xf, 0x31,
+    0xd4, 0x0, 0x70, 0x0, 0x2e, 0x0, 0x97, 0x8,
+    0x90, 0x0, 0xf, 0x31, 0xd5, 0x2e, 0x10, 0x0,
+    0x5, 0xde, 0x80, 0xb5, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0x29,
+    0xec, 0x20, 0x0, 0x0, 0x98, 0x6c, 0x17, 0xc0,
+    0x0, 0x3, 0xe0, 0x97, 0x1, 0xf0, 0x0, 0xd,
+    0x50, 0x97, 0x1, 0xf0, 0x0, 0x19, 0x0, 0x6c,
+    0x7, 0xc0, 0x0, 0x0, 0x0, 0x9, 0xfc, 0x20,
+
+    /* U+26 "&" */
+    0x0, 0x3c, 0xfc, 0x30, 0x0, 0x0, 0xeb, 0x4a,
+    0xe0, 0x0, 0x3, 0xf3, 0x1, 0xf3, 0x0, 0x2,
+    0xf5, 0x6, 0xf1, 0x0, 0x0, 0xbd, 0x8f, 0x50,
+    0x0, 0x0, 0x3f, 0xf4, 0x0, 0x0, 0x3, 0xec,
+    0xf8, 0x0, 0x71, 0xd, 0xc0, 0x7f, 0x42, 0xf1,
+    0x2f, 0x40, 0xa, 0xf9, 0xe0, 0x1f, 0x60, 0x0,
+    0xcf, 0x70, 0xa, 0xe4, 0x15, 0xef, 0xb0, 0x0,
+    0x8d, 0xfe, 0x95, 0xf8,
+
+    /* U+27 "'" */
+    0x3f, 0x3f, 0x3e, 0x2c,
+
+    /* U+28 "(" */
+    0x0, 0x2, 0x0, 0x3, 0xe1, 0x1, 0xe5, 0x0,
+    0x9b, 0x0, 0x1f, 0x40, 0x6, 0xe0, 0x0, 0xab,
+    0x0, 0xd, 0x90, 0x0, 0xe8, 0x0, 0xe, 0x70,
+    0x0, 0xd8, 0x0, 0xc, 0xa0, 0x0, 0x8d, 0x0,
+    0x3, 0xf1, 0x0, 0xd, 0x70, 0x0, 0x4e, 0x10,
+    0x0, 0x9b, 0x0, 0x0, 0x80,
+
+    /* U+29 ")" */
+    0x20, 0x0, 0x8, 0xa0, 0x0, 0xd, 0x70, 0x0,
+    0x4f, 0x10, 0x0, 0xd8, 0x0, 0x8, 0xe0, 0x0,
+    0x4f, 0x20, 0x1, 0xf4, 0x0, 0xf, 0x60, 0x0,
+    0xf6, 0x0, 0x1f, 0x50, 0x3, 0xf3, 0x0, 0x5f,
+    0x0, 0xa, 0xb0, 0x0, 0xf4, 0x0, 0x8b, 0x0,
+    0x4e, 0x20, 0x6, 0x20, 0x0,
+
+    /* U+2A "*" */
+    0x0, 0x1f, 0x0, 0x0, 0x1, 0xf0, 0x0, 0x9b,
+    0x6f, 0x5b, 0x73, 0x8d, 0xfd, 0x83, 0x0, 0xde,
+    0xa0, 0x0, 0x9c, 0x1f, 0x50, 0x7, 0x30, 0x66,
+    0x0,
+
+    /* U+2B "+" */
+    0x0, 0x2, 0xa2, 0x0, 0x0, 0x0, 0x3f, 0x30,
+    0x0, 0x0, 0x3, 0xf3, 0x0, 0x0, 0x11, 0x4f,
+    0x51, 0x10, 0x6f, 0xff, 0xff, 0xff, 0x61, 0x44,
+    0x7f, 0x74, 0x41, 0x0, 0x3, 0xf3, 0x0, 0x0,
+    0x0, 0x3f, 0x30, 0x0, 0x0, 0x3, 0xf3, 0x0,
+    0x0,
+
+    /* U+2C "," */
+    0xf, 0x60, 0xf5, 0x4f, 0x28, 0x90, 0x0, 0x0,
+
+    /* U+2D "-" */
+    0x0, 0x0, 0xb, 0xff, 0xf1, 0x23, 0x33, 0x0,
+
+    /* U+2E "." */
+    0x88, 0xab,
+
+    /* U+2F "/" */
+    0x0, 0x0, 0x4e, 0x0, 0x0, 0xa, 0x90, 0x0,
+    0x0, 0xf3, 0x0, 0x0, 0x6d, 0x0, 0x0, 0xc,
+    0x70, 0x0, 0x2, 0xf1, 0x0, 0x0, 0x7c, 0x0,
+    0x0, 0xd, 0x60, 0x0, 0x3, 0xf0, 0x0, 0x0,
+    0x9a, 0x0, 0x0, 0xe, 0x40, 0x0, 0x5, 0xe0,
+    0x0, 0x0, 0xa9, 0x0, 0x0, 0x0,
+
+    /* U+30 "0" */
+    0x0, 0x7d, 0xfd, 0x60, 0x0, 0x5f, 0x84, 0x9f,
+    0x50, 0xc, 0xb0, 0x0, 0xbc, 0x0, 0xf7, 0x0,
+    0x7, 0xf0, 0x1f, 0x50, 0x0, 0x5f, 0x1, 0xf5,
+    0x0, 0x5, 0xf1, 0x1f, 0x50, 0x0, 0x5f, 0x11,
+    0xf5, 0x0, 0x6, 0xf0, 0xf, 0x70, 0x0, 0x7f,
+    0x0, 0xcc, 0x0, 0xc, 0xb0, 0x5, 0xf9, 0x49,
+    0xf5, 0x0, 0x6, 0xdf, 0xd6, 0x0,
+
+    /* U+31 "1" */
+    0x0, 0x39, 0xa5, 0xdf, 0xfb, 0x99, 0x2c, 0xb0,
+    0x0, 0xcb, 0x0, 0xc, 0xb0, 0x0, 0xcb, 0x0,
+    0xc, 0xb0, 0x0, 0xcb, 0x0, 0xc, 0xb0, 0x0,
+    0xcb, 0x0, 0xc, 0xb0, 0x0, 0xcb,
+
+    /* U+32 "2" */
+    0x0, 0x7e, 0xfd, 0x60, 0x0, 0x9f, 0x74, 0x9f,
+    0x60, 0x1f, 0x60, 0x0, 0xcc, 0x2, 0xa2, 0x0,
+    0x9, 0xd0, 0x0, 0x0, 0x0, 0xd9, 0x0, 0x0,
+    0x0, 0x7f, 0x10, 0x0, 0x0, 0x4f, 0x60, 0x0,
+    0x0, 0x2f, 0x90, 0x0, 0x0, 0x1e, 0xa0, 0x0,
+    0x0, 0xc, 0xc0, 0x0, 0x0, 0xa, 0xf4, 0x33,
+    0x33, 0x10, 0xff, 0xff, 0xff, 0xf6,
+
+    /* U+33 "3" */
+    0x0, 0x8d, 0xfd, 0x50, 0xa, 0xe6, 0x48, 0xf5,
+    0xf, 0x60, 0x0, 0xca, 0x1, 0x0, 0x0, 0xbb,
+    0x0, 0x0, 0x16, 0xf4, 0x0, 0xf, 0xff, 0x60,
+    0x0, 0x3, 0x49, 0xf4, 0x0, 0x0, 0x0, 0xbc,
+    0x16, 0x10, 0x0, 0x8e, 0x2f, 0x60, 0x0, 0xbc,
+    0xa, 0xe6, 0x48, 0xf4, 0x0, 0x8d, 0xfc, 0x50,
+
+    /* U+34 "4" */
+    0x0, 0x0, 0xc, 0xf0, 0x0, 0x0, 0x6, 0xff,
+    0x0, 0x0, 0x1, 0xec, 0xf0, 0x0, 0x0, 0xac,
+    0x6f, 0x0, 0x0, 0x3f, 0x26, 0xf0, 0x0, 0xd,
+    0x80, 0x6f, 0x0, 0x7, 0xe0, 0x6, 0xf0, 0x1,
+    0xf5, 0x0, 0x6f, 0x0, 0x8f, 0xff, 0xff, 0xff,
+    0xa1, 0x33, 0x33, 0x8f, 0x32, 0x0, 0x0, 0x6,
+    0xf0, 0x0, 0x0, 0x0, 0x6f, 0x0,
+
+    /* U+35 "5" */
+    0xd, 0xff, 0xff, 0xf0, 0xf, 0xa6, 0x66, 0x60,
+    0x1f, 0x40, 0x0, 0x0, 0x2f, 0x20, 0x0, 0x0,
+    0x4f, 0xcf, 0xfa, 0x10, 0x4f, 0x84, 0x8f, 0xb0,
+    0x0, 0x0, 0x7, 0xf2, 0x0, 0x0, 0x2, 0xf4,
+    0x43, 0x0, 0x2, 0xf4, 0x9d, 0x0, 0x6, 0xf1,
+    0x2f, 0xa4, 0x6f, 0xa0, 0x4, 0xcf, 0xe8, 0x0,
+
+    /* U+36 "6" */
+    0x0, 0x2a, 0xe9, 0x0, 0x5, 0xfc, 0x63, 0x0,
+    0x1f, 0x80, 0x0, 0x0, 0x7e, 0x0, 0x0, 0x0,
+    0xbb, 0xbf, 0xf9, 0x0, 0xef, 0xa4, 0x7f, 0x80,
+    0xfb, 0x0, 0x8, 0xf0, 0xf8, 0x0, 0x4, 0xf2,
+    0xd9, 0x0, 0x4, 0xf2, 0x9e, 0x0, 0x8, 0xe0,
+    0x1e, 0xc5, 0x7f, 0x70, 0x2, 0xcf, 0xe7, 0x0,
+
+    /* U+37 "7" */
+    0x6f, 0xff, 0xff, 0xff, 0x41, 0x33, 0x33, 0x38,
+    0xf1, 0x0, 0x0, 0x0, 0xc9, 0x0, 0x0, 0x0,
+    0x3f, 0x20, 0x0, 0x0, 0xa, 0xb0, 0x0, 0x0,
+    0x1, 0xf5, 0x0, 0x0, 0x0, 0x8e, 0x0, 0x0,
+    0x0, 0xe, 0x70, 0x0, 0x0, 0x6, 0xf1, 0x0,
+    0x0, 0x0, 0xda, 0x0, 0x0, 0x0, 0x4f, 0x30,
+    0x0, 0x0, 0xb, 0xc0, 0x0, 0x0,
+
+    /* U+38 "8" */
+    0x0, 0x6d, 0xfd, 0x60, 0x0, 0x6f, 0x84, 0x8f,
+    0x60, 0xc, 0xb0, 0x0, 0xbb, 0x0, 0xca, 0x0,
+    0xa, 0xc0, 0x6, 0xf4, 0x4, 0xf6, 0x0, 0x9,
+    0xff, 0xf9, 0x0, 0x5, 0xf7, 0x48, 0xf5, 0x0,
+    0xe8, 0x0, 0x9, 0xe0, 0x1f, 0x50, 0x0, 0x5f,
+    0x10, 0xf8, 0x0, 0x8, 0xf0, 0x8, 0xf7, 0x47,
+    0xf7, 0x0, 0x7, 0xdf, 0xd7, 0x0,
+
+    /* U+39 "9" */
+    0x0, 0x6e, 0xfc, 0x30, 0x7, 0xf8, 0x5c, 0xf1,
+    0xe, 0x90, 0x1, 0xf8, 0x2f, 0x40, 0x0, 0xac,
+    0x2f, 0x30, 0x0, 0x8e, 0xf, 0x70, 0x0, 0xae,
+    0xa, 0xe4, 0x17, 0xfe, 0x1, 0xcf, 0xfc, 0xab,
+    0x0, 0x2, 0x20, 0xc8, 0x0, 0x0, 0x5, 0xf2,
+    0x0, 0x25, 0xaf, 0x60, 0x0, 0x9e, 0xb4, 0x0,
+
+    /* U+3A ":" */
+    0xba, 0x87, 0x0, 0x0, 0x0, 0x0, 0x0, 0x97,
+    0xba,
+
+    /* U+3B ";" */
+    0xe, 0x70, 0xa5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa5, 0xe, 0x71, 0xf5, 0x7d,
+    0x1, 0x20,
+
+    /* U+3C "<" */
+    0x0, 0x0, 0x4, 0xb0, 0x0, 0x4c, 0xfc, 0x5,
+    0xcf, 0xb4, 0x6, 0xfa, 0x20, 0x0, 0x2c, 0xfa,
+    0x30, 0x0, 0x4, 0xbf, 0xc5, 0x0, 0x0, 0x3b,
+    0xf0, 0x0, 0x0, 0x2,
+
+    /* U+3D "=" */
+    0x1, 0x11, 0x11, 0xd, 0xff, 0xff, 0xfb, 0x34,
+    0x44, 0x44, 0x20, 0x11, 0x11, 0x10, 0xdf, 0xff,
+    0xff, 0xb3, 0x33, 0x33, 0x32,
+
+    /* U+3E ">" */
+    0xb4, 0x0, 0x0, 0xb, 0xfd, 0x50, 0x0, 0x2,
+    0x9f, 0xe7, 0x0, 0x0, 0x7, 0xfb, 0x0, 0x39,
+    0xfd, 0x55, 0xcf, 0xc5, 0x0, 0xfb, 0x40, 0x0,
+    0x2, 0x0, 0x0, 0x0,
+
+    /* U+3F "?" */
+    0x3, 0xbf, 0xe8, 0x1, 0xec, 0x57, 0xf8, 0x4e,
+    0x10, 0xa, 0xd0, 0x0, 0x0, 0x9d, 0x0, 0x0,
+    0x1e, 0x80, 0x0, 0xc, 0xd0, 0x0, 0xa, 0xe2,
+    0x0, 0x1, 0xf6, 0x0, 0x0, 0x19, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x19, 0x20, 0x0, 0x2,
+    0xe4, 0x0,
+
+    /* U+40 "@" */
+    0x0, 0x0, 0x3a, 0xef, 0xeb, 0x40, 0x0, 0x0,
+    0x7, 0xe7, 0x31, 0x26, 0xe8, 0x0, 0x0, 0x6e,
+    0x20, 0x0, 0x0, 0xc, 0x50, 0x1, 0xf3, 0x0,
+    0x8e, 0xc5, 0x2, 0xe0, 0x7, 0xb0, 0x8, 0xc3,
+    0x7e, 0x0, 0xc3, 0xc, 0x50, 0x1f, 0x30, 0x5c,
+    0x0, 0x96, 0xf, 0x20, 0x6d, 0x0, 0x6b, 0x0,
+    0x78, 0x1f, 0x0, 0x9a, 0x0, 0x8a, 0x0, 0x78,
+    0x1f, 0x0, 0xb8, 0x0, 0x99, 0x0, 0x87, 0xf,
+    0x20, 0xa9, 0x0, 0xc8, 0x0, 0xc3, 0xd, 0x50,
+    0x6d, 0x15, 0xec, 0x6, 0xc0, 0x7, 0xc0, 0xb,
+    0xf9, 0x1c, 0xfb, 0x10, 0x0, 0xe7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3e, 0xa3, 0x10, 0x34,
+    0x0, 0x0, 0x0, 0x1, 0x8d, 0xff, 0xc6, 0x0,
+    0x0,
+
+    /* U+41 "A" */
+    0x0, 0x0, 0x9f, 0x10, 0x0, 0x0, 0x0, 0xf,
+    0xf6, 0x0, 0x0, 0x0, 0x5, 0xfb, 0xc0, 0x0,
+    0x0, 0x0, 0xbb, 0x4f, 0x20, 0x0, 0x0, 0x1f,
+    0x60, 0xf8, 0x0, 0x0, 0x6, 0xf1, 0xa, 0xd0,
+    0x0, 0x0, 0xcc, 0x0, 0x5f, 0x30, 0x0, 0x2f,
+    0x70, 0x1, 0xf9, 0x0, 0x8, 0xff, 0xff, 0xff,
+    0xe0, 0x0, 0xdc, 0x33, 0x33, 0x6f, 0x50, 0x3f,
+    0x50, 0x0, 0x0, 0xeb, 0x9, 0xe0, 0x0, 0x0,
+    0x8, 0xf1,
+
+    /* U+42 "B" */
+    0xaf, 0xff, 0xfc, 0x50, 0xa, 0xe4, 0x45, 0xaf,
+    0x50, 0xad, 0x0, 0x0, 0xdb, 0xa, 0xd0, 0x0,
+    0xd, 0xb0, 0xad, 0x0, 0x17, 0xf4, 0xa, 0xff,
+    0xff, 0xf8, 0x0, 0xad, 0x33, 0x48, 0xf6, 0xa,
+    0xd0, 0x0, 0xa, 0xe0, 0xad, 0x0, 0x0, 0x7f,
+    0xa, 0xd0, 0x0, 0xa, 0xe0, 0xae, 0x44, 0x59,
+    0xf7, 0xa, 0xff, 0xff, 0xd6, 0x0,
+
+    /* U+43 "C" */
+    0x0, 0x8, 0xdf, 0xe8, 0x0, 0x0, 0xcf, 0x75,
+    0x7f, 0xb0, 0x7, 0xf3, 0x0, 0x4, 0xf4, 0xd,
+    0xb0, 0x0, 0x0, 0xd8, 0xf, 0x80, 0x0, 0x0,
+    0x0, 0xf, 0x70, 0x0, 0x0, 0x0, 0xf, 0x70,
+    0x0, 0x0, 0x0, 0xf, 0x80, 0x0, 0x0, 0x0,
+    0xd, 0xb0, 0x0, 0x0, 0xc7, 0x7, 0xf3, 0x0,
+    0x4, 0xf5, 0x0, 0xcf, 0x75, 0x7e, 0xb0, 0x0,
+    0x9, 0xef, 0xe8, 0x0,
+
+    /* U+44 "D" */
+    0xaf, 0xff, 0xe9, 0x10, 0xa, 0xe4, 0x46, 0xde,
+    0x20, 0xad, 0x0, 0x0, 0xdc, 0xa, 0xd0, 0x0,
+    0x5, 0xf3, 0xad, 0x0, 0x0, 0x1f, 0x7a, 0xd0,
+    0x0, 0x0, 0xf8, 0xad, 0x0, 0x0, 0xf, 0x8a,
+    0xd0, 0x0, 0x1, 0xf7, 0xad, 0x0, 0x0, 0x5f,
+    0x3a, 0xd0, 0x0, 0x1d, 0xd0, 0xae, 0x44, 0x6e,
+    0xe2, 0xa, 0xff, 0xfe, 0x91, 0x0,
+
+    /* U+45 "E" */
+    0xaf, 0xff, 0xff, 0xf7, 0xae, 0x44, 0x44, 0x42,
+    0xad, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0, 0x0,
+    0xad, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xc0,
+    0xad, 0x33, 0x33, 0x20, 0xad, 0x0, 0x0, 0x0,
+    0xad, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0, 0x0,
+    0xae, 0x44, 0x44, 0x42, 0xaf, 0xff, 0xff, 0xf8,
+
+    /* U+46 "F" */
+    0xaf, 0xff, 0xff, 0xf6, 0xae, 0x44, 0x44, 0x41,
+    0xad, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0, 0x0,
+    0xad, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0x90, 0xad, 0x33, 0x33, 0x20,
+    0xad, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0, 0x0,
+    0xad, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0, 0x0,
+
+    /* U+47 "G" */
+    0x0, 0x8, 0xef, 0xe9, 0x0, 0x0, 0xce, 0x75,
+    0x7e, 0xc0, 0x7, 0xf3, 0x0, 0x3, 0xf6, 0xc,
+    0xc0, 0x0, 0x0, 0x75, 0xf, 0x90, 0x0, 0x0,
+    0x0, 0xf, 0x70, 0x0, 0x0, 0x0, 0xf, 0x70,
+    0x6, 0xff, 0xfb, 0xf, 0x90, 0x1, 0x33, 0xdb,
+    0xc, 0xd0, 0x0, 0x0, 0xcb, 0x6, 0xf5, 0x0,
+    0x0, 0xcb, 0x0, 0xbf, 0x84, 0x5a, 0xf7, 0x0,
+    0x7, 0xdf, 0xfc, 0x50,
+
+    /* U+48 "H" */
+    0xad, 0x0, 0x0, 0x7, 0xf1, 0xad, 0x0, 0x0,
+    0x7, 0xf1, 0xad, 0x0, 0x0, 0x7, 0xf1, 0xad,
+    0x0, 0x0, 0x7, 0xf1, 0xad, 0x0, 0x0, 0x7,
+    0xf1, 0xaf, 0xff, 0xff, 0xff, 0xf1, 0xad, 0x33,
+    0x33, 0x39, 0xf1, 0xad, 0x0, 0x0, 0x7, 0xf1,
+    0xad, 0x0, 0x0, 0x7, 0xf1, 0xad, 0x0, 0x0,
+    0x7, 0xf1, 0xad, 0x0, 0x0, 0x7, 0xf1, 0xad,
+    0x0, 0x0, 0x7, 0xf1,
+
+    /* U+49 "I" */
+    0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f, 0x9f,
+    0x9f, 0x9f, 0x9f, 0x9f,
+
+    /* U+4A "J" */
+    0x0, 0x0, 0x0, 0xe9, 0x0, 0x0, 0x0, 0xe9,
+    0x0, 0x0, 0x0, 0xe9, 0x0, 0x0, 0x0, 0xe9,
+    0x0, 0x0, 0x0, 0xe9, 0x0, 0x0, 0x0, 0xe9,
+    0x0, 0x0, 0x0, 0xe9, 0x0, 0x0, 0x0, 0xe9,
+    0x36, 0x0, 0x0, 0xe9, 0x7f, 0x10, 0x2, 0xf7,
+    0x1e, 0xc5, 0x5d, 0xe1, 0x3, 0xbe, 0xea, 0x20,
+
+    /* U+4B "K" */
+    0xad, 0x0, 0x0, 0x8f, 0x40, 0xad, 0x0, 0x6,
+    0xf6, 0x0, 0xad, 0x0, 0x4f, 0x90, 0x0, 0xad,
+    0x2, 0xfb, 0x0, 0x0, 0xad, 0x1d, 0xd0, 0x0,
+    0x0, 0xad, 0xcf, 0x60, 0x0, 0x0, 0xaf, 0xfc,
+    0xf2, 0x0, 0x0, 0xaf, 0x41, 0xec, 0x0, 0x0,
+    0xad, 0x0, 0x4f, 0x80, 0x0, 0xad, 0x0, 0x8,
+    0xf4, 0x0, 0xad, 0x0, 0x0, 0xce, 0x10, 0xad,
+    0x0, 0x0, 0x2f, 0xa0,
+
+    /* U+4C "L" */
+    0xad, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0, 0x0,
+    0xad, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0, 0x0,
+    0xad, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0, 0x0,
+    0xad, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0, 0x0,
+    0xad, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0, 0x0,
+    0xae, 0x44, 0x44, 0x40, 0xaf, 0xff, 0xff, 0xf3,
+
+    /* U+4D "M" */
+    0xaf, 0x70, 0x0, 0x0, 0x7, 0xfa, 0xaf, 0xd0,
+    0x0, 0x0, 0xd, 0xfa, 0xae, 0xf3, 0x0, 0x0,
+    0x3f, 0xea, 0xab, 0xd9, 0x0, 0x0, 0xac, 0xca,
+    0xab, 0x7e, 0x0, 0x0, 0xf6, 0xca, 0xac, 0x1f,
+    0x50, 0x6, 0xf1, 0xca, 0xac, 0xb, 0xb0, 0xc,
+    0xa0, 0xda, 0xad, 0x5, 0xf1, 0x2f, 0x40, 0xda,
+    0xad, 0x0, 0xe7, 0x8e, 0x0, 0xda, 0xad, 0x0,
+    0x8d, 0xe8, 0x0, 0xda, 0xad, 0x0, 0x2f, 0xf2,
+    0x0, 0xda, 0xad, 0x0, 0xc, 0xb0, 0x0, 0xda,
+
+    /* U+4E "N" */
+    0xaf, 0x20, 0x0, 0x6, 0xf1, 0xaf, 0xc0, 0x0,
+    0x6, 0xf1, 0xaf, 0xf6, 0x0, 0x6, 0xf1, 0xad,
+    0xbe, 0x10, 0x6, 0xf1, 0xad, 0x2f, 0x90, 0x6,
+    0xf1, 0xad, 0x7, 0xf3, 0x6, 0xf1, 0xad, 0x0,
+    0xdd, 0x6, 0xf1, 0xad, 0x0, 0x3f, 0x76, 0xf1,
+    0xad, 0x0, 0x9, 0xf8, 0xf1, 0xad, 0x0, 0x1,
+    0xef, 0xf1, 0xad, 0x0, 0x0, 0x5f, 0xf1, 0xad,
+    0x0, 0x0, 0xb, 0xf1,
+
+    /* U+4F "O" */
+    0x0, 0x8, 0xdf, 0xd8, 0x0, 0x0, 0xc, 0xf8,
+    0x58, 0xfc, 0x0, 0x6, 0xf4, 0x0, 0x4, 0xf6,
+    0x0, 0xcc, 0x0, 0x0, 0xc, 0xc0, 0xf, 0x80,
+    0x0, 0x0, 0x8f, 0x1, 0xf7, 0x0, 0x0, 0x7,
+    0xf1, 0x1f, 0x60, 0x0, 0x0, 0x6f, 0x10, 0xf8,
+    0x0, 0x0, 0x8, 0xf0, 0xc, 0xc0, 0x0, 0x0,
+    0xcc, 0x0, 0x6f, 0x40, 0x0, 0x3f, 0x60, 0x0,
+    0xbf, 0x85, 0x8f, 0xc0, 0x0, 0x0, 0x8d, 0xfe,
+    0x80, 0x0,
+
+    /* U+50 "P" */
+    0xaf, 0xff, 0xfe, 0x80, 0xa, 0xe4, 0x45, 0x8f,
+    0xd0, 0xad, 0x0, 0x0, 0x4f, 0x5a, 0xd0, 0x0,
+    0x0, 0xf7, 0xad, 0x0, 0x0, 0x2f, 0x6a, 0xd0,
+    0x1, 0x3c, 0xf1, 0xaf, 0xff, 0xff, 0xd3, 0xa,
+    0xd3, 0x33, 0x10, 0x0, 0xad, 0x0, 0x0, 0x0,
+    0xa, 0xd0, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0,
+    0x0, 0xa, 0xd0, 0x0, 0x0, 0x0,
+
+    /* U+51 "Q" */
+    0x0, 0x8, 0xef, 0xd7, 0x0, 0x0, 0xc, 0xf8,
+    0x58, 0xfb, 0x0, 0x7, 0xf3, 0x0, 0x5, 0xf5,
+    0x0, 0xdb, 0x0, 0x0, 0xd, 0xb0, 0xf, 0x70,
+    0x0, 0x0, 0x9e, 0x2, 0xf6, 0x0, 0x0, 0x8,
+    0xf0, 0x2f, 0x50, 0x0, 0x0, 0x7f, 0x0, 0xf7,
+    0x0, 0x0, 0x9, 0xe0, 0xd, 0xb0, 0x0, 0x0,
+    0xdb, 0x0, 0x7f, 0x30, 0x0, 0x4f, 0x50, 0x0,
+    0xce, 0x75, 0x8f, 0xb0, 0x0, 0x0, 0x8e, 0xfe,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0x60,
+
+    /* U+52 "R" */
+    0xbf, 0xff, 0xfc, 0x50, 0xb, 0xe4, 0x45, 0xaf,
+    0x70, 0xbd, 0x0, 0x0, 0xbe, 0xb, 0xd0, 0x0,
+    0x7, 0xf0, 0xbd, 0x0, 0x0, 0xaf, 0xb, 0xd0,
+    0x1, 0x6f, 0x80, 0xbf, 0xff, 0xff, 0x80, 0xb,
+    0xd3, 0x37, 0xf3, 0x0, 0xbd, 0x0, 0xd, 0xb0,
+    0xb, 0xd0, 0x0, 0x5f, 0x40, 0xbd, 0x0, 0x0,
+    0xcc, 0xb, 0xd0, 0x0, 0x4, 0xf5,
+
+    /* U+53 "S" */
+    0x0, 0x5c, 0xff, 0xa2, 0x0, 0x6f, 0x95, 0x6c,
+    0xf2, 0xe, 0xa0, 0x0, 0xe, 0xa0, 0xf9, 0x0,
+    0x0, 0x67, 0xa, 0xf5, 0x0, 0x0, 0x0, 0xa,
+    0xfe, 0x93, 0x0, 0x0, 0x3, 0x8e, 0xf9, 0x0,
+    0x0, 0x0, 0x6, 0xf8, 0x29, 0x10, 0x0, 0xa,
+    0xd2, 0xf7, 0x0, 0x0, 0xcc, 0x9, 0xf9, 0x55,
+    0xaf, 0x50, 0x6, 0xcf, 0xec, 0x50,
+
+    /* U+54 "T" */
+    0x9f, 0xff, 0xff, 0xff, 0xf3, 0x24, 0x44, 0xfa,
+    0x44, 0x40, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0xf8, 0x0, 0x0,
+
+    /* U+55 "U" */
+    0xe9, 0x0, 0x0, 0x2f, 0x5e, 0x90, 0x0, 0x2,
+    0xf5, 0xe9, 0x0, 0x0, 0x2f, 0x5e, 0x90, 0x0,
+    0x2, 0xf5, 0xe9, 0x0, 0x0, 0x2f, 0x5e, 0x90,
+    0x0, 0x2, 0xf5, 0xe9, 0x0, 0x0, 0x2f, 0x5e,
+    0x90, 0x0, 0x2, 0xf5, 0xda, 0x0, 0x0, 0x3f,
+    0x4a, 0xe0, 0x0, 0x8, 0xf1, 0x2f, 0xc6, 0x59,
+    0xf7, 0x0, 0x2a, 0xef, 0xc5, 0x0,
+
+    /* U+56 "V" */
+    0x9f, 0x0, 0x0, 0x0, 0xdc, 0x4f, 0x50, 0x0,
+    0x2, 0xf7, 0xe, 0xa0, 0x0, 0x7, 0xf1, 0x8,
+    0xf0, 0x0, 0xd, 0xc0, 0x3, 0xf5, 0x0, 0x2f,
+    0x60, 0x0, 0xda, 0x0, 0x7f, 0x10, 0x0, 0x7f,
+    0x0, 0xcb, 0x0, 0x0, 0x2f, 0x52, 0xf5, 0x0,
+    0x0, 0xc, 0xa7, 0xf0, 0x0, 0x0, 0x7, 0xfd,
+    0xa0, 0x0, 0x0, 0x1, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0xbe, 0x0, 0x0,
+
+    /* U+57 "W" */
+    0x6f, 0x10, 0x0, 0x9f, 0x0, 0x0, 0xcb, 0x2f,
+    0x40, 0x0, 0xdf, 0x30, 0x0, 0xf8, 0xe, 0x80,
+    0x1, 0xfe, 0x70, 0x3, 0xf4, 0xb, 0xb0, 0x6,
+    0xf8, 0xb0, 0x6, 0xf0, 0x7, 0xf0, 0xa, 0xa4,
+    0xf0, 0x9, 0xd0, 0x4, 0xf2, 0xe, 0x60, 0xf4,
+    0xd, 0x90, 0x0, 0xf6, 0x2f, 0x10, 0xb8, 0xf,
+    0x50, 0x0, 0xc9, 0x7d, 0x0, 0x7c, 0x4f, 0x20,
+    0x0, 0x9d, 0xb9, 0x0, 0x3f, 0x8e, 0x0, 0x0,
+    0x5f, 0xe4, 0x0, 0xe, 0xea, 0x0, 0x0, 0x1f,
+    0xf0, 0x0, 0xa, 0xf7, 0x0, 0x0, 0xe, 0xb0,
+    0x0, 0x6, 0xf3, 0x0,
+
+    /* U+58 "X" */
+    0x2f, 0x90, 0x0, 0x8, 0xf3, 0x8, 0xf3, 0x0,
+    0x2f, 0x90, 0x0, 0xec, 0x0, 0xbe, 0x10, 0x0,
+    0x5f, 0x65, 0xf6, 0x0, 0x0, 0xb, 0xee, 0xc0,
+    0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x3,
+    0xff, 0x40, 0x0, 0x0, 0xc, 0xed, 0xd0, 0x0,
+    0x0, 0x6f, 0x54, 0xf7, 0x0, 0x1, 0xeb, 0x0,
+    0xaf, 0x20, 0xa, 0xf2, 0x0, 0x1f, 0xb0, 0x3f,
+    0x80, 0x0, 0x7, 0xf4,
+
+    /* U+59 "Y" */
+    0x9f, 0x10, 0x0, 0x7, 0xf3, 0x1f, 0x90, 0x0,
+    0xe, 0xa0, 0x9, 0xf1, 0x0, 0x7f, 0x20, 0x1,
+    0xf9, 0x0, 0xea, 0x0, 0x0, 0x8f, 0x17, 0xf2,
+    0x0, 0x0, 0x1f, 0x9e, 0x90, 0x0, 0x0, 0x7,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0xf8, 0x0, 0x0,
+
+    /* U+5A "Z" */
+    0x3f, 0xff, 0xff, 0xff, 0xb1, 0x44, 0x44, 0x48,
+    0xf7, 0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x0,
+    0x8f, 0x30, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0,
+    0xd, 0xd0, 0x0, 0x0, 0x7, 0xf3, 0x0, 0x0,
+    0x2, 0xf8, 0x0, 0x0, 0x0, 0xcd, 0x0, 0x0,
+    0x0, 0x7f, 0x40, 0x0, 0x0, 0x2f, 0xc4, 0x44,
+    0x44, 0x45, 0xff, 0xff, 0xff, 0xff,
+
+    /* U+5B "[" */
+    0x0, 0x0, 0xdf, 0xf1, 0xda, 0x30, 0xd9, 0x0,
+    0xd9, 0x0, 0xd9, 0x0, 0xd9, 0x0, 0xd9, 0x0,
+    0xd9, 0x0, 0xd9, 0x0, 0xd9, 0x0, 0xd9, 0x0,
+    0xd9, 0x0, 0xd9, 0x0, 0xd9, 0x0, 0xd9, 0x0,
+    0xdf, 0xf1, 0x23, 0x30,
+
+    /* U+5C "\\" */
+    0x8d, 0x0, 0x0, 0x2, 0xf3, 0x0, 0x0, 0xc,
+    0x90, 0x0, 0x0, 0x6e, 0x0, 0x0, 0x1, 0xf5,
+    0x0, 0x0, 0xa, 0xb0, 0x0, 0x0, 0x5f, 0x10,
+    0x0, 0x0, 0xe6, 0x0, 0x0, 0x9, 0xc0, 0x0,
+    0x0, 0x3f, 0x20, 0x0, 0x0, 0xd8, 0x0, 0x0,
+    0x7, 0xe0, 0x0, 0x0, 0x2f, 0x40,
+
+    /* U+5D "]" */
+    0x0, 0x0, 0xef, 0xf0, 0x38, 0xf0, 0x6, 0xf0,
+    0x6, 0xf0, 0x6, 0xf0, 0x6, 0xf0, 0x6, 0xf0,
+    0x6, 0xf0, 0x6, 0xf0, 0x6, 0xf0, 0x6, 0xf0,
+    0x6, 0xf0, 0x6, 0xf0, 0x6, 0xf0, 0x7, 0xf0,
+    0xef, 0xf0, 0x23, 0x30,
+
+    /* U+5E "^" */
+    0x0, 0x5f, 0x0, 0x0, 0xb, 0xf6, 0x0, 0x2,
+    0xfa, 0xc0, 0x0, 0x8c, 0x2f, 0x20, 0xe, 0x60,
+    0xb9, 0x4, 0xf1, 0x5, 0xe0,
+
+    /* U+5F "_" */
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf3,
+    0x33, 0x33, 0x33, 0x30,
+
+    /* U+60 "`" */
+    0x28, 0x20, 0xb, 0xc0, 0x1, 0xd6,
+
+    /* U+61 "a" */
+    0x0, 0x8d, 0xfc, 0x40, 0xa, 0xe5, 0x48, 0xf2,
+    0x4, 0x20, 0x0, 0xe7, 0x0, 0x7c, 0xef, 0xf8,
+    0x9, 0xe5, 0x22, 0xe8, 0xf, 0x60, 0x0, 0xe8,
+    0x1f, 0x60, 0x2, 0xf8, 0xc, 0xe6, 0x6e, 0xf9,
+    0x2, 0xbf, 0xe6, 0xa9,
+
+    /* U+62 "b" */
+    0xe8, 0x0, 0x0, 0x0, 0xe8, 0x0, 0x0, 0x0,
+    0xe8, 0x0, 0x0, 0x0, 0xe9, 0x9f, 0xe8, 0x0,
+    0xef, 0x95, 0x8f, 0x80, 0xea, 0x0, 0x9, 0xe0,
+    0xe8, 0x0, 0x4, 0xf2, 0xe8, 0x0, 0x3, 0xf3,
+    0xe8, 0x0, 0x4, 0xf2, 0xea, 0x0, 0x9, 0xe0,
+    0xef, 0x95, 0x8f, 0x80, 0xe7, 0x9f, 0xe9, 0x0,
+
+    /* U+63 "c" */
+    0x0, 0x6d, 0xfc, 0x50, 0x6, 0xf7, 0x49, 0xf4,
+    0xe, 0x90, 0x0, 0xbb, 0x2f, 0x40, 0x0, 0x12,
+    0x4f, 0x20, 0x0, 0x0, 0x2f, 0x40, 0x0, 0x0,
+    0xe, 0x80, 0x0, 0x9a, 0x6, 0xf7, 0x48, 0xf4,
+    0x0, 0x6d, 0xfc, 0x50,
+
+    /* U+64 "d" */
+    0x0, 0x0, 0x0, 0x9e, 0x0, 0x0, 0x0, 0x9e,
+    0x0, 0x0, 0x0, 0x9e, 0x0, 0x8e, 0xfa, 0x9e,
+    0x7, 0xf9, 0x59, 0xfe, 0xe, 0xa0, 0x0, 0xae,
+    0x2f, 0x40, 0x0, 0x9e, 0x3f, 0x30, 0x0, 0x9e,
+    0x2f, 0x40, 0x0, 0x9e, 0xe, 0x80, 0x0, 0x9e,
+    0x7, 0xf6, 0x26, 0xfe, 0x0, 0x8e, 0xea, 0x9e,
+
+    /* U+65 "e" */
+    0x0, 0x5d, 0xfd, 0x40, 0x5, 0xf8, 0x4a, 0xf2,
+    0xe, 0xa0, 0x0, 0xd9, 0x2f, 0x50, 0x0, 0x9c,
+    0x4f, 0xff, 0xff, 0xfe, 0x3f, 0x63, 0x33, 0x33,
+    0xe, 0x80, 0x0, 0x10, 0x6, 0xf8, 0x45, 0xd8,
+    0x0, 0x5d, 0xfe, 0x80,
+
+    /* U+66 "f" */
+    0x0, 0x0, 0x0, 0x0, 0x3c, 0xf8, 0x0, 0xdd,
+    0x42, 0x1, 0xf5, 0x0, 0x2, 0xf4, 0x0, 0x8f,
+    0xff, 0xf1, 0x15, 0xf6, 0x20, 0x3, 0xf4, 0x0,
+    0x3, 0xf4, 0x0, 0x3, 0xf4, 0x0, 0x3, 0xf4,
+    0x0, 0x3, 0xf4, 0x0, 0x3, 0xf4, 0x0, 0x3,
+    0xf4, 0x0,
+
+    /* U+67 "g" */
+    0x0, 0x8e, 0xfa, 0x8e, 0x7, 0xf9, 0x59, 0xfe,
+    0xe, 0xa0, 0x0, 0xae, 0x2f, 0x40, 0x0, 0x9e,
+    0x3f, 0x30, 0x0, 0x9e, 0x2f, 0x40, 0x0, 0x9e,
+    0xe, 0x90, 0x0, 0xae, 0x7, 0xf9, 0x59, 0xfe,
+    0x0, 0x8e, 0xfa, 0xae, 0x0, 0x0, 0x0, 0xcb,
+    0x9, 0xc5, 0x49, 0xf4, 0x0, 0x8e, 0xfc, 0x40,
+
+    /* U+68 "h" */
+    0xe8, 0x0, 0x0, 0xe, 0x80, 0x0, 0x0, 0xe8,
+    0x0, 0x0, 0xe, 0x88, 0xee, 0x90, 0xef, 0xa5,
+    0x8f, 0x6e, 0xb0, 0x0, 0xca, 0xe8, 0x0, 0xb,
+    0xbe, 0x80, 0x0, 0xbc, 0xe8, 0x0, 0xb, 0xce,
+    0x80, 0x0, 0xbc, 0xe8, 0x0, 0xb, 0xce, 0x80,
+    0x0, 0xbc,
+
+    /* U+69 "i" */
+    0xb9, 0x76, 0x0, 0xca, 0xca, 0xca, 0xca, 0xca,
+    0xca, 0xca, 0xca, 0xca,
+
+    /* U+6A "j" */
+    0x0, 0xc8, 0x0, 0x85, 0x0, 0x0, 0x0, 0xd9,
+    0x0, 0xd9, 0x0, 0xd9, 0x0, 0xd9, 0x0, 0xd9,
+    0x0, 0xd9, 0x0, 0xd9, 0x0, 0xd9, 0x0, 0xd9,
+    0x0, 0xd9, 0x26, 0xf7, 0x7f, 0xb0,
+
+    /* U+6B "k" */
+    0xe8, 0x0, 0x0, 0x0, 0xe8, 0x0, 0x0, 0x0,
+    0xe8, 0x0, 0x0, 0x0, 0xe8, 0x0, 0x7f, 0x40,
+    0xe8, 0x6, 0xf6, 0x0, 0xe8, 0x4f, 0x80, 0x0,
+    0xeb, 0xfb, 0x0, 0x0, 0xef, 0xfe, 0x0, 0x0,
+    0xed, 0x3f, 0xa0, 0x0, 0xe8, 0x6, 0xf5, 0x0,
+    0xe8, 0x0, 0xae, 0x10, 0xe8, 0x0, 0x1e, 0xb0,
+
+    /* U+6C "l" */
+    0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca, 0xca,
+    0xca, 0xca, 0xca, 0xca,
+
+    /* U+6D "m" */
+    0xe8, 0x9f, 0xf9, 0x8, 0xee, 0xa1, 0xef, 0x85,
+    0x9f, 0xdb, 0x57, 0xf9, 0xea, 0x0, 0xd, 0xe0,
+    0x0, 0x9d, 0xe8, 0x0, 0xb, 0xb0, 0x0, 0x8e,
+    0xe8, 0x0, 0xb, 0xb0, 0x0, 0x8f, 0xe8, 0x0,
+    0xb, 0xb0, 0x0, 0x8f, 0xe8, 0x0, 0xb, 0xb0,
+    0x0, 0x8f, 0xe8, 0x0, 0xb, 0xb0, 0x0, 0x8f,
+    0xe8, 0x0, 0xb, 0xb0, 0x0, 0x8f,
+
+    /* U+6E "n" */
+    0xe8, 0x9e, 0xe9, 0xe, 0xfa, 0x58, 0xf6, 0xeb,
+    0x0, 0xc, 0xae, 0x80, 0x0, 0xbb, 0xe8, 0x0,
+    0xb, 0xce, 0x80, 0x0, 0xbc, 0xe8, 0x0, 0xb,
+    0xce, 0x80, 0x0, 0xbc, 0xe8, 0x0, 0xb, 0xc0,
+
+    /* U+6F "o" */
+    0x0, 0x5d, 0xfd, 0x70, 0x0, 0x5f, 0x94, 0x7f,
+    0x70, 0xe, 0xa0, 0x0, 0x8f, 0x13, 0xf4, 0x0,
+    0x2, 0xf5, 0x4f, 0x30, 0x0, 0xf, 0x63, 0xf4,
+    0x0, 0x2, 0xf5, 0xe, 0x90, 0x0, 0x8f, 0x10,
+    0x5f, 0x94, 0x7f, 0x70, 0x0, 0x6d, 0xfd, 0x70,
+    0x0,
+
+    /* U+70 "p" */
+    0xe8, 0xaf, 0xe8, 0x0, 0xef, 0x62, 0x6f, 0x70,
+    0xe9, 0x0, 0x9, 0xe0, 0xe8, 0x0, 0x4, 0xf1,
+    0xe8, 0x0, 0x3, 0xf3, 0xe8, 0x0, 0x5, 0xf1,
+    0xe9, 0x0, 0xa, 0xe0, 0xef, 0x74, 0x8f, 0x70,
+    0xe9, 0xae, 0xe9, 0x0, 0xe8, 0x0, 0x0, 0x0,
+    0xe8, 0x0, 0x0, 0x0, 0xe8, 0x0, 0x0, 0x0,
+
+    /* U+71 "q" */
+    0x0, 0x8e, 0xfa, 0x8e, 0x7, 0xf8, 0x48, 0xfe,
+    0xe, 0x90, 0x0, 0xae, 0x2f, 0x40, 0x0, 0x9e,
+    0x3f, 0x30, 0x0, 0x9e, 0x2f, 0x40, 0x0, 0x9e,
+    0xe, 0x90, 0x0, 0xae, 0x7, 0xf8, 0x48, 0xfe,
+    0x0, 0x8e, 0xea, 0xae, 0x0, 0x0, 0x0, 0x9e,
+    0x0, 0x0, 0x0, 0x9e, 0x0, 0x0, 0x0, 0x9e,
+
+    /* U+72 "r" */
+    0xe9, 0xbf, 0x2e, 0xf8, 0x51, 0xea, 0x0, 0xe,
+    0x80, 0x0, 0xe8, 0x0, 0xe, 0x80, 0x0, 0xe8,
+    0x0, 0xe, 0x80, 0x0, 0xe8, 0x0, 0x0,
+
+    /* U+73 "s" */
+    0x0, 0x9e, 0xfb, 0x30, 0xa, 0xe5, 0x4c, 0xe1,
+    0xe, 0x80, 0x1, 0xb3, 0xa, 0xe6, 0x10, 0x0,
+    0x0, 0x8d, 0xfc, 0x40, 0x0, 0x0, 0x29, 0xf3,
+    0x2d, 0x40, 0x0, 0xf6, 0xc, 0xd5, 0x49, 0xf2,
+    0x1, 0x9e, 0xfc, 0x40,
+
+    /* U+74 "t" */
+    0x6, 0xf1, 0x0, 0x6f, 0x10, 0xef, 0xff, 0xa2,
+    0x7f, 0x31, 0x6, 0xf1, 0x0, 0x6f, 0x10, 0x6,
+    0xf1, 0x0, 0x6f, 0x10, 0x6, 0xf1, 0x0, 0x4f,
+    0x73, 0x0, 0xaf, 0x90,
+
+    /* U+75 "u" */
+    0xf8, 0x0, 0xb, 0xbf, 0x80, 0x0, 0xbb, 0xf8,
+    0x0, 0xb, 0xbf, 0x80, 0x0, 0xbb, 0xf8, 0x0,
+    0xb, 0xbe, 0x80, 0x0, 0xbb, 0xda, 0x0, 0xd,
+    0xb9, 0xf6, 0x5b, 0xfb, 0x1a, 0xfe, 0x9b, 0xb0,
+
+    /* U+76 "v" */
+    0x9e, 0x0, 0x2, 0xf4, 0x3f, 0x30, 0x7, 0xe0,
+    0xe, 0x80, 0xc, 0x90, 0x8, 0xd0, 0x1f, 0x40,
+    0x3, 0xf2, 0x6e, 0x0, 0x0, 0xd7, 0xb9, 0x0,
+    0x0, 0x8d, 0xf4, 0x0, 0x0, 0x2f, 0xe0, 0x0,
+    0x0, 0xd, 0x90, 0x0,
+
+    /* U+77 "w" */
+    0x8e, 0x0, 0xb, 0xb0, 0x0, 0xe8, 0x4f, 0x20,
+    0xf, 0xf0, 0x2, 0xf3, 0xf, 0x60, 0x5d, 0xe5,
+    0x6, 0xf0, 0xb, 0xa0, 0x99, 0xa9, 0xa, 0xb0,
+    0x6, 0xe0, 0xe4, 0x5e, 0xe, 0x60, 0x2, 0xf5,
+    0xf0, 0xf, 0x5f, 0x20, 0x0, 0xed, 0xb0, 0xb,
+    0xdd, 0x0, 0x0, 0x9f, 0x60, 0x6, 0xf9, 0x0,
+    0x0, 0x5f, 0x10, 0x2, 0xf5, 0x0,
+
+    /* U+78 "x" */
+    0x4f, 0x50, 0x7, 0xf3, 0xa, 0xe0, 0x1f, 0x90,
+    0x1, 0xf8, 0xae, 0x0, 0x0, 0x6f, 0xf5, 0x0,
+    0x0, 0xf, 0xe0, 0x0, 0x0, 0x7f, 0xf6, 0x0,
+    0x2, 0xf7, 0x8e, 0x10, 0xb, 0xd0, 0xe, 0xa0,
+    0x5f, 0x40, 0x6, 0xf4,
+
+    /* U+79 "y" */
+    0xae, 0x0, 0x5, 0xf3, 0x4f, 0x30, 0x9, 0xd0,
+    0xe, 0x80, 0xe, 0x80, 0x9, 0xd0, 0x3f, 0x20,
+    0x3, 0xf2, 0x8d, 0x0, 0x0, 0xd8, 0xc7, 0x0,
+    0x0, 0x8e, 0xf2, 0x0, 0x0, 0x2f, 0xc0, 0x0,
+    0x0, 0xe, 0x70, 0x0, 0x0, 0x3f, 0x10, 0x0,
+    0x15, 0xda, 0x0, 0x0, 0x5f, 0xb1, 0x0, 0x0,
+
+    /* U+7A "z" */
+    0x3f, 0xff, 0xff, 0xf2, 0x4, 0x44, 0x4e, 0xd0,
+    0x0, 0x0, 0x8f, 0x20, 0x0, 0x3, 0xf7, 0x0,
+    0x0, 0xd, 0xb0, 0x0, 0x0, 0xae, 0x10, 0x0,
+    0x5, 0xf5, 0x0, 0x0, 0x1e, 0xc3, 0x33, 0x31,
+    0x5f, 0xff, 0xff, 0xf6,
+
+    /* U+7B "{" */
+    0x0, 0x0, 0x30, 0x0, 0xa, 0xe1, 0x0, 0x6f,
+    0x10, 0x0, 0xbb, 0x0, 0x0, 0xd9, 0x0, 0x0,
+    0xd9, 0x0, 0x0, 0xe8, 0x0, 0x5, 0xf4, 0x0,
+    0x8f, 0xa0, 0x0, 0x18, 0xf2, 0x0, 0x0, 0xe8,
+    0x0, 0x0, 0xd9, 0x0, 0x0, 0xd9, 0x0, 0x0,
+    0xca, 0x0, 0x0, 0x8e, 0x0, 0x0, 0x1c, 0xc1,
+    0x0, 0x0, 0x60,
+
+    /* U+7C "|" */
+    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
+    0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
+
+    /* U+7D "}" */
+    0x30, 0x0, 0x9, 0xe2, 0x0, 0xa, 0xd0, 0x0,
+    0x4f, 0x20, 0x3, 0xf3, 0x0, 0x3f, 0x30, 0x2,
+    0xf4, 0x0, 0xd, 0xb1, 0x0, 0x3f, 0xe0, 0xc,
+    0xd3, 0x2, 0xf5, 0x0, 0x3f, 0x30, 0x3, 0xf3,
+    0x0, 0x4f, 0x20, 0x9, 0xe0, 0x7, 0xf4, 0x0,
+    0x52, 0x0, 0x0,
+
+    /* U+7E "~" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xd3, 0x0,
+    0x6c, 0xac, 0x5a, 0xf6, 0x2c, 0x8d, 0x50, 0x7,
+    0xff, 0xc1, 0x0, 0x0, 0x1, 0x30, 0x0,
+
+    /* U+F00C */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xb1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xc0,
+    0x1b, 0xa0, 0x0, 0x0, 0xb, 0xff, 0xfc, 0x0,
+    0xcf, 0xfb, 0x0, 0x0, 0xbf, 0xff, 0xc0, 0x0,
+    0xbf, 0xff, 0xb0, 0xb, 0xff, 0xfc, 0x0, 0x0,
+    0xc, 0xff, 0xfb, 0xbf, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0xcf, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xb0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F00D */
+    0x3, 0x0, 0x0, 0x0, 0x3, 0x8, 0xfc, 0x10,
+    0x0, 0x1c, 0xf8, 0xff, 0xfc, 0x10, 0x1c, 0xff,
+    0xf5, 0xff, 0xfc, 0x2c, 0xff, 0xf5, 0x5, 0xff,
+    0xff, 0xff, 0xf5, 0x0, 0x5, 0xff, 0xff, 0xf5,
+    0x0, 0x0, 0x1d, 0xff, 0xfd, 0x10, 0x0, 0x1c,
+    0xff, 0xff, 0xfc, 0x10, 0x1c, 0xff, 0xf9, 0xff,
+    0xfc, 0x1c, 0xff, 0xf5, 0x5, 0xff, 0xfc, 0xdf,
+    0xf5, 0x0, 0x5, 0xff, 0xd1, 0xa4, 0x0, 0x0,
+    0x4, 0xa1,
+
+    /* U+F053 */
+    0x0, 0x0, 0x0, 0x1a, 0x40, 0x0, 0x0, 0x1,
+    0xdf, 0xf0, 0x0, 0x0, 0x1d, 0xff, 0xa0, 0x0,
+    0x1, 0xdf, 0xfa, 0x0, 0x0, 0x1d, 0xff, 0xa0,
+    0x0, 0x1, 0xdf, 0xfa, 0x0, 0x0, 0xc, 0xff,
+    0xa0, 0x0, 0x0, 0xd, 0xff, 0x80, 0x0, 0x0,
+    0x1, 0xdf, 0xf8, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0x80, 0x0, 0x0, 0x1, 0xdf, 0xf8, 0x0, 0x0,
+    0x0, 0x1d, 0xff, 0x80, 0x0, 0x0, 0x1, 0xdf,
+    0xf0, 0x0, 0x0, 0x0, 0x1b, 0x50,
+
+    /* U+F054 */
+    0x4, 0xa1, 0x0, 0x0, 0x0, 0xf, 0xfd, 0x10,
+    0x0, 0x0, 0xa, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0xaf, 0xfd, 0x10, 0x0, 0x0, 0xa, 0xff, 0xd1,
+    0x0, 0x0, 0x0, 0xaf, 0xfd, 0x10, 0x0, 0x0,
+    0xa, 0xff, 0xc0, 0x0, 0x0, 0x8, 0xff, 0xd0,
+    0x0, 0x0, 0x8f, 0xfd, 0x10, 0x0, 0x8, 0xff,
+    0xd1, 0x0, 0x0, 0x8f, 0xfd, 0x10, 0x0, 0x8,
+    0xff, 0xd1, 0x0, 0x0, 0xf, 0xfd, 0x10, 0x0,
+    0x0, 0x5, 0xb1, 0x0, 0x0, 0x0,
+
+    /* U+F078 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0x90, 0x0, 0x0, 0x0, 0x9, 0xf5, 0xbf, 0xf9,
+    0x0, 0x0, 0x0, 0x9f, 0xfb, 0x1d, 0xff, 0x90,
+    0x0, 0x9, 0xff, 0xd1, 0x1, 0xdf, 0xf9, 0x0,
+    0x9f, 0xfd, 0x10, 0x0, 0x1d, 0xff, 0x99, 0xff,
+    0xd1, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xfd, 0x10,
+    0x0, 0x0, 0x0, 0x1d, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xdd, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F0E7 */
+    0x0, 0xdf, 0xff, 0xfd, 0x0, 0x0, 0x1, 0xff,
+    0xff, 0xfc, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xf2, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xa, 0xff,
+    0xff, 0xff, 0xff, 0xd0, 0xc, 0xff, 0xff, 0xff,
+    0xff, 0xa0, 0xe, 0xff, 0xff, 0xff, 0xff, 0x20,
+    0xd, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x2f, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0xd7, 0x0, 0x0, 0x0,
+
+    /* U+F1EB */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xfe,
+    0xc9, 0x40, 0x0, 0x0, 0x0, 0x7, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x4, 0xdf,
+    0xff, 0xfc, 0xa8, 0x8a, 0xcf, 0xff, 0xfd, 0x40,
+    0x6f, 0xff, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x5d,
+    0xff, 0xf6, 0xcf, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xfc, 0x1a, 0x30, 0x0, 0x5a,
+    0xdf, 0xfd, 0xa5, 0x0, 0x3, 0xa1, 0x0, 0x0,
+    0x4d, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xfe, 0xa8, 0x8a, 0xef, 0xff,
+    0x50, 0x0, 0x0, 0x1, 0xdf, 0x70, 0x0, 0x0,
+    0x7, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x12, 0x0,
+    0x0, 0x0, 0x0, 0x21, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4e, 0xe4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4e, 0xe4, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F55A */
+    0x0, 0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe4, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0x0, 0x1d, 0xff, 0xff,
+    0xfa, 0xef, 0xfe, 0xaf, 0xff, 0xff, 0x1, 0xdf,
+    0xff, 0xff, 0xa0, 0x2e, 0xe2, 0xa, 0xff, 0xff,
+    0x1d, 0xff, 0xff, 0xff, 0xe2, 0x2, 0x20, 0x2e,
+    0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xfe, 0x20,
+    0x2, 0xef, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff,
+    0xfe, 0x20, 0x2, 0xef, 0xff, 0xff, 0x1d, 0xff,
+    0xff, 0xff, 0xe2, 0x2, 0x20, 0x2e, 0xff, 0xff,
+    0x1, 0xdf, 0xff, 0xff, 0xa0, 0x2e, 0xe2, 0xa,
+    0xff, 0xff, 0x0, 0x1d, 0xff, 0xff, 0xfa, 0xef,
+    0xfe, 0xaf, 0xff, 0xff, 0x0, 0x1, 0xdf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
+    0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4,
+
+    /* U+F8A2 */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xe0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0x10, 0x0, 0xbf, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf1, 0x0, 0xcf, 0xf1, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0x11, 0xcf, 0xff, 0x77, 0x77, 0x77,
+    0x77, 0xbf, 0xf1, 0xcf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x17, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0x7, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 63, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 66, .box_w = 2, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12, .adv_w = 82, .box_w = 4, .box_h = 5, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 22, .adv_w = 159, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 82, .adv_w = 144, .box_w = 9, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 154, .adv_w = 188, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 226, .adv_w = 159, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 286, .adv_w = 45, .box_w = 2, .box_h = 4, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 290, .adv_w = 88, .box_w = 5, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 335, .adv_w = 89, .box_w = 5, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 380, .adv_w = 110, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 405, .adv_w = 145, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 446, .adv_w = 50, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 454, .adv_w = 71, .box_w = 5, .box_h = 3, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 462, .adv_w = 67, .box_w = 2, .box_h = 2, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 464, .adv_w = 106, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 510, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 564, .adv_w = 144, .box_w = 5, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 594, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 648, .adv_w = 144, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 696, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 750, .adv_w = 144, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 798, .adv_w = 144, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 846, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 900, .adv_w = 144, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 954, .adv_w = 144, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1002, .adv_w = 62, .box_w = 2, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1011, .adv_w = 54, .box_w = 3, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1029, .adv_w = 130, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 1057, .adv_w = 141, .box_w = 7, .box_h = 6, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 1078, .adv_w = 134, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 1106, .adv_w = 121, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1148, .adv_w = 230, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1253, .adv_w = 167, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1319, .adv_w = 159, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1373, .adv_w = 167, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1433, .adv_w = 168, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1487, .adv_w = 146, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1535, .adv_w = 142, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1583, .adv_w = 174, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1643, .adv_w = 183, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1703, .adv_w = 70, .box_w = 2, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1715, .adv_w = 141, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1763, .adv_w = 161, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1823, .adv_w = 138, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1871, .adv_w = 224, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1943, .adv_w = 183, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2003, .adv_w = 176, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2069, .adv_w = 162, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2123, .adv_w = 176, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2200, .adv_w = 158, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2254, .adv_w = 152, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2308, .adv_w = 153, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2368, .adv_w = 166, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2422, .adv_w = 163, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2482, .adv_w = 227, .box_w = 14, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2566, .adv_w = 161, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2626, .adv_w = 154, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2686, .adv_w = 153, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2740, .adv_w = 68, .box_w = 4, .box_h = 18, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 2776, .adv_w = 105, .box_w = 7, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2822, .adv_w = 68, .box_w = 4, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2858, .adv_w = 107, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 2879, .adv_w = 116, .box_w = 8, .box_h = 3, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2891, .adv_w = 79, .box_w = 4, .box_h = 3, .ofs_x = 0, .ofs_y = 10},
+    {.bitmap_index = 2897, .adv_w = 139, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2933, .adv_w = 144, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2981, .adv_w = 134, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3017, .adv_w = 144, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3065, .adv_w = 136, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3101, .adv_w = 89, .box_w = 6, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3143, .adv_w = 144, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3191, .adv_w = 141, .box_w = 7, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3233, .adv_w = 62, .box_w = 2, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3245, .adv_w = 61, .box_w = 4, .box_h = 15, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 3275, .adv_w = 130, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3323, .adv_w = 62, .box_w = 2, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3335, .adv_w = 224, .box_w = 12, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3389, .adv_w = 141, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3421, .adv_w = 146, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3462, .adv_w = 144, .box_w = 8, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 3510, .adv_w = 146, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3558, .adv_w = 87, .box_w = 5, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3581, .adv_w = 132, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3617, .adv_w = 84, .box_w = 5, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3645, .adv_w = 141, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3677, .adv_w = 124, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3713, .adv_w = 192, .box_w = 12, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3767, .adv_w = 127, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3803, .adv_w = 121, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3851, .adv_w = 127, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3887, .adv_w = 87, .box_w = 6, .box_h = 17, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3938, .adv_w = 62, .box_w = 2, .box_h = 14, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 3952, .adv_w = 87, .box_w = 5, .box_h = 17, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3995, .adv_w = 174, .box_w = 9, .box_h = 5, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 4018, .adv_w = 256, .box_w = 16, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4114, .adv_w = 176, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4180, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4250, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4320, .adv_w = 224, .box_w = 14, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 4390, .adv_w = 160, .box_w = 12, .box_h = 16, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 4486, .adv_w = 320, .box_w = 20, .box_h = 15, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4636, .adv_w = 320, .box_w = 20, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4756, .adv_w = 258, .box_w = 17, .box_h = 11, .ofs_x = 0, .ofs_y = 1}
+};
+
+static const uint16_t unicode_list_sparse[] = {
+    0x0, 0x1, 0x47, 0x48, 0x6c, 0xdb, 0x1df, 0x54e,
+    0x896
+};
+
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 94, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 61452, .range_length = 2198, .glyph_id_start = 96,
+        .unicode_list = unicode_list_sparse, .glyph_id_ofs_list = NULL, .list_length = 9, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+static const uint8_t kern_left_class_mapping[] = {
+    0, 1, 0, 2, 0, 0, 0, 0,
+    2, 3, 0, 0, 0, 4, 0, 4,
+    5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 6, 7, 8, 9, 10, 11,
+    0, 12, 12, 13, 14, 15, 12, 12,
+    9, 16, 17, 18, 0, 19, 13, 20,
+    21, 22, 23, 24, 25, 0, 0, 0,
+    0, 0, 26, 27, 28, 0, 29, 30,
+    0, 31, 0, 0, 32, 0, 31, 31,
+    33, 27, 0, 34, 0, 35, 0, 36,
+    37, 38, 36, 39, 40, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0
+};
+
+static const uint8_t kern_right_class_mapping[] = {
+    0, 1, 0, 2, 0, 0, 0, 3,
+    2, 0, 4, 5, 0, 6, 7, 6,
+    8, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 10, 0, 11, 0, 0, 0,
+    11, 0, 0, 12, 0, 0, 0, 0,
+    11, 0, 11, 0, 13, 14, 15, 16,
+    17, 18, 19, 20, 0, 0, 21, 0,
+    0, 0, 22, 0, 23, 23, 23, 24,
+    23, 0, 0, 0, 0, 0, 25, 25,
+    26, 25, 23, 27, 28, 29, 30, 31,
+    32, 33, 31, 34, 0, 0, 35, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0
+};
+
+static const int8_t kern_class_values[] = {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -13, 0, 0, 0,
+    0, 0, 0, 0, -15, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -6, -7, 0, -2, -8, 0, -10, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 2, 0,
+    3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -21, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -28, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -15, 0, 0, 0, 0, 0, 0, -8,
+    0, -1, 0, 0, -16, -2, -11, -9,
+    0, -12, 0, 0, 0, 0, 0, 0,
+    -1, 0, 0, -2, -1, -6, -4, 0,
+    2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -3,
+    0, -3, 0, 0, -7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2,
+    0, 0, 0, 0, 0, -13, 0, 0,
+    0, -3, 0, 0, 0, -3, 0, -3,
+    0, -3, -5, -3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, 0, -2, 0, 0, 0,
+    -2, -3, -3, 0, 0, 0, 0, 0,
+    0, 0, 0, -29, 0, 0, 0, -21,
+    0, -33, 0, 3, 0, 0, 0, 0,
+    0, 0, 0, -4, -3, 0, 0, -3,
+    -3, 0, 0, -3, -3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, -4, 0,
+    0, 0, 2, -3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -8, 0, 0,
+    0, -4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -3, 0, -3,
+    -3, 0, 0, 0, -3, -5, -8, 0,
+    0, 0, 0, -42, 0, 0, 0, 0,
+    0, 0, 0, 2, -8, 0, 0, -34,
+    -7, -22, -18, 0, -30, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -5,
+    -17, -11, 0, 0, 0, 0, 0, 0,
+    0, 0, -40, 0, 0, 0, -17, 0,
+    -25, 0, 0, 0, 0, 0, -4, 0,
+    -3, 0, -1, -2, 0, 0, -2, 0,
+    0, 2, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -5, 0, -3,
+    -2, 0, -4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -10, 0, -2, 0, 0, -6, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -5, 0,
+    0, 0, 0, -27, -29, 0, 0, -10,
+    -3, -30, -2, 2, 0, 2, 2, 0,
+    2, 0, 0, -14, -12, 0, -14, -12,
+    -9, -14, 0, -12, -9, -7, -10, -7,
+    0, 0, 0, 0, 3, 0, -28, -5,
+    0, 0, -9, -2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, -6, -5,
+    0, 0, -6, -4, 0, 0, -3, -1,
+    0, 0, 0, 2, 0, 0, 0, 2,
+    0, -15, -7, 0, 0, -5, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0,
+    2, -4, -4, 0, 0, -4, -3, 0,
+    0, -2, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, -6, 0, 0,
+    0, -3, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, -3, 0, 0,
+    -3, 0, 0, 0, -3, -4, 0, 0,
+    0, 0, 0, 0, -4, 3, -6, -26,
+    -6, 0, 0, -12, -4, -12, -2, 2,
+    -12, 2, 2, 2, 2, 0, 2, -9,
+    -8, -3, -5, -8, -5, -7, -3, -5,
+    -2, 0, -3, -4, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, -3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 0, -3, 0,
+    0, 0, -2, -3, -3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -8, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, -4,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, -2, -2,
+    0, 0, -1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0,
+    2, 0, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, -3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, -13, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -17, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0,
+    -3, -2, 0, 0, 2, 0, 0, 0,
+    -15, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -5, -2, 2, 0, -2, 0, 0, 6,
+    0, 2, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, -13, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, -2,
+    2, 0, -2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -15, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, 0,
+    -2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, -2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, -2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 40,
+    .right_class_cnt     = 35,
+};
+
+static lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap  = glyph_bitmap,
+    .glyph_dsc     = glyph_dsc,
+    .cmaps         = cmaps,
+    .kern_dsc      = &kern_classes,
+    .kern_scale    = 16,
+    .cmap_num      = 2,
+    .bpp           = 4,
+    .kern_classes  = 1,
+    .bitmap_format = 0,
+};
+
+lv_font_t lv_font_roboto_16_subset = {
+    .get_glyph_dsc    = lv_port_font_subset_get_glyph_dsc,
+    .get_glyph_bitmap = lv_port_font_subset_get_glyph_bitmap,
+    .line_height      = 19,
+    .base_line        = 4,
+    .subpx            = LV_FONT_SUBPX_NONE,
+    .dsc              = &font_dsc,
+};
@@ -0,0 +1,1371 @@
+/*
+ * Glyph subset of lv_font_roboto_22.c generated by gui/tools/lv_font_subset.py.
+ * Do not edit: regenerated by the build when the strings of the GUI change.
+ * Letters:
+ *   0x20 0x21 0x23 0x25 0x28 0x29 0x2A 0x2C 0x2D 0x2E 0x2F 0x30 0x31 0x32 0x33 0x34
+ *   0x35 0x36 0x37 0x38 0x39 0x3A 0x3C 0x3D 0x3E 0x3F 0x40 0x41 0x42 0x43 0x44 0x45
+ *   0x46 0x47 0x48 0x49 0x4A 0x4B 0x4C 0x4D 0x4E 0x4F 0x50 0x51 0x52 0x53 0x54 0x55
+ *   0x56 0x57 0x58 0x59 0x5F 0x61 0x62 0x63 0x64 0x65 0x66 0x67 0x68 0x69 0x6B 0x6C
+ *   0x6D 0x6E 0x6F 0x70 0x71 0x72 0x73 0x74 0x75 0x76 0x77 0x78 0x79 0x7A 0xF0E7 0xF1EB
+ */
+
+#include "lvgl.h"
+#include "lv_port_font_subset.h"
+
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+2C "," */
+    0xa, 0xf5, 0xa, 0xf4, 0xb, 0xf3, 0x1f, 0xd0,
+    0x7f, 0x50, 0x5, 0x0,
+
+    /* U+2D "-" */
+    0x6a, 0xaa, 0xa6, 0x9f, 0xff, 0xfa,
+
+    /* U+2E "." */
+    0x5, 0x20, 0x5f, 0xe0, 0x3e, 0xb0,
+
+    /* U+2F "/" */
+    0x0, 0x0, 0x0, 0x7f, 0x30, 0x0, 0x0, 0xd,
+    0xd0, 0x0, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x0,
+    0xaf, 0x10, 0x0, 0x0, 0xf, 0xb0, 0x0, 0x0,
+    0x6, 0xf5, 0x0, 0x0, 0x0, 0xce, 0x0, 0x0,
+    0x0, 0x2f, 0x80, 0x0, 0x0, 0x8, 0xf2, 0x0,
+    0x0, 0x0, 0xec, 0x0, 0x0, 0x0, 0x5f, 0x60,
+    0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x1, 0xfa,
+    0x0, 0x0, 0x0, 0x7f, 0x30, 0x0, 0x0, 0xd,
+    0xd0, 0x0, 0x0, 0x3, 0xf7, 0x0, 0x0, 0x0,
+    0x9f, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+30 "0" */
+    0x0, 0x4c, 0xff, 0xd7, 0x0, 0x0, 0x6f, 0xfc,
+    0xbe, 0xfb, 0x0, 0x1f, 0xf3, 0x0, 0xc, 0xf5,
+    0x6, 0xfa, 0x0, 0x0, 0x4f, 0xb0, 0x9f, 0x50,
+    0x0, 0x0, 0xfe, 0xb, 0xf4, 0x0, 0x0, 0xe,
+    0xf0, 0xcf, 0x30, 0x0, 0x0, 0xef, 0x1c, 0xf3,
+    0x0, 0x0, 0xe, 0xf1, 0xcf, 0x30, 0x0, 0x0,
+    0xef, 0x1b, 0xf3, 0x0, 0x0, 0xe, 0xf1, 0xbf,
+    0x40, 0x0, 0x0, 0xef, 0x9, 0xf6, 0x0, 0x0,
+    0xf, 0xe0, 0x5f, 0xa0, 0x0, 0x4, 0xfb, 0x0,
+    0xff, 0x40, 0x0, 0xdf, 0x50, 0x5, 0xff, 0xba,
+    0xef, 0xb0, 0x0, 0x4, 0xbf, 0xfd, 0x80, 0x0,
+
+    /* U+31 "1" */
+    0x0, 0x0, 0x39, 0xc0, 0x17, 0xdf, 0xfd, 0x2f,
+    0xff, 0xbf, 0xd2, 0xc6, 0x2, 0xfd, 0x0, 0x0,
+    0x2f, 0xd0, 0x0, 0x2, 0xfd, 0x0, 0x0, 0x2f,
+    0xd0, 0x0, 0x2, 0xfd, 0x0, 0x0, 0x2f, 0xd0,
+    0x0, 0x2, 0xfd, 0x0, 0x0, 0x2f, 0xd0, 0x0,
+    0x2, 0xfd, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x2,
+    0xfd, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x2, 0xfd,
+
+    /* U+32 "2" */
+    0x0, 0x6c, 0xff, 0xd8, 0x0, 0x0, 0xbf, 0xfc,
+    0xbf, 0xfc, 0x0, 0x6f, 0xd1, 0x0, 0x1d, 0xf7,
+    0xc, 0xf4, 0x0, 0x0, 0x5f, 0xb0, 0xdd, 0x0,
+    0x0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0x90, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0,
+    0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x5, 0xfd,
+    0x10, 0x0, 0x0, 0x3, 0xfe, 0x20, 0x0, 0x0,
+    0x2, 0xef, 0x30, 0x0, 0x0, 0x1, 0xef, 0x50,
+    0x0, 0x0, 0x0, 0xcf, 0x60, 0x0, 0x0, 0x0,
+    0xbf, 0x70, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0xaa,
+    0xaa, 0xaa, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xf8,
+
+    /* U+33 "3" */
+    0x0, 0x6c, 0xff, 0xc7, 0x0, 0xb, 0xff, 0xbb,
+    0xff, 0xb0, 0x6f, 0xc1, 0x0, 0x1d, 0xf5, 0xbf,
+    0x40, 0x0, 0x6, 0xf9, 0x34, 0x0, 0x0, 0x5,
+    0xfa, 0x0, 0x0, 0x0, 0x9, 0xf7, 0x0, 0x0,
+    0x1, 0x8f, 0xd0, 0x0, 0xd, 0xff, 0xfb, 0x10,
+    0x0, 0x8, 0xac, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x1d, 0xf6, 0x0, 0x0, 0x0, 0x4, 0xfc, 0x55,
+    0x0, 0x0, 0x1, 0xfe, 0xef, 0x20, 0x0, 0x3,
+    0xfc, 0x9f, 0xb0, 0x0, 0x1c, 0xf7, 0x1d, 0xfe,
+    0xbb, 0xef, 0xb0, 0x0, 0x7d, 0xff, 0xc7, 0x0,
+
+    /* U+34 "4" */
+    0x0, 0x0, 0x0, 0xb, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xfb, 0x0, 0x0, 0x0, 0x9, 0xfa, 0xfb, 0x0,
+    0x0, 0x0, 0x3f, 0xb5, 0xfb, 0x0, 0x0, 0x0,
+    0xcf, 0x25, 0xfb, 0x0, 0x0, 0x6, 0xf8, 0x5,
+    0xfb, 0x0, 0x0, 0x1e, 0xe0, 0x5, 0xfb, 0x0,
+    0x0, 0xaf, 0x50, 0x5, 0xfb, 0x0, 0x3, 0xfb,
+    0x0, 0x5, 0xfb, 0x0, 0xd, 0xf2, 0x0, 0x5,
+    0xfb, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x4a, 0xaa, 0xaa, 0xac, 0xfe, 0xa9, 0x0, 0x0,
+    0x0, 0x5, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x5, 0xfb, 0x0,
+
+    /* U+35 "5" */
+    0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x2f, 0xfd,
+    0xdd, 0xdd, 0xd0, 0x3, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x7, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0x79, 0xbb, 0x71,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x9f,
+    0x81, 0x3, 0xdf, 0xc0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0xa, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0x72, 0x74, 0x0, 0x0,
+    0x9, 0xf6, 0x2f, 0xc0, 0x0, 0x0, 0xdf, 0x30,
+    0xcf, 0x70, 0x0, 0x8f, 0xd0, 0x2, 0xef, 0xda,
+    0xdf, 0xf3, 0x0, 0x2, 0x9e, 0xfe, 0xa2, 0x0,
+
+    /* U+36 "6" */
+    0x0, 0x0, 0x5b, 0xef, 0x10, 0x0, 0x1, 0xcf,
+    0xfd, 0xb1, 0x0, 0x0, 0xcf, 0xb2, 0x0, 0x0,
+    0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0xe, 0xf1,
+    0x0, 0x0, 0x0, 0x2, 0xfb, 0x17, 0xa9, 0x50,
+    0x0, 0x6f, 0xcf, 0xff, 0xff, 0xb0, 0x8, 0xff,
+    0xb3, 0x3, 0xef, 0x80, 0x9f, 0xc0, 0x0, 0x3,
+    0xfe, 0x9, 0xf6, 0x0, 0x0, 0xd, 0xf3, 0x8f,
+    0x70, 0x0, 0x0, 0xbf, 0x46, 0xf9, 0x0, 0x0,
+    0xc, 0xf3, 0x2f, 0xe0, 0x0, 0x1, 0xff, 0x0,
+    0xaf, 0x90, 0x0, 0xaf, 0xa0, 0x1, 0xdf, 0xeb,
+    0xef, 0xd1, 0x0, 0x1, 0x9e, 0xfe, 0x81, 0x0,
+
+    /* U+37 "7" */
+    0x2f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x1a, 0xaa,
+    0xaa, 0xaa, 0xae, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0xee, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0x20, 0x0, 0x0, 0x0,
+    0x3, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0x70, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xf2, 0x0, 0x0, 0x0,
+
+    /* U+38 "8" */
+    0x0, 0x4b, 0xff, 0xd7, 0x0, 0x0, 0x7f, 0xfc,
+    0xbf, 0xfc, 0x0, 0x1f, 0xf4, 0x0, 0x1d, 0xf6,
+    0x5, 0xfb, 0x0, 0x0, 0x5f, 0xb0, 0x6f, 0x90,
+    0x0, 0x4, 0xfb, 0x3, 0xfd, 0x0, 0x0, 0x7f,
+    0x80, 0xb, 0xf9, 0x10, 0x5f, 0xe1, 0x0, 0xa,
+    0xff, 0xff, 0xd2, 0x0, 0x4, 0xef, 0xcb, 0xef,
+    0x80, 0x2, 0xfe, 0x20, 0x0, 0xbf, 0x70, 0x9f,
+    0x60, 0x0, 0x1, 0xff, 0xc, 0xf3, 0x0, 0x0,
+    0xe, 0xf1, 0xbf, 0x50, 0x0, 0x0, 0xff, 0x6,
+    0xfd, 0x10, 0x0, 0x9f, 0xb0, 0xb, 0xff, 0xbb,
+    0xef, 0xe2, 0x0, 0x6, 0xcf, 0xfd, 0x81, 0x0,
+
+    /* U+39 "9" */
+    0x0, 0x5c, 0xfe, 0xb3, 0x0, 0x9, 0xff, 0xbc,
+    0xff, 0x50, 0x4f, 0xe2, 0x0, 0x5f, 0xf1, 0xaf,
+    0x60, 0x0, 0x9, 0xf7, 0xdf, 0x20, 0x0, 0x4,
+    0xfb, 0xef, 0x10, 0x0, 0x1, 0xfd, 0xcf, 0x30,
+    0x0, 0x1, 0xfe, 0x9f, 0x80, 0x0, 0x7, 0xfe,
+    0x2f, 0xf7, 0x1, 0x8f, 0xfd, 0x6, 0xff, 0xff,
+    0xf9, 0xfb, 0x0, 0x28, 0xa8, 0x24, 0xf8, 0x0,
+    0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0, 0x2f,
+    0xd0, 0x0, 0x0, 0x5, 0xef, 0x50, 0x0, 0x8c,
+    0xff, 0xf6, 0x0, 0x0, 0xbe, 0xc8, 0x20, 0x0,
+
+    /* U+3A ":" */
+    0x4f, 0x97, 0xfd, 0x5, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x52, 0x7f,
+    0xd4, 0xf9,
+
+    /* U+3C "<" */
+    0x0, 0x0, 0x0, 0x0, 0x77, 0x0, 0x0, 0x1,
+    0x8e, 0xf9, 0x0, 0x2, 0x9f, 0xff, 0xa2, 0x2,
+    0xaf, 0xfd, 0x71, 0x0, 0x3f, 0xfb, 0x40, 0x0,
+    0x0, 0x2f, 0xfb, 0x50, 0x0, 0x0, 0x1, 0x8f,
+    0xfe, 0x81, 0x0, 0x0, 0x1, 0x8e, 0xff, 0xa3,
+    0x0, 0x0, 0x0, 0x7e, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x66,
+
+    /* U+3D "=" */
+    0x5f, 0xff, 0xff, 0xff, 0xf9, 0x4c, 0xcc, 0xcc,
+    0xcc, 0xc7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4b, 0xbb, 0xbb, 0xbb,
+    0xb6, 0x5f, 0xff, 0xff, 0xff, 0xf9,
+
+    /* U+3E ">" */
+    0x77, 0x10, 0x0, 0x0, 0x0, 0x9f, 0xf9, 0x20,
+    0x0, 0x0, 0x18, 0xef, 0xfb, 0x30, 0x0, 0x0,
+    0x5, 0xbf, 0xfc, 0x50, 0x0, 0x0, 0x1, 0x8e,
+    0xf9, 0x0, 0x0, 0x4, 0xaf, 0xf8, 0x0, 0x17,
+    0xdf, 0xfa, 0x30, 0x2a, 0xff, 0xf9, 0x20, 0x0,
+    0x9f, 0xe7, 0x10, 0x0, 0x0, 0x66, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+3F "?" */
+    0x0, 0x3b, 0xef, 0xd8, 0x0, 0x4, 0xff, 0xed,
+    0xff, 0xb0, 0xe, 0xf6, 0x0, 0x2e, 0xf3, 0x2e,
+    0xc0, 0x0, 0x9, 0xf7, 0x0, 0x0, 0x0, 0x8,
+    0xf7, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0,
+    0x0, 0x8f, 0xb0, 0x0, 0x0, 0x7, 0xfe, 0x10,
+    0x0, 0x0, 0x5f, 0xe2, 0x0, 0x0, 0x0, 0xdf,
+    0x40, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0,
+    0x1, 0x76, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x22, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0x0, 0x0, 0x0, 0x1, 0xed, 0x0, 0x0,
+
+    /* U+40 "@" */
+    0x0, 0x0, 0x1, 0x7c, 0xef, 0xec, 0x71, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xfb, 0x87, 0x8b, 0xfe,
+    0x50, 0x0, 0x0, 0x8, 0xf9, 0x10, 0x0, 0x0,
+    0x19, 0xf6, 0x0, 0x0, 0x6f, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0x20, 0x2, 0xfa, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0xc, 0xa0, 0x9, 0xf1, 0x0,
+    0x5, 0xdf, 0xfa, 0x10, 0x5, 0xf1, 0xf, 0x90,
+    0x0, 0x5f, 0xb5, 0x6f, 0x90, 0x0, 0xf4, 0x4f,
+    0x40, 0x1, 0xfb, 0x0, 0x1f, 0x80, 0x0, 0xe7,
+    0x8f, 0x0, 0x7, 0xf3, 0x0, 0x2f, 0x60, 0x0,
+    0xc9, 0xae, 0x0, 0xc, 0xe0, 0x0, 0x3f, 0x50,
+    0x0, 0xc9, 0xbd, 0x0, 0xf, 0xb0, 0x0, 0x5f,
+    0x30, 0x0, 0xc9, 0xbc, 0x0, 0x1f, 0x90, 0x0,
+    0x6f, 0x20, 0x0, 0xe7, 0xbd, 0x0, 0x1f, 0xa0,
+    0x0, 0xaf, 0x10, 0x2, 0xf4, 0x9f, 0x0, 0xf,
+    0xe0, 0x3, 0xff, 0x20, 0xa, 0xd0, 0x6f, 0x20,
+    0x9, 0xfd, 0xaf, 0x9f, 0xb5, 0x9f, 0x40, 0x2f,
+    0x70, 0x0, 0xaf, 0xd6, 0x6, 0xef, 0xc4, 0x0,
+    0xb, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xb1, 0x0, 0x0, 0x0,
+    0x10, 0x0, 0x0, 0x0, 0x6, 0xef, 0xb7, 0x67,
+    0xae, 0x60, 0x0, 0x0, 0x0, 0x0, 0x17, 0xce,
+    0xff, 0xc7, 0x10, 0x0, 0x0,
+
+    /* U+41 "A" */
+    0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xfe, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xfd, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0x72, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xf2, 0xc, 0xf2, 0x0, 0x0, 0x0, 0x2, 0xfc,
+    0x0, 0x6f, 0x80, 0x0, 0x0, 0x0, 0x8f, 0x60,
+    0x1, 0xfe, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0,
+    0xb, 0xf4, 0x0, 0x0, 0x4, 0xfb, 0x0, 0x0,
+    0x5f, 0xa0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0xf, 0xfb, 0xbb, 0xbb, 0xbd,
+    0xf6, 0x0, 0x6, 0xfa, 0x0, 0x0, 0x0, 0x4f,
+    0xc0, 0x0, 0xcf, 0x40, 0x0, 0x0, 0x0, 0xef,
+    0x20, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0x9, 0xf8,
+    0x8, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0,
+
+    /* U+42 "B" */
+    0x3f, 0xff, 0xff, 0xfd, 0x91, 0x0, 0x3f, 0xfb,
+    0xbb, 0xcf, 0xfe, 0x20, 0x3f, 0xe0, 0x0, 0x0,
+    0xbf, 0xb0, 0x3f, 0xe0, 0x0, 0x0, 0x2f, 0xf0,
+    0x3f, 0xe0, 0x0, 0x0, 0x1f, 0xf0, 0x3f, 0xe0,
+    0x0, 0x0, 0x5f, 0xd0, 0x3f, 0xe0, 0x0, 0x15,
+    0xef, 0x40, 0x3f, 0xff, 0xff, 0xff, 0xf4, 0x0,
+    0x3f, 0xfb, 0xbb, 0xbd, 0xfd, 0x20, 0x3f, 0xe0,
+    0x0, 0x0, 0x6f, 0xe0, 0x3f, 0xe0, 0x0, 0x0,
+    0xc, 0xf4, 0x3f, 0xe0, 0x0, 0x0, 0xa, 0xf7,
+    0x3f, 0xe0, 0x0, 0x0, 0xd, 0xf5, 0x3f, 0xe0,
+    0x0, 0x0, 0x8f, 0xf1, 0x3f, 0xfb, 0xbb, 0xbe,
+    0xff, 0x50, 0x3f, 0xff, 0xff, 0xfe, 0xa3, 0x0,
+
+    /* U+43 "C" */
+    0x0, 0x3, 0xae, 0xfe, 0xb5, 0x0, 0x0, 0x8,
+    0xff, 0xdc, 0xdf, 0xf9, 0x0, 0x6, 0xfe, 0x40,
+    0x0, 0x3e, 0xf6, 0x0, 0xef, 0x40, 0x0, 0x0,
+    0x4f, 0xe0, 0x5f, 0xc0, 0x0, 0x0, 0x0, 0xef,
+    0x38, 0xf8, 0x0, 0x0, 0x0, 0x2, 0x31, 0xaf,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x22, 0x5,
+    0xfc, 0x0, 0x0, 0x0, 0xe, 0xf3, 0xe, 0xf4,
+    0x0, 0x0, 0x4, 0xfe, 0x0, 0x6f, 0xe3, 0x0,
+    0x3, 0xdf, 0x60, 0x0, 0x8f, 0xfd, 0xbd, 0xff,
+    0x90, 0x0, 0x0, 0x4b, 0xef, 0xeb, 0x40, 0x0,
+
+    /* U+44 "D" */
+    0x3f, 0xff, 0xff, 0xea, 0x30, 0x0, 0x3, 0xff,
+    0xbb, 0xbe, 0xff, 0x90, 0x0, 0x3f, 0xe0, 0x0,
+    0x3, 0xdf, 0x80, 0x3, 0xfe, 0x0, 0x0, 0x1,
+    0xef, 0x30, 0x3f, 0xe0, 0x0, 0x0, 0x7, 0xf9,
+    0x3, 0xfe, 0x0, 0x0, 0x0, 0x2f, 0xe0, 0x3f,
+    0xe0, 0x0, 0x0, 0x0, 0xff, 0x3, 0xfe, 0x0,
+    0x0, 0x0, 0xe, 0xf1, 0x3f, 0xe0, 0x0, 0x0,
+    0x0, 0xef, 0x13, 0xfe, 0x0, 0x0, 0x0, 0xf,
+    0xf0, 0x3f, 0xe0, 0x0, 0x0, 0x2, 0xfe, 0x3,
+    0xfe, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x3f, 0xe0,
+    0x0, 0x0, 0x2f, 0xf3, 0x3, 0xfe, 0x0, 0x0,
+    0x4e, 0xf9, 0x0, 0x3f, 0xfb, 0xbb, 0xef, 0xf9,
+    0x0, 0x3, 0xff, 0xff, 0xfd, 0x93, 0x0, 0x0,
+
+    /* U+45 "E" */
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xa3, 0xff, 0xbb,
+    0xbb, 0xbb, 0xb7, 0x3f, 0xe0, 0x0, 0x0, 0x0,
+    0x3, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0,
+    0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xff, 0xff, 0xff, 0xa0, 0x3f, 0xfb, 0xbb, 0xbb,
+    0xb7, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xe0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x3,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfb, 0xbb,
+    0xbb, 0xbb, 0x83, 0xff, 0xff, 0xff, 0xff, 0xfc,
+
+    /* U+46 "F" */
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0xbb,
+    0xbb, 0xbb, 0xb5, 0x3f, 0xe0, 0x0, 0x0, 0x0,
+    0x3, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0,
+    0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xbb, 0xbb, 0xbb, 0x40, 0x3f, 0xff, 0xff, 0xff,
+    0xf7, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xe0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x3,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0,
+    0x0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+47 "G" */
+    0x0, 0x4, 0xae, 0xfe, 0xb6, 0x0, 0x0, 0x9,
+    0xff, 0xdb, 0xdf, 0xfb, 0x0, 0x6, 0xfe, 0x40,
+    0x0, 0x3d, 0xf9, 0x0, 0xef, 0x40, 0x0, 0x0,
+    0x2f, 0xf1, 0x5f, 0xd0, 0x0, 0x0, 0x0, 0xac,
+    0x38, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0x60, 0x0, 0x5f,
+    0xff, 0xff, 0x59, 0xf7, 0x0, 0x3, 0xbb, 0xbe,
+    0xf5, 0x8f, 0x90, 0x0, 0x0, 0x0, 0xbf, 0x54,
+    0xfe, 0x0, 0x0, 0x0, 0xb, 0xf5, 0xd, 0xf7,
+    0x0, 0x0, 0x0, 0xbf, 0x50, 0x4f, 0xf6, 0x0,
+    0x0, 0x3e, 0xf5, 0x0, 0x5f, 0xfe, 0xbb, 0xef,
+    0xfa, 0x0, 0x0, 0x29, 0xdf, 0xfd, 0xa4, 0x0,
+
+    /* U+48 "H" */
+    0x3f, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xd3, 0xfe,
+    0x0, 0x0, 0x0, 0x3, 0xfd, 0x3f, 0xe0, 0x0,
+    0x0, 0x0, 0x3f, 0xd3, 0xfe, 0x0, 0x0, 0x0,
+    0x3, 0xfd, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x3f,
+    0xd3, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xfd, 0x3f,
+    0xe0, 0x0, 0x0, 0x0, 0x3f, 0xd3, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x3f, 0xfb, 0xbb, 0xbb,
+    0xbb, 0xcf, 0xd3, 0xfe, 0x0, 0x0, 0x0, 0x3,
+    0xfd, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xd3,
+    0xfe, 0x0, 0x0, 0x0, 0x3, 0xfd, 0x3f, 0xe0,
+    0x0, 0x0, 0x0, 0x3f, 0xd3, 0xfe, 0x0, 0x0,
+    0x0, 0x3, 0xfd, 0x3f, 0xe0, 0x0, 0x0, 0x0,
+    0x3f, 0xd3, 0xfe, 0x0, 0x0, 0x0, 0x3, 0xfd,
+
+    /* U+49 "I" */
+    0xf, 0xf0, 0xf, 0xf0, 0xf, 0xf0, 0xf, 0xf0,
+    0xf, 0xf0, 0xf, 0xf0, 0xf, 0xf0, 0xf, 0xf0,
+    0xf, 0xf0, 0xf, 0xf0, 0xf, 0xf0, 0xf, 0xf0,
+    0xf, 0xf0, 0xf, 0xf0, 0xf, 0xf0, 0xf, 0xf0,
+
+    /* U+4A "J" */
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0x70, 0x0, 0x0,
+    0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0x70, 0x0, 0x0, 0x0, 0xa, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0x70, 0x0, 0x0, 0x0, 0xa,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x70, 0x0,
+    0x0, 0x0, 0xa, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0x70, 0x0, 0x0, 0x0, 0xa, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0x73, 0x96, 0x0, 0x0,
+    0xa, 0xf6, 0x5f, 0xd0, 0x0, 0x0, 0xef, 0x41,
+    0xff, 0x70, 0x0, 0x8f, 0xe0, 0x6, 0xff, 0xdb,
+    0xef, 0xf4, 0x0, 0x3, 0xbe, 0xfe, 0xa2, 0x0,
+
+    /* U+4B "K" */
+    0x3f, 0xe0, 0x0, 0x0, 0x9, 0xfd, 0x3, 0xfe,
+    0x0, 0x0, 0x7, 0xfe, 0x10, 0x3f, 0xe0, 0x0,
+    0x5, 0xff, 0x30, 0x3, 0xfe, 0x0, 0x4, 0xff,
+    0x40, 0x0, 0x3f, 0xe0, 0x2, 0xff, 0x60, 0x0,
+    0x3, 0xfe, 0x1, 0xef, 0x80, 0x0, 0x0, 0x3f,
+    0xe0, 0xdf, 0xa0, 0x0, 0x0, 0x3, 0xfe, 0xbf,
+    0xf7, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xdf, 0xf3,
+    0x0, 0x0, 0x3, 0xff, 0xd1, 0x8f, 0xe1, 0x0,
+    0x0, 0x3f, 0xf1, 0x0, 0xcf, 0xb0, 0x0, 0x3,
+    0xfe, 0x0, 0x1, 0xef, 0x70, 0x0, 0x3f, 0xe0,
+    0x0, 0x4, 0xff, 0x30, 0x3, 0xfe, 0x0, 0x0,
+    0x8, 0xfd, 0x10, 0x3f, 0xe0, 0x0, 0x0, 0xc,
+    0xfa, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x1e, 0xf6,
+
+    /* U+4C "L" */
+    0x3f, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0,
+    0x3, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0,
+    0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x3, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0,
+    0x0, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xe0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x3,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfb, 0xbb,
+    0xbb, 0xbb, 0x33, 0xff, 0xff, 0xff, 0xff, 0xf4,
+
+    /* U+4D "M" */
+    0x3f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0x63, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xf6, 0x3f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0x63, 0xfd, 0xfd, 0x0, 0x0, 0x0, 0xa,
+    0xfd, 0xf6, 0x3f, 0xbc, 0xf3, 0x0, 0x0, 0x1,
+    0xfe, 0x8f, 0x63, 0xfb, 0x5f, 0xa0, 0x0, 0x0,
+    0x7f, 0x88, 0xf6, 0x3f, 0xc0, 0xef, 0x0, 0x0,
+    0xd, 0xf2, 0x9f, 0x63, 0xfc, 0x9, 0xf6, 0x0,
+    0x3, 0xfb, 0x9, 0xf6, 0x3f, 0xd0, 0x2f, 0xc0,
+    0x0, 0xaf, 0x50, 0xaf, 0x63, 0xfd, 0x0, 0xcf,
+    0x30, 0xf, 0xe0, 0xa, 0xf6, 0x3f, 0xe0, 0x6,
+    0xf9, 0x6, 0xf8, 0x0, 0xbf, 0x63, 0xfe, 0x0,
+    0xf, 0xf0, 0xcf, 0x20, 0xb, 0xf6, 0x3f, 0xe0,
+    0x0, 0x9f, 0x8f, 0xc0, 0x0, 0xbf, 0x63, 0xfe,
+    0x0, 0x3, 0xff, 0xf5, 0x0, 0xb, 0xf6, 0x3f,
+    0xe0, 0x0, 0xc, 0xfe, 0x0, 0x0, 0xbf, 0x63,
+    0xfe, 0x0, 0x0, 0x6f, 0x90, 0x0, 0xb, 0xf6,
+
+    /* U+4E "N" */
+    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x3f, 0xd3, 0xff,
+    0xd0, 0x0, 0x0, 0x3, 0xfd, 0x3f, 0xff, 0x70,
+    0x0, 0x0, 0x3f, 0xd3, 0xff, 0xff, 0x20, 0x0,
+    0x3, 0xfd, 0x3f, 0xe9, 0xfc, 0x0, 0x0, 0x3f,
+    0xd3, 0xfe, 0xe, 0xf6, 0x0, 0x3, 0xfd, 0x3f,
+    0xe0, 0x4f, 0xe1, 0x0, 0x3f, 0xd3, 0xfe, 0x0,
+    0xaf, 0xa0, 0x3, 0xfd, 0x3f, 0xe0, 0x1, 0xef,
+    0x40, 0x3f, 0xd3, 0xfe, 0x0, 0x6, 0xfe, 0x3,
+    0xfd, 0x3f, 0xe0, 0x0, 0xb, 0xf9, 0x3f, 0xd3,
+    0xfe, 0x0, 0x0, 0x2f, 0xf7, 0xfd, 0x3f, 0xe0,
+    0x0, 0x0, 0x7f, 0xff, 0xd3, 0xfe, 0x0, 0x0,
+    0x0, 0xdf, 0xfd, 0x3f, 0xe0, 0x0, 0x0, 0x3,
+    0xff, 0xd3, 0xfe, 0x0, 0x0, 0x0, 0x8, 0xfd,
+
+    /* U+4F "O" */
+    0x0, 0x3, 0xae, 0xfe, 0xa4, 0x0, 0x0, 0x7,
+    0xff, 0xed, 0xef, 0xf9, 0x0, 0x5, 0xff, 0x60,
+    0x0, 0x4e, 0xf7, 0x0, 0xef, 0x50, 0x0, 0x0,
+    0x3f, 0xf0, 0x4f, 0xd0, 0x0, 0x0, 0x0, 0xbf,
+    0x68, 0xf8, 0x0, 0x0, 0x0, 0x6, 0xfa, 0xaf,
+    0x50, 0x0, 0x0, 0x0, 0x4f, 0xcb, 0xf5, 0x0,
+    0x0, 0x0, 0x3, 0xfd, 0xbf, 0x50, 0x0, 0x0,
+    0x0, 0x3f, 0xda, 0xf5, 0x0, 0x0, 0x0, 0x4,
+    0xfc, 0x8f, 0x80, 0x0, 0x0, 0x0, 0x6f, 0xa4,
+    0xfd, 0x0, 0x0, 0x0, 0xa, 0xf6, 0xe, 0xf5,
+    0x0, 0x0, 0x3, 0xff, 0x10, 0x5f, 0xf5, 0x0,
+    0x3, 0xef, 0x70, 0x0, 0x6f, 0xfe, 0xce, 0xff,
+    0x90, 0x0, 0x0, 0x3a, 0xef, 0xeb, 0x40, 0x0,
+
+    /* U+50 "P" */
+    0x3f, 0xff, 0xff, 0xfe, 0xb6, 0x0, 0x3, 0xff,
+    0xbb, 0xbb, 0xdf, 0xfb, 0x0, 0x3f, 0xe0, 0x0,
+    0x0, 0x3e, 0xf7, 0x3, 0xfe, 0x0, 0x0, 0x0,
+    0x5f, 0xd0, 0x3f, 0xe0, 0x0, 0x0, 0x1, 0xff,
+    0x3, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xf0, 0x3f,
+    0xe0, 0x0, 0x0, 0x6, 0xfd, 0x3, 0xfe, 0x0,
+    0x0, 0x17, 0xff, 0x60, 0x3f, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0x3, 0xff, 0xbb, 0xbb, 0xa7, 0x20,
+    0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+51 "Q" */
+    0x0, 0x3, 0xae, 0xfe, 0xa3, 0x0, 0x0, 0x8,
+    0xff, 0xed, 0xef, 0xf8, 0x0, 0x6, 0xfe, 0x50,
+    0x0, 0x5f, 0xf6, 0x0, 0xff, 0x40, 0x0, 0x0,
+    0x4f, 0xe0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0xcf,
+    0x5a, 0xf7, 0x0, 0x0, 0x0, 0x8, 0xf9, 0xcf,
+    0x40, 0x0, 0x0, 0x0, 0x5f, 0xbd, 0xf3, 0x0,
+    0x0, 0x0, 0x4, 0xfc, 0xdf, 0x30, 0x0, 0x0,
+    0x0, 0x4f, 0xcc, 0xf4, 0x0, 0x0, 0x0, 0x5,
+    0xfa, 0xaf, 0x70, 0x0, 0x0, 0x0, 0x7f, 0x96,
+    0xfb, 0x0, 0x0, 0x0, 0xc, 0xf4, 0xf, 0xf4,
+    0x0, 0x0, 0x4, 0xfe, 0x0, 0x6f, 0xe4, 0x0,
+    0x4, 0xef, 0x50, 0x0, 0x8f, 0xfe, 0xce, 0xff,
+    0x70, 0x0, 0x0, 0x3a, 0xef, 0xef, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2d, 0xfd, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x1b, 0xf6, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0x0,
+
+    /* U+52 "R" */
+    0x3f, 0xff, 0xff, 0xfd, 0x92, 0x0, 0x3, 0xff,
+    0xbb, 0xbc, 0xff, 0xf4, 0x0, 0x3f, 0xe0, 0x0,
+    0x0, 0x9f, 0xe0, 0x3, 0xfe, 0x0, 0x0, 0x0,
+    0xef, 0x40, 0x3f, 0xe0, 0x0, 0x0, 0xa, 0xf6,
+    0x3, 0xfe, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x3f,
+    0xe0, 0x0, 0x0, 0x1f, 0xf2, 0x3, 0xfe, 0x0,
+    0x1, 0x4d, 0xfa, 0x0, 0x3f, 0xff, 0xff, 0xff,
+    0xfa, 0x0, 0x3, 0xff, 0xbb, 0xbd, 0xfb, 0x0,
+    0x0, 0x3f, 0xe0, 0x0, 0x1f, 0xf2, 0x0, 0x3,
+    0xfe, 0x0, 0x0, 0x7f, 0xb0, 0x0, 0x3f, 0xe0,
+    0x0, 0x0, 0xef, 0x30, 0x3, 0xfe, 0x0, 0x0,
+    0x6, 0xfc, 0x0, 0x3f, 0xe0, 0x0, 0x0, 0xd,
+    0xf5, 0x3, 0xfe, 0x0, 0x0, 0x0, 0x5f, 0xd0,
+
+    /* U+53 "S" */
+    0x0, 0x3, 0xae, 0xfe, 0xb6, 0x0, 0x0, 0x7,
+    0xff, 0xec, 0xdf, 0xfb, 0x0, 0x3, 0xff, 0x50,
+    0x0, 0x2c, 0xf9, 0x0, 0x8f, 0x90, 0x0, 0x0,
+    0x2f, 0xf0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0xbb,
+    0x10, 0x6f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xe7, 0x10, 0x0, 0x0, 0x0, 0x1, 0x9f,
+    0xff, 0xc7, 0x10, 0x0, 0x0, 0x0, 0x27, 0xdf,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x29, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x0,
+    0xcb, 0x0, 0x0, 0x0, 0xe, 0xf2, 0xe, 0xf3,
+    0x0, 0x0, 0x0, 0xff, 0x20, 0x7f, 0xe4, 0x0,
+    0x0, 0xaf, 0xd0, 0x0, 0x9f, 0xfd, 0xbc, 0xff,
+    0xe3, 0x0, 0x0, 0x3a, 0xef, 0xfd, 0x81, 0x0,
+
+    /* U+54 "T" */
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xbb,
+    0xbb, 0xdf, 0xeb, 0xbb, 0xb7, 0x0, 0x0, 0x7,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0,
+
+    /* U+55 "U" */
+    0x8f, 0x80, 0x0, 0x0, 0x4, 0xfd, 0x8f, 0x80,
+    0x0, 0x0, 0x4, 0xfd, 0x8f, 0x80, 0x0, 0x0,
+    0x4, 0xfd, 0x8f, 0x80, 0x0, 0x0, 0x4, 0xfd,
+    0x8f, 0x80, 0x0, 0x0, 0x4, 0xfd, 0x8f, 0x80,
+    0x0, 0x0, 0x4, 0xfd, 0x8f, 0x80, 0x0, 0x0,
+    0x4, 0xfd, 0x8f, 0x80, 0x0, 0x0, 0x4, 0xfd,
+    0x8f, 0x80, 0x0, 0x0, 0x4, 0xfd, 0x8f, 0x80,
+    0x0, 0x0, 0x4, 0xfd, 0x7f, 0x80, 0x0, 0x0,
+    0x4, 0xfd, 0x6f, 0xa0, 0x0, 0x0, 0x5, 0xfc,
+    0x3f, 0xe0, 0x0, 0x0, 0xa, 0xf8, 0xc, 0xfb,
+    0x10, 0x0, 0x7f, 0xf1, 0x2, 0xdf, 0xfc, 0xce,
+    0xff, 0x40, 0x0, 0x7, 0xcf, 0xfd, 0x92, 0x0,
+
+    /* U+56 "V" */
+    0x8f, 0xb0, 0x0, 0x0, 0x0, 0xb, 0xf8, 0x2f,
+    0xf1, 0x0, 0x0, 0x0, 0x1f, 0xf2, 0xc, 0xf6,
+    0x0, 0x0, 0x0, 0x6f, 0xc0, 0x6, 0xfb, 0x0,
+    0x0, 0x0, 0xbf, 0x70, 0x1, 0xff, 0x10, 0x0,
+    0x1, 0xff, 0x10, 0x0, 0xbf, 0x60, 0x0, 0x6,
+    0xfb, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0xc, 0xf5,
+    0x0, 0x0, 0xf, 0xf1, 0x0, 0x1f, 0xf0, 0x0,
+    0x0, 0xa, 0xf7, 0x0, 0x7f, 0xa0, 0x0, 0x0,
+    0x4, 0xfc, 0x0, 0xcf, 0x40, 0x0, 0x0, 0x0,
+    0xef, 0x22, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0x77, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xcc,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0, 0x0,
+
+    /* U+57 "W" */
+    0x3f, 0xd0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0,
+    0x2f, 0xe0, 0xf, 0xf0, 0x0, 0x0, 0x6f, 0xf2,
+    0x0, 0x0, 0x5f, 0xb0, 0xc, 0xf4, 0x0, 0x0,
+    0xaf, 0xf7, 0x0, 0x0, 0x9f, 0x70, 0x8, 0xf8,
+    0x0, 0x0, 0xed, 0xfb, 0x0, 0x0, 0xcf, 0x30,
+    0x4, 0xfb, 0x0, 0x3, 0xf9, 0xcf, 0x0, 0x0,
+    0xff, 0x0, 0x0, 0xff, 0x0, 0x7, 0xf5, 0x8f,
+    0x30, 0x4, 0xfb, 0x0, 0x0, 0xcf, 0x20, 0xc,
+    0xf0, 0x4f, 0x80, 0x7, 0xf8, 0x0, 0x0, 0x9f,
+    0x60, 0x1f, 0xb0, 0xf, 0xc0, 0xb, 0xf4, 0x0,
+    0x0, 0x5f, 0xa0, 0x5f, 0x70, 0xb, 0xf1, 0xe,
+    0xf0, 0x0, 0x0, 0x1f, 0xd0, 0x9f, 0x20, 0x6,
+    0xf5, 0x2f, 0xc0, 0x0, 0x0, 0xd, 0xf1, 0xee,
+    0x0, 0x2, 0xf9, 0x5f, 0x80, 0x0, 0x0, 0xa,
+    0xf6, 0xf9, 0x0, 0x0, 0xdd, 0x8f, 0x50, 0x0,
+    0x0, 0x6, 0xfc, 0xf5, 0x0, 0x0, 0x9f, 0xcf,
+    0x10, 0x0, 0x0, 0x2, 0xff, 0xf0, 0x0, 0x0,
+    0x5f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xef, 0xb0,
+    0x0, 0x0, 0xf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0x70, 0x0, 0x0, 0xc, 0xf5, 0x0, 0x0,
+
+    /* U+58 "X" */
+    0xe, 0xf7, 0x0, 0x0, 0x0, 0xaf, 0xc0, 0x5,
+    0xff, 0x10, 0x0, 0x4, 0xff, 0x20, 0x0, 0xbf,
+    0xb0, 0x0, 0xd, 0xf8, 0x0, 0x0, 0x2f, 0xf5,
+    0x0, 0x7f, 0xe0, 0x0, 0x0, 0x7, 0xfe, 0x2,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0xdf, 0x9b, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0x7a, 0xfc, 0x0, 0x0, 0x0, 0x8, 0xfd,
+    0x1, 0xef, 0x60, 0x0, 0x0, 0x3f, 0xf3, 0x0,
+    0x6f, 0xe1, 0x0, 0x0, 0xcf, 0x90, 0x0, 0xc,
+    0xfa, 0x0, 0x7, 0xfe, 0x10, 0x0, 0x2, 0xff,
+    0x40, 0x1f, 0xf5, 0x0, 0x0, 0x0, 0x8f, 0xd0,
+
+    /* U+59 "Y" */
+    0x9f, 0xc0, 0x0, 0x0, 0x0, 0x9f, 0xb0, 0x1f,
+    0xf4, 0x0, 0x0, 0x1, 0xff, 0x30, 0x8, 0xfc,
+    0x0, 0x0, 0x9, 0xfa, 0x0, 0x0, 0xef, 0x40,
+    0x0, 0x2f, 0xf2, 0x0, 0x0, 0x6f, 0xd0, 0x0,
+    0xaf, 0x90, 0x0, 0x0, 0xd, 0xf5, 0x2, 0xff,
+    0x10, 0x0, 0x0, 0x5, 0xfd, 0xa, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0x8f, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x0,
+
+    /* U+61 "a" */
+    0x0, 0x5c, 0xfe, 0xc5, 0x0, 0xa, 0xfe, 0xbb,
+    0xff, 0x90, 0x5f, 0xc0, 0x0, 0x2f, 0xf2, 0x48,
+    0x30, 0x0, 0xb, 0xf5, 0x0, 0x0, 0x1, 0x1a,
+    0xf5, 0x1, 0x9e, 0xff, 0xff, 0xf5, 0x2e, 0xfa,
+    0x65, 0x4b, 0xf5, 0xaf, 0x70, 0x0, 0xa, 0xf5,
+    0xcf, 0x30, 0x0, 0xb, 0xf5, 0xaf, 0x90, 0x0,
+    0x7f, 0xf6, 0x2f, 0xfe, 0xce, 0xfd, 0xf7, 0x2,
+    0xbf, 0xfc, 0x45, 0xc8,
+
+    /* U+62 "b" */
+    0x8f, 0x70, 0x0, 0x0, 0x0, 0x8, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0x70, 0x0, 0x0, 0x0,
+    0x8, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x75,
+    0xcf, 0xea, 0x10, 0x8, 0xfd, 0xfd, 0xce, 0xfe,
+    0x10, 0x8f, 0xf5, 0x0, 0xc, 0xfa, 0x8, 0xf9,
+    0x0, 0x0, 0x2f, 0xf0, 0x8f, 0x70, 0x0, 0x0,
+    0xcf, 0x38, 0xf7, 0x0, 0x0, 0xa, 0xf5, 0x8f,
+    0x70, 0x0, 0x0, 0xaf, 0x58, 0xf7, 0x0, 0x0,
+    0xc, 0xf3, 0x8f, 0x90, 0x0, 0x2, 0xff, 0x8,
+    0xff, 0x50, 0x0, 0xcf, 0xa0, 0x8f, 0xdf, 0xdb,
+    0xef, 0xe1, 0x8, 0xf5, 0x5c, 0xfe, 0xa1, 0x0,
+
+    /* U+63 "c" */
+    0x0, 0x4, 0xbe, 0xfc, 0x50, 0x0, 0x7, 0xff,
+    0xbb, 0xff, 0xa0, 0x3, 0xfe, 0x30, 0x1, 0xdf,
+    0x50, 0xaf, 0x70, 0x0, 0x4, 0xfa, 0xe, 0xf1,
+    0x0, 0x0, 0x3, 0x20, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0x10, 0x0, 0x0, 0x0, 0xa, 0xf6, 0x0, 0x0,
+    0x3e, 0x90, 0x3f, 0xe2, 0x0, 0x1c, 0xf5, 0x0,
+    0x7f, 0xfb, 0xbe, 0xf9, 0x0, 0x0, 0x4b, 0xff,
+    0xc5, 0x0,
+
+    /* U+64 "d" */
+    0x0, 0x0, 0x0, 0x2, 0xfd, 0x0, 0x0, 0x0,
+    0x2, 0xfd, 0x0, 0x0, 0x0, 0x2, 0xfd, 0x0,
+    0x0, 0x0, 0x2, 0xfd, 0x0, 0x6d, 0xfe, 0x93,
+    0xfd, 0x9, 0xff, 0xcc, 0xfe, 0xfd, 0x3f, 0xf4,
+    0x0, 0x1c, 0xfd, 0xaf, 0x80, 0x0, 0x3, 0xfd,
+    0xdf, 0x30, 0x0, 0x2, 0xfd, 0xff, 0x10, 0x0,
+    0x2, 0xfd, 0xff, 0x0, 0x0, 0x2, 0xfd, 0xdf,
+    0x20, 0x0, 0x2, 0xfd, 0xaf, 0x60, 0x0, 0x2,
+    0xfd, 0x3f, 0xe1, 0x0, 0xa, 0xfd, 0x9, 0xfe,
+    0x98, 0xdf, 0xfd, 0x0, 0x6d, 0xfe, 0xa2, 0xfd,
+
+    /* U+65 "e" */
+    0x0, 0x3b, 0xef, 0xc5, 0x0, 0x5, 0xff, 0xcb,
+    0xff, 0x80, 0x2f, 0xf3, 0x0, 0x2e, 0xf3, 0x9f,
+    0x70, 0x0, 0x6, 0xf8, 0xdf, 0x20, 0x0, 0x2,
+    0xfc, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xaa,
+    0xaa, 0xaa, 0xa9, 0xef, 0x20, 0x0, 0x0, 0x0,
+    0xaf, 0x70, 0x0, 0x0, 0x0, 0x3f, 0xf4, 0x0,
+    0x4, 0xe5, 0x7, 0xff, 0xca, 0xcf, 0xe2, 0x0,
+    0x4b, 0xef, 0xd9, 0x10,
+
+    /* U+66 "f" */
+    0x0, 0x1, 0x9d, 0xf8, 0x0, 0xc, 0xfe, 0xc7,
+    0x0, 0x5f, 0xd0, 0x0, 0x0, 0x7f, 0x80, 0x0,
+    0x0, 0x8f, 0x70, 0x0, 0x5f, 0xff, 0xff, 0xf0,
+    0x39, 0xcf, 0xc9, 0x80, 0x0, 0x8f, 0x70, 0x0,
+    0x0, 0x8f, 0x70, 0x0, 0x0, 0x8f, 0x70, 0x0,
+    0x0, 0x8f, 0x70, 0x0, 0x0, 0x8f, 0x70, 0x0,
+    0x0, 0x8f, 0x70, 0x0, 0x0, 0x8f, 0x70, 0x0,
+    0x0, 0x8f, 0x70, 0x0, 0x0, 0x8f, 0x70, 0x0,
+    0x0, 0x8f, 0x70, 0x0,
+
+    /* U+67 "g" */
+    0x0, 0x6d, 0xfe, 0x91, 0xfd, 0x9, 0xff, 0xcc,
+    0xfd, 0xfd, 0x3f, 0xf4, 0x0, 0x1c, 0xfd, 0xaf,
+    0x80, 0x0, 0x3, 0xfd, 0xdf, 0x30, 0x0, 0x2,
+    0xfd, 0xff, 0x10, 0x0, 0x2, 0xfd, 0xff, 0x10,
+    0x0, 0x2, 0xfd, 0xdf, 0x20, 0x0, 0x2, 0xfd,
+    0xaf, 0x80, 0x0, 0x3, 0xfd, 0x3f, 0xf4, 0x0,
+    0x1c, 0xfd, 0x9, 0xff, 0xcc, 0xfe, 0xfd, 0x0,
+    0x6d, 0xfe, 0x93, 0xfd, 0x0, 0x0, 0x0, 0x3,
+    0xfc, 0x3, 0x0, 0x0, 0x7, 0xfa, 0x2f, 0x90,
+    0x0, 0x3f, 0xf4, 0xc, 0xfe, 0xac, 0xff, 0x90,
+    0x0, 0x6c, 0xff, 0xc5, 0x0,
+
+    /* U+68 "h" */
+    0x8f, 0x70, 0x0, 0x0, 0x0, 0x8f, 0x70, 0x0,
+    0x0, 0x0, 0x8f, 0x70, 0x0, 0x0, 0x0, 0x8f,
+    0x70, 0x0, 0x0, 0x0, 0x8f, 0x74, 0xbf, 0xeb,
+    0x20, 0x8f, 0xcf, 0xdc, 0xef, 0xe1, 0x8f, 0xf6,
+    0x0, 0xd, 0xf6, 0x8f, 0x90, 0x0, 0x7, 0xf9,
+    0x8f, 0x70, 0x0, 0x5, 0xfa, 0x8f, 0x70, 0x0,
+    0x5, 0xfa, 0x8f, 0x70, 0x0, 0x5, 0xfa, 0x8f,
+    0x70, 0x0, 0x5, 0xfa, 0x8f, 0x70, 0x0, 0x5,
+    0xfa, 0x8f, 0x70, 0x0, 0x5, 0xfa, 0x8f, 0x70,
+    0x0, 0x5, 0xfa, 0x8f, 0x70, 0x0, 0x5, 0xfa,
+
+    /* U+69 "i" */
+    0x3f, 0x96, 0xfc, 0x4, 0x10, 0x0, 0x5f, 0xa5,
+    0xfa, 0x5f, 0xa5, 0xfa, 0x5f, 0xa5, 0xfa, 0x5f,
+    0xa5, 0xfa, 0x5f, 0xa5, 0xfa, 0x5f, 0xa5, 0xfa,
+
+    /* U+6B "k" */
+    0x7f, 0x80, 0x0, 0x0, 0x0, 0x7, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0x80, 0x0, 0x0, 0x0,
+    0x7, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x80,
+    0x0, 0x4f, 0xf3, 0x7, 0xf8, 0x0, 0x3f, 0xf4,
+    0x0, 0x7f, 0x80, 0x2e, 0xf5, 0x0, 0x7, 0xf8,
+    0x2e, 0xf7, 0x0, 0x0, 0x7f, 0x8d, 0xf8, 0x0,
+    0x0, 0x7, 0xff, 0xff, 0x60, 0x0, 0x0, 0x7f,
+    0xfc, 0xff, 0x20, 0x0, 0x7, 0xfc, 0x7, 0xfd,
+    0x0, 0x0, 0x7f, 0x80, 0xc, 0xf9, 0x0, 0x7,
+    0xf8, 0x0, 0x1e, 0xf5, 0x0, 0x7f, 0x80, 0x0,
+    0x4f, 0xe1, 0x7, 0xf8, 0x0, 0x0, 0x9f, 0xc0,
+
+    /* U+6C "l" */
+    0x5f, 0xa5, 0xfa, 0x5f, 0xa5, 0xfa, 0x5f, 0xa5,
+    0xfa, 0x5f, 0xa5, 0xfa, 0x5f, 0xa5, 0xfa, 0x5f,
+    0xa5, 0xfa, 0x5f, 0xa5, 0xfa, 0x5f, 0xa5, 0xfa,
+
+    /* U+6D "m" */
+    0x8f, 0x65, 0xcf, 0xea, 0x10, 0x4c, 0xfe, 0xb3,
+    0x8, 0xfd, 0xfc, 0xcf, 0xfe, 0x7f, 0xec, 0xef,
+    0xf2, 0x8f, 0xf3, 0x0, 0x1e, 0xff, 0x70, 0x0,
+    0xbf, 0x88, 0xf8, 0x0, 0x0, 0x7f, 0xd0, 0x0,
+    0x4, 0xfb, 0x8f, 0x70, 0x0, 0x5, 0xfa, 0x0,
+    0x0, 0x3f, 0xc8, 0xf7, 0x0, 0x0, 0x5f, 0xa0,
+    0x0, 0x3, 0xfc, 0x8f, 0x70, 0x0, 0x5, 0xfa,
+    0x0, 0x0, 0x3f, 0xc8, 0xf7, 0x0, 0x0, 0x5f,
+    0xa0, 0x0, 0x3, 0xfc, 0x8f, 0x70, 0x0, 0x5,
+    0xfa, 0x0, 0x0, 0x3f, 0xc8, 0xf7, 0x0, 0x0,
+    0x5f, 0xa0, 0x0, 0x3, 0xfc, 0x8f, 0x70, 0x0,
+    0x5, 0xfa, 0x0, 0x0, 0x3f, 0xc8, 0xf7, 0x0,
+    0x0, 0x5f, 0xa0, 0x0, 0x3, 0xfc,
+
+    /* U+6E "n" */
+    0x8f, 0x64, 0xbf, 0xeb, 0x20, 0x8f, 0xcf, 0xdc,
+    0xef, 0xe1, 0x8f, 0xf6, 0x0, 0xd, 0xf6, 0x8f,
+    0x90, 0x0, 0x7, 0xf9, 0x8f, 0x70, 0x0, 0x5,
+    0xfa, 0x8f, 0x70, 0x0, 0x5, 0xfa, 0x8f, 0x70,
+    0x0, 0x5, 0xfa, 0x8f, 0x70, 0x0, 0x5, 0xfa,
+    0x8f, 0x70, 0x0, 0x5, 0xfa, 0x8f, 0x70, 0x0,
+    0x5, 0xfa, 0x8f, 0x70, 0x0, 0x5, 0xfa, 0x8f,
+    0x70, 0x0, 0x5, 0xfa,
+
+    /* U+6F "o" */
+    0x0, 0x3, 0xbe, 0xfd, 0x70, 0x0, 0x0, 0x6f,
+    0xfc, 0xbe, 0xfd, 0x10, 0x2, 0xff, 0x50, 0x0,
+    0xbf, 0xa0, 0x9, 0xf8, 0x0, 0x0, 0xf, 0xf2,
+    0xd, 0xf2, 0x0, 0x0, 0x9, 0xf6, 0xf, 0xf0,
+    0x0, 0x0, 0x7, 0xf8, 0xf, 0xf0, 0x0, 0x0,
+    0x7, 0xf8, 0xe, 0xf2, 0x0, 0x0, 0x9, 0xf6,
+    0x9, 0xf8, 0x0, 0x0, 0xe, 0xf2, 0x2, 0xff,
+    0x40, 0x0, 0xaf, 0xb0, 0x0, 0x6f, 0xfc, 0xae,
+    0xfd, 0x10, 0x0, 0x3, 0xbe, 0xfd, 0x80, 0x0,
+
+    /* U+70 "p" */
+    0x8f, 0x57, 0xdf, 0xea, 0x10, 0x8, 0xff, 0xe9,
+    0x8d, 0xfe, 0x10, 0x8f, 0xd1, 0x0, 0xb, 0xfa,
+    0x8, 0xf7, 0x0, 0x0, 0x2f, 0xf0, 0x8f, 0x70,
+    0x0, 0x0, 0xdf, 0x38, 0xf7, 0x0, 0x0, 0xb,
+    0xf4, 0x8f, 0x70, 0x0, 0x0, 0xbf, 0x48, 0xf7,
+    0x0, 0x0, 0xd, 0xf3, 0x8f, 0x80, 0x0, 0x3,
+    0xff, 0x8, 0xfe, 0x20, 0x1, 0xcf, 0x90, 0x8f,
+    0xef, 0xba, 0xef, 0xe1, 0x8, 0xf7, 0x6d, 0xfe,
+    0xa1, 0x0, 0x8f, 0x70, 0x0, 0x0, 0x0, 0x8,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x70, 0x0,
+    0x0, 0x0, 0x8, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0x70, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+71 "q" */
+    0x0, 0x6d, 0xfe, 0x92, 0xfd, 0x9, 0xff, 0xcb,
+    0xfe, 0xfd, 0x4f, 0xf4, 0x0, 0xb, 0xfd, 0xaf,
+    0x80, 0x0, 0x2, 0xfd, 0xdf, 0x20, 0x0, 0x2,
+    0xfd, 0xff, 0x0, 0x0, 0x2, 0xfd, 0xff, 0x0,
+    0x0, 0x2, 0xfd, 0xdf, 0x20, 0x0, 0x2, 0xfd,
+    0xaf, 0x70, 0x0, 0x3, 0xfd, 0x3f, 0xf3, 0x0,
+    0xc, 0xfd, 0x9, 0xff, 0xba, 0xef, 0xfd, 0x0,
+    0x6d, 0xfe, 0x94, 0xfd, 0x0, 0x0, 0x0, 0x2,
+    0xfd, 0x0, 0x0, 0x0, 0x2, 0xfd, 0x0, 0x0,
+    0x0, 0x2, 0xfd, 0x0, 0x0, 0x0, 0x2, 0xfd,
+    0x0, 0x0, 0x0, 0x2, 0xfd,
+
+    /* U+72 "r" */
+    0x8f, 0x78, 0xef, 0x18, 0xff, 0xfd, 0xc1, 0x8f,
+    0xf3, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x8f, 0x70,
+    0x0, 0x8, 0xf7, 0x0, 0x0, 0x8f, 0x70, 0x0,
+    0x8, 0xf7, 0x0, 0x0, 0x8f, 0x70, 0x0, 0x8,
+    0xf7, 0x0, 0x0, 0x8f, 0x70, 0x0, 0x8, 0xf7,
+    0x0, 0x0,
+
+    /* U+73 "s" */
+    0x0, 0x7d, 0xfe, 0xb3, 0x0, 0xc, 0xfe, 0xbc,
+    0xff, 0x50, 0x6f, 0xb0, 0x0, 0x6f, 0xe0, 0x8f,
+    0x70, 0x0, 0x9, 0xa1, 0x5f, 0xe5, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xfc, 0x71, 0x0, 0x0, 0x16,
+    0xae, 0xff, 0x50, 0x0, 0x0, 0x0, 0x6f, 0xf1,
+    0xbc, 0x10, 0x0, 0xc, 0xf3, 0xbf, 0x90, 0x0,
+    0x2f, 0xf1, 0x2e, 0xfe, 0xab, 0xff, 0x80, 0x1,
+    0x9d, 0xfe, 0xb5, 0x0,
+
+    /* U+74 "t" */
+    0x0, 0xcf, 0x30, 0x0, 0xc, 0xf3, 0x0, 0x0,
+    0xcf, 0x30, 0xe, 0xff, 0xff, 0xf6, 0x89, 0xef,
+    0xa9, 0x30, 0xc, 0xf3, 0x0, 0x0, 0xcf, 0x30,
+    0x0, 0xc, 0xf3, 0x0, 0x0, 0xcf, 0x30, 0x0,
+    0xc, 0xf3, 0x0, 0x0, 0xcf, 0x30, 0x0, 0xc,
+    0xf3, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x7, 0xff,
+    0xb5, 0x0, 0x9, 0xff, 0x50,
+
+    /* U+75 "u" */
+    0x8f, 0x70, 0x0, 0x6, 0xf9, 0x8f, 0x70, 0x0,
+    0x6, 0xf9, 0x8f, 0x70, 0x0, 0x6, 0xf9, 0x8f,
+    0x70, 0x0, 0x6, 0xf9, 0x8f, 0x70, 0x0, 0x6,
+    0xf9, 0x8f, 0x70, 0x0, 0x6, 0xf9, 0x8f, 0x70,
+    0x0, 0x6, 0xf9, 0x8f, 0x70, 0x0, 0x6, 0xf9,
+    0x7f, 0x90, 0x0, 0x6, 0xf9, 0x4f, 0xe1, 0x0,
+    0x3e, 0xf9, 0xc, 0xfe, 0xbd, 0xfe, 0xf9, 0x1,
+    0xae, 0xfd, 0x85, 0xf9,
+
+    /* U+76 "v" */
+    0x7f, 0x80, 0x0, 0x0, 0xef, 0x11, 0xfe, 0x0,
+    0x0, 0x4f, 0xb0, 0xc, 0xf3, 0x0, 0x9, 0xf6,
+    0x0, 0x6f, 0x80, 0x0, 0xef, 0x0, 0x1, 0xfd,
+    0x0, 0x3f, 0xa0, 0x0, 0xb, 0xf2, 0x8, 0xf5,
+    0x0, 0x0, 0x5f, 0x80, 0xdf, 0x0, 0x0, 0x0,
+    0xfd, 0x2f, 0xa0, 0x0, 0x0, 0xa, 0xfa, 0xf4,
+    0x0, 0x0, 0x0, 0x5f, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0x90, 0x0, 0x0, 0x0, 0x9, 0xf4,
+    0x0, 0x0,
+
+    /* U+77 "w" */
+    0x6f, 0x90, 0x0, 0xb, 0xf2, 0x0, 0x1, 0xfd,
+    0x1, 0xfd, 0x0, 0x0, 0xff, 0x70, 0x0, 0x5f,
+    0x90, 0xd, 0xf1, 0x0, 0x5f, 0xfc, 0x0, 0x9,
+    0xf5, 0x0, 0x8f, 0x50, 0x9, 0xfa, 0xf1, 0x0,
+    0xdf, 0x0, 0x4, 0xf9, 0x0, 0xeb, 0x4f, 0x60,
+    0x1f, 0xc0, 0x0, 0xf, 0xd0, 0x3f, 0x60, 0xfb,
+    0x5, 0xf7, 0x0, 0x0, 0xbf, 0x18, 0xf1, 0xb,
+    0xf0, 0x9f, 0x30, 0x0, 0x6, 0xf5, 0xdd, 0x0,
+    0x6f, 0x5d, 0xe0, 0x0, 0x0, 0x2f, 0xbf, 0x80,
+    0x1, 0xfb, 0xfa, 0x0, 0x0, 0x0, 0xdf, 0xf3,
+    0x0, 0xc, 0xff, 0x50, 0x0, 0x0, 0x9, 0xfe,
+    0x0, 0x0, 0x7f, 0xf1, 0x0, 0x0, 0x0, 0x5f,
+    0x90, 0x0, 0x2, 0xfc, 0x0, 0x0,
+
+    /* U+78 "x" */
+    0x2f, 0xf2, 0x0, 0x5, 0xfe, 0x10, 0x7f, 0xb0,
+    0x0, 0xef, 0x50, 0x0, 0xdf, 0x50, 0x8f, 0xb0,
+    0x0, 0x3, 0xfe, 0x3f, 0xf1, 0x0, 0x0, 0x9,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0xe, 0xfc, 0x0,
+    0x0, 0x0, 0x1, 0xef, 0xd0, 0x0, 0x0, 0x0,
+    0xaf, 0xdf, 0x80, 0x0, 0x0, 0x4f, 0xd1, 0xef,
+    0x20, 0x0, 0xe, 0xf3, 0x6, 0xfc, 0x0, 0x9,
+    0xfa, 0x0, 0xc, 0xf7, 0x3, 0xff, 0x10, 0x0,
+    0x3f, 0xf2,
+
+    /* U+79 "y" */
+    0x9f, 0x90, 0x0, 0x2, 0xff, 0x3, 0xfe, 0x0,
+    0x0, 0x7f, 0xa0, 0xe, 0xf3, 0x0, 0xc, 0xf4,
+    0x0, 0x8f, 0x80, 0x1, 0xff, 0x0, 0x3, 0xfe,
+    0x0, 0x5f, 0xa0, 0x0, 0xd, 0xf3, 0xa, 0xf4,
+    0x0, 0x0, 0x8f, 0x80, 0xff, 0x0, 0x0, 0x2,
+    0xfd, 0x4f, 0xa0, 0x0, 0x0, 0xd, 0xfc, 0xf4,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xc, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xa0, 0x0, 0x0, 0x0, 0xb, 0xf3,
+    0x0, 0x0, 0x1, 0xdf, 0xfa, 0x0, 0x0, 0x0,
+    0x1f, 0xf9, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+7A "z" */
+    0xf, 0xff, 0xff, 0xff, 0xfd, 0x0, 0xaa, 0xaa,
+    0xaa, 0xef, 0xb0, 0x0, 0x0, 0x0, 0x4f, 0xf2,
+    0x0, 0x0, 0x0, 0x1e, 0xf5, 0x0, 0x0, 0x0,
+    0xb, 0xf9, 0x0, 0x0, 0x0, 0x6, 0xfd, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0xdf, 0x70, 0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0,
+    0x0, 0x0, 0x5f, 0xe1, 0x0, 0x0, 0x0, 0xe,
+    0xfd, 0xaa, 0xaa, 0xaa, 0x10, 0xff, 0xff, 0xff,
+    0xff, 0xf2,
+
+    /* U+20 " " */
+
+    /* U+21 "!" */
+    0x3f, 0xd0, 0x2f, 0xd0, 0x2f, 0xd0, 0x2f, 0xd0,
+    0x2f, 0xd0, 0x2f, 0xc0, 0x2f, 0xc0, 0x1f, 0xc0,
+    0x1f, 0xc0, 0x1f, 0xc0, 0x1f, 0xb0, 0x6, 0x40,
+    0x0, 0x0, 0x3, 0x20, 0x2f, 0xf0, 0x1e, 0xc0,
+
+    /* U+23 "#" */
+    0x0, 0x0, 0x9, 0xe0, 0x3, 0xf5, 0x0, 0x0,
+    0x0, 0xdb, 0x0, 0x7f, 0x10, 0x0, 0x0, 0xf,
+    0x80, 0xa, 0xe0, 0x0, 0x0, 0x4, 0xf4, 0x0,
+    0xea, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xb0, 0x38, 0x8d, 0xe8, 0x8a, 0xf9, 0x85, 0x0,
+    0x0, 0xdb, 0x0, 0x7f, 0x10, 0x0, 0x0, 0xf,
+    0x80, 0xa, 0xe0, 0x0, 0x0, 0x2, 0xf5, 0x0,
+    0xcb, 0x0, 0x0, 0x22, 0x6f, 0x52, 0x2f, 0xa2,
+    0x20, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1,
+    0x55, 0xdd, 0x55, 0x9f, 0x75, 0x40, 0x0, 0xe,
+    0xa0, 0x8, 0xf0, 0x0, 0x0, 0x1, 0xf7, 0x0,
+    0xbd, 0x0, 0x0, 0x0, 0x4f, 0x40, 0xe, 0xa0,
+    0x0, 0x0, 0x7, 0xf1, 0x1, 0xf7, 0x0, 0x0,
+
+    /* U+25 "%" */
+    0x6, 0xef, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xf9, 0x5c, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xcc,
+    0x0, 0x1f, 0x60, 0x2, 0xf3, 0x0, 0xd, 0x90,
+    0x0, 0xf8, 0x0, 0xcc, 0x0, 0x0, 0xcb, 0x0,
+    0xf, 0x70, 0x6f, 0x20, 0x0, 0x8, 0xf5, 0x19,
+    0xf2, 0x1f, 0x80, 0x0, 0x0, 0xa, 0xff, 0xf6,
+    0xa, 0xd0, 0x0, 0x0, 0x0, 0x1, 0x30, 0x4,
+    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xea,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8e, 0x11,
+    0xbf, 0xfa, 0x10, 0x0, 0x0, 0x3f, 0x60, 0xce,
+    0x56, 0xeb, 0x0, 0x0, 0xc, 0xc0, 0x2f, 0x50,
+    0x7, 0xf0, 0x0, 0x7, 0xf2, 0x3, 0xf3, 0x0,
+    0x5f, 0x20, 0x1, 0xf8, 0x0, 0x2f, 0x50, 0x7,
+    0xf0, 0x0, 0x6, 0x0, 0x0, 0xce, 0x67, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xae, 0xe9, 0x0,
+
+    /* U+28 "(" */
+    0x0, 0x0, 0x18, 0x0, 0x0, 0x1d, 0xe0, 0x0,
+    0xc, 0xe2, 0x0, 0x7, 0xf5, 0x0, 0x0, 0xfd,
+    0x0, 0x0, 0x6f, 0x60, 0x0, 0xc, 0xf1, 0x0,
+    0x0, 0xfd, 0x0, 0x0, 0x4f, 0xa0, 0x0, 0x6,
+    0xf8, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x8, 0xf6,
+    0x0, 0x0, 0x8f, 0x70, 0x0, 0x6, 0xf8, 0x0,
+    0x0, 0x5f, 0x90, 0x0, 0x1, 0xfc, 0x0, 0x0,
+    0xd, 0xf0, 0x0, 0x0, 0x8f, 0x50, 0x0, 0x1,
+    0xfb, 0x0, 0x0, 0x9, 0xf3, 0x0, 0x0, 0x1e,
+    0xd0, 0x0, 0x0, 0x3f, 0xa0, 0x0, 0x0, 0x3c,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+29 ")" */
+    0x45, 0x0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x8,
+    0xf4, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x5f,
+    0x70, 0x0, 0x0, 0xee, 0x0, 0x0, 0x9, 0xf4,
+    0x0, 0x0, 0x5f, 0x80, 0x0, 0x2, 0xfc, 0x0,
+    0x0, 0xf, 0xe0, 0x0, 0x0, 0xff, 0x0, 0x0,
+    0xe, 0xf1, 0x0, 0x0, 0xff, 0x0, 0x0, 0xf,
+    0xf0, 0x0, 0x1, 0xfd, 0x0, 0x0, 0x4f, 0x90,
+    0x0, 0x8, 0xf5, 0x0, 0x0, 0xcf, 0x10, 0x0,
+    0x2f, 0x90, 0x0, 0xa, 0xf2, 0x0, 0x4, 0xf7,
+    0x0, 0x3, 0xfa, 0x0, 0x0, 0x69, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+2A "*" */
+    0x0, 0x0, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xf8,
+    0x0, 0x0, 0x23, 0x0, 0xf8, 0x0, 0x30, 0x8f,
+    0xd7, 0xfa, 0x9e, 0xe0, 0x38, 0xdf, 0xff, 0xfc,
+    0x70, 0x0, 0xb, 0xff, 0x20, 0x0, 0x0, 0x6f,
+    0x8f, 0xc0, 0x0, 0x2, 0xfc, 0x7, 0xf7, 0x0,
+    0x3, 0xd2, 0x0, 0xc8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+5F "_" */
+    0x9a, 0xaa, 0xaa, 0xaa, 0xa9, 0xff, 0xff, 0xff,
+    0xff, 0xfe,
+
+    /* U+F0E7 */
+    0x0, 0x3, 0x44, 0x44, 0x43, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0xd,
+    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0xff, 0xff, 0x70, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
+    0xfe, 0x66, 0x66, 0x51, 0x8, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xa0, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0xc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x40, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xb0, 0x0, 0x1, 0x22, 0x22, 0xff, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0x90, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F1EB */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x26, 0x9c, 0xde, 0xdc, 0xb8, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8d,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xff, 0xdb, 0x99, 0x9a,
+    0xcf, 0xff, 0xff, 0xff, 0xb1, 0x0, 0xa, 0xff,
+    0xff, 0xfc, 0x61, 0x0, 0x0, 0x0, 0x0, 0x39,
+    0xef, 0xff, 0xfe, 0x40, 0xcf, 0xff, 0xfb, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0xf4, 0xaf, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xf2,
+    0xa, 0xd2, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xed,
+    0xb6, 0x20, 0x0, 0x0, 0x8e, 0x30, 0x0, 0x0,
+    0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfb,
+    0x87, 0x89, 0xdf, 0xff, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xe6, 0x0, 0x0, 0x0,
+    0x3, 0xaf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xba, 0x10, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xcf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+};
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 69, .box_w = 4, .box_h = 6, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 12, .adv_w = 97, .box_w = 6, .box_h = 2, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 18, .adv_w = 93, .box_w = 4, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 24, .adv_w = 145, .box_w = 9, .box_h = 17, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 101, .adv_w = 198, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 189, .adv_w = 198, .box_w = 7, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 245, .adv_w = 198, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 333, .adv_w = 198, .box_w = 10, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 413, .adv_w = 198, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 509, .adv_w = 198, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 597, .adv_w = 197, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 685, .adv_w = 198, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 781, .adv_w = 198, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 869, .adv_w = 198, .box_w = 10, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 949, .adv_w = 85, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 967, .adv_w = 179, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 1017, .adv_w = 193, .box_w = 10, .box_h = 6, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 1047, .adv_w = 184, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 1097, .adv_w = 166, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1177, .adv_w = 316, .box_w = 18, .box_h = 21, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 1366, .adv_w = 230, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1486, .adv_w = 219, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1582, .adv_w = 229, .box_w = 13, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1686, .adv_w = 231, .box_w = 13, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1790, .adv_w = 200, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1878, .adv_w = 195, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1966, .adv_w = 240, .box_w = 13, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2070, .adv_w = 251, .box_w = 13, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2174, .adv_w = 96, .box_w = 4, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2206, .adv_w = 194, .box_w = 11, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2294, .adv_w = 221, .box_w = 13, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2398, .adv_w = 189, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2486, .adv_w = 307, .box_w = 17, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2622, .adv_w = 251, .box_w = 13, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2726, .adv_w = 242, .box_w = 13, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2830, .adv_w = 222, .box_w = 13, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2934, .adv_w = 242, .box_w = 13, .box_h = 19, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 3058, .adv_w = 217, .box_w = 13, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3162, .adv_w = 209, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3266, .adv_w = 210, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3370, .adv_w = 228, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3466, .adv_w = 224, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3578, .adv_w = 312, .box_w = 20, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3738, .adv_w = 221, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3850, .adv_w = 211, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3962, .adv_w = 191, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4022, .adv_w = 197, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4110, .adv_w = 184, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4176, .adv_w = 199, .box_w = 10, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4256, .adv_w = 186, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4316, .adv_w = 122, .box_w = 8, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4384, .adv_w = 197, .box_w = 10, .box_h = 17, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 4469, .adv_w = 194, .box_w = 10, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4549, .adv_w = 85, .box_w = 3, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4573, .adv_w = 178, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4661, .adv_w = 85, .box_w = 3, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4685, .adv_w = 309, .box_w = 17, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4787, .adv_w = 194, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4847, .adv_w = 201, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4919, .adv_w = 197, .box_w = 11, .box_h = 17, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 5013, .adv_w = 200, .box_w = 10, .box_h = 17, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 5098, .adv_w = 119, .box_w = 7, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5140, .adv_w = 182, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5200, .adv_w = 115, .box_w = 7, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5253, .adv_w = 194, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5313, .adv_w = 171, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5379, .adv_w = 265, .box_w = 17, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5481, .adv_w = 174, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5547, .adv_w = 167, .box_w = 11, .box_h = 17, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 5641, .adv_w = 174, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5707, .adv_w = 87, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5707, .adv_w = 91, .box_w = 4, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5739, .adv_w = 219, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5843, .adv_w = 258, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5963, .adv_w = 120, .box_w = 7, .box_h = 24, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 6047, .adv_w = 122, .box_w = 7, .box_h = 24, .ofs_x = 0, .ofs_y = -6},
+    {.bitmap_index = 6131, .adv_w = 152, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 6181, .adv_w = 159, .box_w = 10, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 6191, .adv_w = 220, .box_w = 15, .box_h = 23, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 6364, .adv_w = 440, .box_w = 28, .box_h = 21, .ofs_x = 0, .ofs_y = -2}
+};
+
+static const uint16_t unicode_list_sparse[] = {
+    0x0, 0x1, 0x3, 0x5, 0x8, 0x9, 0xa, 0x3f,
+    0xf0c7, 0xf1cb
+};
+
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 44, .range_length = 14, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 60, .range_length = 29, .glyph_id_start = 16,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 97, .range_length = 8, .glyph_id_start = 46,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 107, .range_length = 15, .glyph_id_start = 55,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 32, .range_length = 61899, .glyph_id_start = 71,
+        .unicode_list = unicode_list_sparse, .glyph_id_ofs_list = NULL, .list_length = 10, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+static const uint8_t kern_left_class_mapping[] = {
+    0, 4, 0, 4, 5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 6, 7, 8,
+    9, 10, 11, 0, 12, 12, 13, 14,
+    15, 12, 12, 9, 16, 17, 18, 0,
+    19, 13, 20, 21, 22, 23, 26, 27,
+    28, 0, 29, 30, 0, 31, 0, 32,
+    0, 31, 31, 33, 27, 0, 34, 0,
+    35, 0, 36, 37, 38, 36, 39, 1,
+    0, 0, 0, 3, 0, 0, 0, 0,
+    0
+};
+
+static const uint8_t kern_right_class_mapping[] = {
+    0, 6, 7, 6, 8, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 9, 0, 10, 0, 11,
+    0, 0, 0, 11, 0, 0, 12, 0,
+    0, 0, 0, 11, 0, 11, 0, 13,
+    14, 15, 16, 17, 18, 19, 22, 0,
+    23, 23, 23, 24, 23, 0, 0, 0,
+    0, 25, 25, 26, 25, 23, 27, 28,
+    29, 30, 31, 32, 33, 31, 34, 1,
+    0, 0, 0, 0, 4, 5, 0, 0,
+    0
+};
+
+static const int8_t kern_class_values[] = {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -7, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -18, 0, 0, 0,
+    0, 0, 0, 0, -21, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -9, -10, 0, -3, -10, 0, -14, 0,
+    0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 3, 0,
+    4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -29, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -38, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -21, 0, 0, 0, 0, 0, 0, -10,
+    0, -2, 0, 0, -22, -3, -15, -12,
+    0, -16, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, -3, -2, -9, -6, 0,
+    2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -5,
+    0, -4, 0, 0, -9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -5, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -3,
+    0, 0, 0, 0, 0, -18, 0, 0,
+    0, -4, 0, 0, 0, -5, 0, -4,
+    0, -4, -7, -4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -3, 0, -3, 0, 0, 0,
+    -3, -4, -4, 0, 0, 0, 0, 0,
+    0, 0, 0, -40, 0, 0, 0, -29,
+    0, -45, 0, 3, 0, 0, 0, 0,
+    0, 0, 0, -6, -4, 0, 0, -4,
+    -4, 0, 0, -4, -4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3, 0, 0, 0, -5, 0,
+    0, 0, 3, -5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -11, 0, 0,
+    0, -5, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -4, 0, -4,
+    -5, 0, 0, 0, -4, -7, -11, 0,
+    0, 0, 0, -58, 0, 0, 0, 0,
+    0, 0, 0, 3, -11, 0, 0, -47,
+    -9, -30, -25, 0, -41, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -8,
+    -23, -16, 0, 0, 0, 0, 0, 0,
+    0, 0, -56, 0, 0, 0, -24, 0,
+    -34, 0, 0, 0, 0, 0, -5, 0,
+    -4, 0, -2, -2, 0, 0, -2, 0,
+    0, 2, 0, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -7, 0, -5,
+    -3, 0, -6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -14, 0, -3, 0, 0, -8, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -7, 0,
+    0, 0, 0, -37, -40, 0, 0, -14,
+    -5, -41, -3, 3, 0, 3, 3, 0,
+    3, 0, 0, -19, -17, 0, -19, -17,
+    -13, -20, 0, -16, -12, -10, -13, -10,
+    0, 0, 0, 0, 3, 0, -39, -6,
+    0, 0, -13, -2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, -8, -8,
+    0, 0, -8, -5, 0, 0, -5, -2,
+    0, 0, 0, 3, 0, 0, 0, 3,
+    0, -21, -10, 0, 0, -7, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0,
+    2, -6, -5, 0, 0, -5, -4, 0,
+    0, -3, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, -8, 0, 0,
+    0, -4, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, -4, 0, 0,
+    -4, 0, 0, 0, -4, -5, 0, 0,
+    0, 0, 0, 0, -5, 3, -8, -36,
+    -9, 0, 0, -16, -5, -16, -3, 3,
+    -16, 3, 3, 2, 3, 0, 3, -13,
+    -11, -4, -7, -11, -7, -10, -4, -7,
+    -3, 0, -4, -5, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, -4,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, 0, 0, -4, 0,
+    0, 0, -3, -5, -5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 0, -3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -12, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, 0, 0, 0, 0, -5,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, -3, -3,
+    0, 0, -2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0,
+    3, 0, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, 0, -4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 0, -18, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -23, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -3, 0,
+    -4, -3, 0, 0, 3, 0, 0, 0,
+    -21, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -7, -3, 3, 0, -3, 0, 0, 9,
+    0, 3, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3, 0, 0, 0, -18, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -3, -2,
+    2, 0, -3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -21, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -3, 0, 0,
+    -3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -3, 0, 0, -3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -3, 0, 0, -3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 40,
+    .right_class_cnt     = 35,
+};
+
+static lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap  = glyph_bitmap,
+    .glyph_dsc     = glyph_dsc,
+    .cmaps         = cmaps,
+    .kern_dsc      = &kern_classes,
+    .kern_scale    = 16,
+    .cmap_num      = 5,
+    .bpp           = 4,
+    .kern_classes  = 1,
+    .bitmap_format = 0,
+};
+
+lv_font_t lv_font_roboto_22_subset = {
+    .get_glyph_dsc    = lv_port_font_subset_get_glyph_dsc,
+    .get_glyph_bitmap = lv_port_font_subset_get_glyph_bitmap,
+    .line_height      = 26,
+    .base_line        = 6,
+    .subpx            = LV_FONT_SUBPX_NONE,
+    .dsc              = &font_dsc,
+};
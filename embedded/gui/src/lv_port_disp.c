@@ -10,13 +10,18 @@
 /*********************
  *      INCLUDES
  *********************/
+#include <stdio.h>
+#include <string.h>
 #include "lv_port_disp.h"
 #include "display.h"
 #include "configuration.h"
+#include "system_time.h"
 
 /*********************
  *      DEFINES
  *********************/
+#define DISP_STATS_FPS_PERIOD_MS ( 1000 )
+#define DISP_STATS_OVERLAY_TEXT_LENGTH ( 48 )
 
 /**********************
  *      TYPEDEFS
@@ -28,6 +33,13 @@
 static void disp_init( void );
 
 static void disp_flush( lv_disp_drv_t* disp_drv, const lv_area_t* area, lv_color_t* color_p );
+static void disp_refr_task( lv_task_t* task );
+static void disp_monitor( lv_disp_drv_t* disp_drv, uint32_t time, uint32_t px );
+static void disp_stats_update_fps( void );
+#if LV_PORT_DISP_STATS_OVERLAY
+static void disp_stats_overlay_init( void );
+static void disp_stats_overlay_task( lv_task_t* task );
+#endif
 #if LV_USE_GPU
 static void gpu_blend( lv_color_t* dest, const lv_color_t* src, uint32_t length, lv_opa_t opa );
 static void gpu_fill( lv_color_t* dest, uint32_t length, lv_color_t color );
@@ -36,6 +48,12 @@ static void gpu_fill( lv_color_t* dest, uint32_t length, lv_color_t color );
 /**********************
  *  STATIC VARIABLES
  **********************/
+static lv_port_disp_stats_t disp_stats;
+static uint64_t             disp_frame_start_us;
+static uint32_t             disp_frame_flush_time_us;
+static uint32_t             disp_frame_area_px;
+static uint32_t             disp_fps_period_start_ms;
+static uint32_t             disp_fps_period_frame_count;
 
 /**********************
  *      MACROS
@@ -133,8 +151,33 @@ void lv_port_disp_init( void )
     disp_drv.gpu_fill = gpu_fill;
 #endif
 
+    /*Called at the end of each frame, to collect the statistics*/
+    disp_drv.monitor_cb = disp_monitor;
+
     /*Finally register the driver*/
-    lv_disp_drv_register( &disp_drv );
+    lv_disp_t* disp = lv_disp_drv_register( &disp_drv );
+
+    /*Time the refresh task, which renders and flushes a frame*/
+    lv_task_set_cb( disp->refr_task, disp_refr_task );
+
+    lv_port_disp_reset_stats( );
+
+#if LV_PORT_DISP_STATS_OVERLAY
+    disp_stats_overlay_init( );
+#endif
+}
+
+void lv_port_disp_get_stats( lv_port_disp_stats_t* stats )
+{
+    disp_stats_update_fps( );
+    *stats = disp_stats;
+}
+
+void lv_port_disp_reset_stats( void )
+{
+    memset( &disp_stats, 0, sizeof( disp_stats ) );
+    disp_fps_period_start_ms    = lv_tick_get( );
+    disp_fps_period_frame_count = 0;
 }
 
 /**********************
@@ -149,11 +192,7 @@ static void disp_init( void ) { display_init( ); }
  * background but 'lv_disp_flush_ready()' has to be called when finished. */
 static void disp_flush( lv_disp_drv_t* disp_drv, const lv_area_t* area, lv_color_t* color_p )
 {
-    /*The most simple case (but also the slowest) to put all pixels to the
-     * screen one-by-one*/
-
-    int32_t x;
-    int32_t y;
+    const uint64_t start_us = system_time_get_us( );
 
     LL_GPIO_ResetOutputPin( DISPLAY_NSS_PORT, DISPLAY_NSS_PIN );
 
@@ -167,23 +206,120 @@ static void disp_flush( lv_disp_drv_t* disp_drv, const lv_area_t* area, lv_color
 
     display_send_command( 0x2C );
 
-    for( y = area->y1; y <= area->y2; y++ )
-    {
-        for( x = area->x1; x <= area->x2; x++ )
-        {
-            /* Put a pixel to the display. For example: */
-            display_send_data( color_p->full );
-            color_p++;
-        }
-    }
+    /* The area is stored row by row in the buffer: stream it in a single block of 16-bit frames */
+    display_send_data_block( &( color_p->full ), lv_area_get_size( area ) );
 
     LL_GPIO_SetOutputPin( DISPLAY_NSS_PORT, DISPLAY_NSS_PIN );
 
+    disp_frame_flush_time_us += ( uint32_t )( system_time_get_us( ) - start_us );
+    disp_frame_area_px += lv_area_get_size( area );
+
     /* IMPORTANT!!!
      * Inform the graphics library that you are ready with the flushing*/
     lv_disp_flush_ready( disp_drv );
 }
 
+static void disp_refr_task( lv_task_t* task )
+{
+    disp_frame_start_us      = system_time_get_us( );
+    disp_frame_flush_time_us = 0;
+    disp_frame_area_px       = 0;
+
+    lv_disp_refr_task( task );
+}
+
+/* Called by the refresh task once a frame has been drawn */
+static void disp_monitor( lv_disp_drv_t* disp_drv, uint32_t time, uint32_t px )
+{
+    const uint32_t frame_time_us = ( uint32_t )( system_time_get_us( ) - disp_frame_start_us );
+    const uint32_t render_time_us =
+        ( frame_time_us > disp_frame_flush_time_us ) ? ( frame_time_us - disp_frame_flush_time_us ) : 0;
+
+    disp_stats.render_time_us_last = render_time_us;
+    disp_stats.flush_time_us_last  = disp_frame_flush_time_us;
+    disp_stats.area_px_last        = disp_frame_area_px;
+
+    disp_stats.frame_count++;
+    disp_stats.render_time_us_total += render_time_us;
+    disp_stats.flush_time_us_total += disp_frame_flush_time_us;
+    disp_stats.area_px_total += disp_frame_area_px;
+
+    if( render_time_us > disp_stats.render_time_us_max )
+    {
+        disp_stats.render_time_us_max = render_time_us;
+    }
+    if( disp_frame_flush_time_us > disp_stats.flush_time_us_max )
+    {
+        disp_stats.flush_time_us_max = disp_frame_flush_time_us;
+    }
+    if( disp_frame_area_px > disp_stats.area_px_max )
+    {
+        disp_stats.area_px_max = disp_frame_area_px;
+    }
+
+    disp_fps_period_frame_count++;
+    disp_stats_update_fps( );
+}
+
+static void disp_stats_update_fps( void )
+{
+    const uint32_t elapsed_ms = lv_tick_elaps( disp_fps_period_start_ms );
+
+    if( elapsed_ms >= DISP_STATS_FPS_PERIOD_MS )
+    {
+        disp_stats.frames_per_second = ( disp_fps_period_frame_count * 1000 ) / elapsed_ms;
+        disp_fps_period_start_ms     = lv_tick_get( );
+        disp_fps_period_frame_count  = 0;
+    }
+}
+
+#if LV_PORT_DISP_STATS_OVERLAY
+static void disp_stats_overlay_init( void )
+{
+    static lv_style_t style;
+
+    lv_style_copy( &style, &lv_style_plain );
+    style.body.main_color = LV_COLOR_BLACK;
+    style.body.grad_color = LV_COLOR_BLACK;
+    style.body.opa        = LV_OPA_70;
+    style.text.color      = LV_COLOR_WHITE;
+
+    lv_obj_t* label = lv_label_create( lv_layer_top( ), NULL );
+    lv_label_set_style( label, LV_LABEL_STYLE_MAIN, &style );
+    lv_label_set_body_draw( label, true );
+    lv_label_set_static_text( label, "" );
+    lv_obj_align( label, NULL, LV_ALIGN_IN_BOTTOM_LEFT, 0, 0 );
+
+    lv_task_create( disp_stats_overlay_task, DISP_STATS_FPS_PERIOD_MS, LV_TASK_PRIO_LOW, label );
+}
+
+/* Show the frame rate and the average render time, flush time and area of the frames drawn during the last period.
+ * Updating the overlay draws a frame of its own every period */
+static void disp_stats_overlay_task( lv_task_t* task )
+{
+    static lv_port_disp_stats_t previous;
+    static char                 text[DISP_STATS_OVERLAY_TEXT_LENGTH];
+    lv_port_disp_stats_t        current;
+
+    lv_port_disp_get_stats( &current );
+
+    /*Nothing to show if no frame was drawn, or if the statistics were reset, during the last period*/
+    if( current.frame_count > previous.frame_count )
+    {
+        const uint32_t frame_count = current.frame_count - previous.frame_count;
+
+        snprintf( text, DISP_STATS_OVERLAY_TEXT_LENGTH, "%lu fps R %lu F %lu us %lu px",
+                  ( unsigned long ) current.frames_per_second,
+                  ( unsigned long ) ( ( current.render_time_us_total - previous.render_time_us_total ) / frame_count ),
+                  ( unsigned long ) ( ( current.flush_time_us_total - previous.flush_time_us_total ) / frame_count ),
+                  ( unsigned long ) ( ( current.area_px_total - previous.area_px_total ) / frame_count ) );
+        lv_label_set_static_text( ( lv_obj_t* ) task->user_data, text );
+    }
+
+    previous = current;
+}
+#endif
+
 /*OPTIONAL: GPU INTERFACE*/
 #if LV_USE_GPU
 
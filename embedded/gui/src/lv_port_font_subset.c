@@ -0,0 +1,58 @@
+/**
+ * @file      lv_port_font_subset.c
+ *
+ * @brief     Implementation of the glyph lookup of the subsetted fonts.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "lv_port_font_subset.h"
+
+static uint32_t lv_port_font_subset_get_drawn_letter( const lv_font_t* font, uint32_t unicode_letter );
+
+bool lv_port_font_subset_get_glyph_dsc( const lv_font_t* font, lv_font_glyph_dsc_t* dsc_out, uint32_t unicode_letter,
+                                        uint32_t unicode_letter_next )
+{
+    return lv_font_get_glyph_dsc_fmt_txt( font, dsc_out, lv_port_font_subset_get_drawn_letter( font, unicode_letter ),
+                                          unicode_letter_next );
+}
+
+const uint8_t* lv_port_font_subset_get_glyph_bitmap( const lv_font_t* font, uint32_t unicode_letter )
+{
+    return lv_font_get_bitmap_fmt_txt( font, lv_port_font_subset_get_drawn_letter( font, unicode_letter ) );
+}
+
+static uint32_t lv_port_font_subset_get_drawn_letter( const lv_font_t* font, uint32_t unicode_letter )
+{
+    lv_font_glyph_dsc_t dsc;
+
+    if( ( unicode_letter < 0x20 ) || lv_font_get_glyph_dsc_fmt_txt( font, &dsc, unicode_letter, 0 ) )
+    {
+        return unicode_letter;
+    }
+
+    return LV_PORT_FONT_SUBSET_FALLBACK_LETTER;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file      lv_port_img_rle.c
+ *
+ * @brief     Implementation of the LVGL decoder for run-length encoded palette images.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "lv_port_img_rle.h"
+
+#define LV_PORT_IMG_RLE_PALETTE_COLOR_SIZE ( 3 )
+#define LV_PORT_IMG_RLE_ROW_INDEX_SIZE ( 2 )
+#define LV_PORT_IMG_RLE_RUN_SIZE ( 2 )
+
+static lv_res_t lv_port_img_rle_info( lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header );
+static lv_res_t lv_port_img_rle_open( lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc );
+static lv_res_t lv_port_img_rle_read_line( lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc, lv_coord_t x,
+                                           lv_coord_t y, lv_coord_t len, uint8_t* buf );
+
+void lv_port_img_rle_init( void )
+{
+    lv_img_decoder_t* decoder = lv_img_decoder_create( );
+
+    lv_img_decoder_set_info_cb( decoder, lv_port_img_rle_info );
+    lv_img_decoder_set_open_cb( decoder, lv_port_img_rle_open );
+    lv_img_decoder_set_read_line_cb( decoder, lv_port_img_rle_read_line );
+}
+
+static lv_res_t lv_port_img_rle_info( lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header )
+{
+    if( lv_img_src_get_type( src ) != LV_IMG_SRC_VARIABLE )
+    {
+        return LV_RES_INV;
+    }
+
+    const lv_img_dsc_t* img_dsc = ( const lv_img_dsc_t* ) src;
+    if( img_dsc->header.cf != LV_IMG_CF_RLE_PALETTE )
+    {
+        return LV_RES_INV;
+    }
+
+    *header = img_dsc->header;
+    return LV_RES_OK;
+}
+
+static lv_res_t lv_port_img_rle_open( lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc )
+{
+    // No decoded pixel array: LVGL reads the image row by row while drawing it
+    dsc->img_data = NULL;
+    return LV_RES_OK;
+}
+
+static lv_res_t lv_port_img_rle_read_line( lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc, lv_coord_t x,
+                                           lv_coord_t y, lv_coord_t len, uint8_t* buf )
+{
+    const lv_img_dsc_t* img_dsc      = ( const lv_img_dsc_t* ) dsc->src;
+    const uint8_t*      palette      = &img_dsc->data[1];
+    const uint8_t*      row_indexes  = &palette[img_dsc->data[0] * LV_PORT_IMG_RLE_PALETTE_COLOR_SIZE];
+    const uint8_t*      runs         = &row_indexes[img_dsc->header.h * LV_PORT_IMG_RLE_ROW_INDEX_SIZE];
+    const uint8_t*      row_index    = &row_indexes[y * LV_PORT_IMG_RLE_ROW_INDEX_SIZE];
+    const uint8_t*      run          = &runs[( row_index[0] + ( row_index[1] << 8 ) ) * LV_PORT_IMG_RLE_RUN_SIZE];
+    lv_color_t*         pixels       = ( lv_color_t* ) buf;
+    lv_coord_t          run_start_x  = 0;
+    lv_coord_t          nb_px_copied = 0;
+
+    // Skip the runs ending before the first requested pixel
+    while( run_start_x + run[0] <= x )
+    {
+        run_start_x += run[0];
+        run += LV_PORT_IMG_RLE_RUN_SIZE;
+    }
+
+    while( nb_px_copied < len )
+    {
+        const uint8_t*   rgb       = &palette[run[1] * LV_PORT_IMG_RLE_PALETTE_COLOR_SIZE];
+        const lv_color_t color     = lv_color_make( rgb[0], rgb[1], rgb[2] );
+        const lv_coord_t run_end_x = LV_MATH_MIN( run_start_x + run[0], x + len );
+
+        for( lv_coord_t px_x = LV_MATH_MAX( run_start_x, x ); px_x < run_end_x; px_x++ )
+        {
+            pixels[nb_px_copied++] = color;
+        }
+
+        run_start_x += run[0];
+        run += LV_PORT_IMG_RLE_RUN_SIZE;
+    }
+
+    return LV_RES_OK;
+}
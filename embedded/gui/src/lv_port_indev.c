@@ -27,8 +27,7 @@
 
 static void touchpad_init( void );
 static bool touchpad_read( lv_indev_drv_t* indev_drv, lv_indev_data_t* data );
-static bool touchpad_is_pressed( void );
-static void touchpad_get_xy( lv_coord_t* x, lv_coord_t* y );
+static bool touchpad_get_xy( lv_coord_t* x, lv_coord_t* y );
 
 /**********************
  *  STATIC VARIABLES
@@ -87,20 +86,19 @@ static void touchpad_init( void ) { touch_init( ); }
 /* Will be called by the library to read the touchpad */
 static bool touchpad_read( lv_indev_drv_t* indev_drv, lv_indev_data_t* data )
 {
-    static lv_coord_t last_x = 0;
-    static lv_coord_t last_y = 0;
+    static lv_coord_t last_x     = 0;
+    static lv_coord_t last_y     = 0;
+    static bool       is_pressed = false;
 
-    /*Save the pressed coordinates and the state*/
-    if( touchpad_is_pressed( ) )
+    /*The touch controller holds its interrupt line while touched: there is nothing new to read from it unless the line
+     * changed or a touch is in progress*/
+    if( touch_has_pending_interrupt( ) || is_pressed )
     {
-        touchpad_get_xy( &last_x, &last_y );
-        data->state = LV_INDEV_STATE_PR;
-    }
-    else
-    {
-        data->state = LV_INDEV_STATE_REL;
+        is_pressed = touchpad_get_xy( &last_x, &last_y );
     }
 
+    data->state = is_pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+
     /*Set the last pressed coordinates*/
     data->point.x = last_x;
     data->point.y = last_y;
@@ -109,11 +107,8 @@ static bool touchpad_read( lv_indev_drv_t* indev_drv, lv_indev_data_t* data )
     return false;
 }
 
-/*Return true is the touchpad is pressed*/
-static bool touchpad_is_pressed( void ) { return touch_is_touched( ); }
-
-/*Get the x and y coordinates if the touchpad is pressed*/
-static void touchpad_get_xy( lv_coord_t* x, lv_coord_t* y )
+/*Get the x and y coordinates if the touchpad is pressed, and return true if the touchpad is pressed*/
+static bool touchpad_get_xy( lv_coord_t* x, lv_coord_t* y )
 {
     bool     touch;
     uint16_t posX;
@@ -121,8 +116,13 @@ static void touchpad_get_xy( lv_coord_t* x, lv_coord_t* y )
 
     readTouchData( &posX, &posY, &touch );
 
-    ( *x ) = 240 - posX;
-    ( *y ) = 320 - posY;
+    if( touch == true )
+    {
+        ( *x ) = 240 - posX;
+        ( *y ) = 320 - posY;
+    }
+
+    return touch;
 }
 
 #else /* Enable this file at the top */
@@ -0,0 +1,486 @@
+"""
+Generate a glyph subset of an LVGL font from the strings used by the GUI
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from argparse import ArgumentParser
+import os
+import re
+import sys
+
+# Must match LV_PORT_FONT_SUBSET_FALLBACK_LETTER of lv_port_font_subset.h
+FALLBACK_LETTER = ord("?")
+
+# Contiguous letters shorter than this go to the sparse character mapping
+MIN_FORMAT0_RUN_LENGTH = 8
+
+BYTES_PER_LINE = 8
+
+GLYPH_DSC_REGEX = re.compile(
+    r"\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+), "
+    r"\.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}"
+)
+CMAP_REGEX = re.compile(
+    r"\.range_start = (\d+), \.range_length = (\d+), \.glyph_id_start = (\d+),\s*"
+    r"\.unicode_list = (\w+), \.glyph_id_ofs_list = (\w+), \.list_length = (\d+), "
+    r"\.type = (\w+)"
+)
+STRING_LITERAL_REGEX = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+SYMBOL_NAME_REGEX = re.compile(r"\bLV_SYMBOL_\w+")
+SYMBOL_DEFINITION_REGEX = re.compile(r'#define\s+(LV_SYMBOL_\w+)\s+"((?:[^"\\]|\\.)*)"')
+SIMPLE_ESCAPES = {
+    "n": 0x0A,
+    "t": 0x09,
+    "r": 0x0D,
+    "0": 0x00,
+    "\\": 0x5C,
+    '"': 0x22,
+    "'": 0x27,
+}
+
+
+class FontParseError(Exception):
+    pass
+
+
+class Glyph:
+    def __init__(self, bitmap, adv_w, box_w, box_h, ofs_x, ofs_y):
+        self.bitmap = bitmap
+        self.adv_w = adv_w
+        self.box_w = box_w
+        self.box_h = box_h
+        self.ofs_x = ofs_x
+        self.ofs_y = ofs_y
+
+
+class Font:
+    def __init__(self):
+        self.glyphs = dict()
+        self.left_class_mapping = dict()
+        self.right_class_mapping = dict()
+        self.kern_class_values = list()
+        self.left_class_cnt = None
+        self.right_class_cnt = None
+        self.kern_scale = None
+        self.bpp = None
+        self.line_height = None
+        self.base_line = None
+        self.subpx = None
+
+
+def strip_c_comments(text):
+    return re.sub(r"/\*.*?\*/|//[^\n]*", "", text, flags=re.DOTALL)
+
+
+def get_c_block(text, declaration):
+    start = text.find(declaration)
+    if start < 0:
+        raise FontParseError("Cannot find '{}'".format(declaration))
+    opening = text.index("{", start)
+    closing = text.index("};", opening)
+    return text[opening + 1 : closing]
+
+
+def get_c_field(text, field):
+    match = re.search(r"\.{}\s*=\s*([\w-]+)".format(field), text)
+    if match is None:
+        raise FontParseError("Cannot find field '{}'".format(field))
+    return match.group(1)
+
+
+def get_c_integers(text):
+    return [int(value, 0) for value in re.findall(r"-?0x[0-9a-fA-F]+|-?\d+", text)]
+
+
+def decode_c_string(literal):
+    raw = bytearray()
+    index = 0
+    while index < len(literal):
+        character = literal[index]
+        if character != "\\":
+            raw += character.encode("utf-8")
+            index += 1
+            continue
+        escape = literal[index + 1]
+        if escape == "x":
+            digits = re.match(r"[0-9a-fA-F]+", literal[index + 2 :]).group(0)
+            raw.append(int(digits, 16) & 0xFF)
+            index += 2 + len(digits)
+        else:
+            raw.append(SIMPLE_ESCAPES.get(escape, ord(escape)))
+            index += 2
+    return raw.decode("utf-8", errors="ignore")
+
+
+def parse_font(path):
+    with open(path, "r") as font_file:
+        text = strip_c_comments(font_file.read())
+
+    font = Font()
+    font.bpp = int(get_c_field(text, "bpp"))
+    font.kern_scale = int(get_c_field(text, "kern_scale"))
+    font.line_height = int(get_c_field(text, "line_height"))
+    font.base_line = int(get_c_field(text, "base_line"))
+    font.subpx = get_c_field(text, "subpx")
+    if int(get_c_field(text, "bitmap_format")) != 0:
+        raise FontParseError("Only fonts with plain bitmaps are supported")
+    if int(get_c_field(text, "kern_classes")) != 1:
+        raise FontParseError("Only fonts with kerning classes are supported")
+
+    bitmap = bytes(get_c_integers(get_c_block(text, "gylph_bitmap[]")))
+    descriptions = [
+        [int(value) for value in match]
+        for match in GLYPH_DSC_REGEX.findall(get_c_block(text, "glyph_dsc[]"))
+    ]
+    left_mapping = get_c_integers(get_c_block(text, "kern_left_class_mapping[]"))
+    right_mapping = get_c_integers(get_c_block(text, "kern_right_class_mapping[]"))
+    font.kern_class_values = get_c_integers(get_c_block(text, "kern_class_values[]"))
+    kern_classes = get_c_block(text, "kern_classes =")
+    font.left_class_cnt = int(get_c_field(kern_classes, "left_class_cnt"))
+    font.right_class_cnt = int(get_c_field(kern_classes, "right_class_cnt"))
+
+    # The bitmap of a glyph ends where the next one starts
+    bitmap_indexes = sorted(set(description[0] for description in descriptions))
+    bitmap_end_of = dict(zip(bitmap_indexes, bitmap_indexes[1:] + [len(bitmap)]))
+
+    for (
+        range_start,
+        range_length,
+        glyph_id_start,
+        unicode_list,
+        glyph_id_ofs_list,
+        list_length,
+        cmap_type,
+    ) in CMAP_REGEX.findall(get_c_block(text, "cmaps[] =")):
+        range_start = int(range_start)
+        glyph_id_start = int(glyph_id_start)
+        if cmap_type == "LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY":
+            offsets = range(int(range_length))
+        elif cmap_type == "LV_FONT_FMT_TXT_CMAP_SPARSE_TINY":
+            offsets = get_c_integers(get_c_block(text, "{}[]".format(unicode_list)))
+        else:
+            raise FontParseError("Unsupported character mapping {}".format(cmap_type))
+        for index, offset in enumerate(offsets):
+            glyph_id = glyph_id_start + index
+            bitmap_index, adv_w, box_w, box_h, ofs_x, ofs_y = descriptions[glyph_id]
+            glyph_bitmap = b""
+            if box_w * box_h > 0:
+                glyph_bitmap = bitmap[bitmap_index : bitmap_end_of[bitmap_index]]
+            letter = range_start + offset
+            font.glyphs[letter] = Glyph(glyph_bitmap, adv_w, box_w, box_h, ofs_x, ofs_y)
+            font.left_class_mapping[letter] = left_mapping[glyph_id]
+            font.right_class_mapping[letter] = right_mapping[glyph_id]
+
+    return font
+
+
+def parse_symbol_definitions(path):
+    with open(path, "r") as symbol_file:
+        text = symbol_file.read()
+    return {
+        name: ord(decode_c_string(value))
+        for name, value in SYMBOL_DEFINITION_REGEX.findall(text)
+        if len(decode_c_string(value)) == 1
+    }
+
+
+def scan_sources(paths, symbol_definitions):
+    letters = set()
+    for path in paths:
+        with open(path, "r") as source_file:
+            text = strip_c_comments(source_file.read())
+        for literal in STRING_LITERAL_REGEX.findall(text):
+            letters.update(ord(character) for character in decode_c_string(literal))
+        for name in SYMBOL_NAME_REGEX.findall(text):
+            if name in symbol_definitions:
+                letters.add(symbol_definitions[name])
+    return letters
+
+
+def parse_range(text):
+    first, _, last = text.partition("-")
+    return range(int(first, 0), int(last or first, 0) + 1)
+
+
+def split_cmaps(letters):
+    runs = list()
+    for letter in letters:
+        if runs and runs[-1][-1] + 1 == letter:
+            runs[-1].append(letter)
+        else:
+            runs.append([letter])
+    format0_runs = [run for run in runs if len(run) >= MIN_FORMAT0_RUN_LENGTH]
+    sparse_letters = [
+        letter for run in runs if len(run) < MIN_FORMAT0_RUN_LENGTH for letter in run
+    ]
+    return format0_runs, sparse_letters
+
+
+def format_letter(letter):
+    escapes = {"\\": "\\\\", '"': '\\"'}
+    if letter < 0x7F:
+        return 'U+{:X} "{}"'.format(letter, escapes.get(chr(letter), chr(letter)))
+    return "U+{:X}".format(letter)
+
+
+def format_letter_list(letters):
+    names = ["0x{:X}".format(letter) for letter in letters]
+    return "\n".join(
+        " *   " + " ".join(names[start : start + 16])
+        for start in range(0, len(names), 16)
+    )
+
+
+def format_values(values, format_value, indent="    "):
+    lines = list()
+    for start in range(0, len(values), BYTES_PER_LINE):
+        chunk = values[start : start + BYTES_PER_LINE]
+        lines.append(indent + ", ".join(format_value(value) for value in chunk))
+    return ",\n".join(lines)
+
+
+def generate(font, letters, name, source_name):
+    format0_runs, sparse_letters = split_cmaps(letters)
+    # Glyph ids follow the order of the character mappings
+    ordered_letters = [
+        letter for run in format0_runs for letter in run
+    ] + sparse_letters
+    output = list()
+
+    output.append(
+        "/*\n"
+        " * Glyph subset of {source} generated by gui/tools/lv_font_subset.py.\n"
+        " * Do not edit: regenerated by the build when the strings of the GUI change.\n"
+        " * Letters:\n"
+        "{letters}\n"
+        " */\n\n"
+        '#include "lvgl.h"\n'
+        '#include "lv_port_font_subset.h"\n\n'.format(
+            source=source_name,
+            letters=format_letter_list(letters),
+        )
+    )
+
+    output.append("static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {\n")
+    bitmap_chunks = list()
+    bitmap_indexes = list()
+    bitmap_index = 0
+    for letter in ordered_letters:
+        glyph = font.glyphs[letter]
+        bitmap_indexes.append(bitmap_index)
+        chunk = "    /* {} */\n".format(format_letter(letter))
+        if glyph.bitmap:
+            chunk += format_values(list(glyph.bitmap), lambda value: hex(value)) + ",\n"
+        bitmap_chunks.append(chunk)
+        bitmap_index += len(glyph.bitmap)
+    output.append("\n".join(bitmap_chunks))
+    output.append("};\n\n")
+
+    output.append("static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {\n")
+    descriptions = [
+        "    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, "
+        ".ofs_y = 0} /* id = 0 reserved */"
+    ]
+    for letter, bitmap_index in zip(ordered_letters, bitmap_indexes):
+        glyph = font.glyphs[letter]
+        descriptions.append(
+            "    {{.bitmap_index = {}, .adv_w = {}, .box_w = {}, .box_h = {}, "
+            ".ofs_x = {}, .ofs_y = {}}}".format(
+                bitmap_index,
+                glyph.adv_w,
+                glyph.box_w,
+                glyph.box_h,
+                glyph.ofs_x,
+                glyph.ofs_y,
+            )
+        )
+    output.append(",\n".join(descriptions))
+    output.append("\n};\n\n")
+
+    cmaps = list()
+    glyph_id_start = 1
+    for run in format0_runs:
+        # The lookup of LVGL includes range_start + range_length in the range
+        cmaps.append(
+            "    {{\n"
+            "        .range_start = {}, .range_length = {}, .glyph_id_start = {},\n"
+            "        .unicode_list = NULL, .glyph_id_ofs_list = NULL, "
+            ".list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY\n"
+            "    }}".format(run[0], len(run) - 1, glyph_id_start)
+        )
+        glyph_id_start += len(run)
+    if sparse_letters:
+        # Kept last: a letter in its range but not in its list is not searched further
+        output.append("static const uint16_t unicode_list_sparse[] = {\n")
+        output.append(
+            format_values(
+                [letter - sparse_letters[0] for letter in sparse_letters],
+                lambda value: hex(value),
+            )
+        )
+        output.append("\n};\n\n")
+        cmaps.append(
+            "    {{\n"
+            "        .range_start = {}, .range_length = {}, .glyph_id_start = {},\n"
+            "        .unicode_list = unicode_list_sparse, .glyph_id_ofs_list = NULL, "
+            ".list_length = {}, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY\n"
+            "    }}".format(
+                sparse_letters[0],
+                sparse_letters[-1] - sparse_letters[0],
+                glyph_id_start,
+                len(sparse_letters),
+            )
+        )
+    output.append("static const lv_font_fmt_txt_cmap_t cmaps[] = {\n")
+    output.append(",\n".join(cmaps))
+    output.append("\n};\n\n")
+
+    for side, mapping in (
+        ("left", font.left_class_mapping),
+        ("right", font.right_class_mapping),
+    ):
+        output.append(
+            "static const uint8_t kern_{}_class_mapping[] = {{\n".format(side)
+        )
+        output.append(
+            format_values(
+                [0] + [mapping[letter] for letter in ordered_letters], lambda v: str(v)
+            )
+        )
+        output.append("\n};\n\n")
+
+    output.append("static const int8_t kern_class_values[] = {\n")
+    output.append(format_values(font.kern_class_values, lambda value: str(value)))
+    output.append("\n};\n\n")
+
+    output.append(
+        "static const lv_font_fmt_txt_kern_classes_t kern_classes = {{\n"
+        "    .class_pair_values   = kern_class_values,\n"
+        "    .left_class_mapping  = kern_left_class_mapping,\n"
+        "    .right_class_mapping = kern_right_class_mapping,\n"
+        "    .left_class_cnt      = {},\n"
+        "    .right_class_cnt     = {},\n"
+        "}};\n\n"
+        "static lv_font_fmt_txt_dsc_t font_dsc = {{\n"
+        "    .glyph_bitmap  = glyph_bitmap,\n"
+        "    .glyph_dsc     = glyph_dsc,\n"
+        "    .cmaps         = cmaps,\n"
+        "    .kern_dsc      = &kern_classes,\n"
+        "    .kern_scale    = {},\n"
+        "    .cmap_num      = {},\n"
+        "    .bpp           = {},\n"
+        "    .kern_classes  = 1,\n"
+        "    .bitmap_format = 0,\n"
+        "}};\n\n"
+        "lv_font_t {} = {{\n"
+        "    .get_glyph_dsc    = lv_port_font_subset_get_glyph_dsc,\n"
+        "    .get_glyph_bitmap = lv_port_font_subset_get_glyph_bitmap,\n"
+        "    .line_height      = {},\n"
+        "    .base_line        = {},\n"
+        "    .subpx            = {},\n"
+        "    .dsc              = &font_dsc,\n"
+        "}};\n".format(
+            font.left_class_cnt,
+            font.right_class_cnt,
+            font.kern_scale,
+            len(cmaps),
+            font.bpp,
+            name,
+            font.line_height,
+            font.base_line,
+            font.subpx,
+        )
+    )
+
+    return "".join(output)
+
+
+def main():
+    parser = ArgumentParser(
+        description="Generate a glyph subset of an LVGL font from the GUI strings"
+    )
+    parser.add_argument("source", help="LVGL font C file to take the glyphs from")
+    parser.add_argument("name", help="Name of the generated lv_font_t")
+    parser.add_argument("output", help="C file to generate")
+    parser.add_argument(
+        "--range",
+        action="append",
+        default=list(),
+        help="Letters to keep, as 'first-last' or a single letter (e.g. 0x20-0x7E)",
+    )
+    parser.add_argument(
+        "--symbol",
+        action="append",
+        default=list(),
+        help="LV_SYMBOL_ name to keep, for symbols used by LVGL widgets",
+    )
+    parser.add_argument(
+        "--scan",
+        nargs="*",
+        default=list(),
+        help="Sources whose string literals and LV_SYMBOL_ names are kept",
+    )
+    args = parser.parse_args()
+
+    symbol_definitions = parse_symbol_definitions(
+        os.path.join(os.path.dirname(args.source), "lv_symbol_def.h")
+    )
+    try:
+        font = parse_font(args.source)
+    except FontParseError as error:
+        sys.exit("{}: {}".format(args.source, error))
+
+    requested_letters = scan_sources(args.scan, symbol_definitions)
+    requested_letters.add(FALLBACK_LETTER)
+    for letter_range in args.range:
+        requested_letters.update(parse_range(letter_range))
+    for symbol in args.symbol:
+        if symbol not in symbol_definitions:
+            sys.exit("Unknown symbol {}".format(symbol))
+        requested_letters.add(symbol_definitions[symbol])
+
+    # Control characters are handled by the text layout, not drawn
+    requested_letters = set(letter for letter in requested_letters if letter >= 0x20)
+    missing_letters = requested_letters - set(font.glyphs)
+    if missing_letters:
+        print(
+            "{}: no glyph for {}, the fallback letter is drawn instead".format(
+                args.source,
+                " ".join("0x{:X}".format(letter) for letter in sorted(missing_letters)),
+            ),
+            file=sys.stderr,
+        )
+    letters = sorted(requested_letters - missing_letters)
+
+    with open(args.output, "w") as output_file:
+        output_file.write(
+            generate(font, letters, args.name, os.path.basename(args.source))
+        )
+
+
+if __name__ == "__main__":
+    main()
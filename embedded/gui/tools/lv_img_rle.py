@@ -0,0 +1,259 @@
+"""
+Encode a PNG image as an LVGL run-length encoded palette image
+
+The build regenerates gui/src/semtech_logo.c from gui/img/semtech_logo.png. To change
+the splash logo, replace the PNG (8 bits RGB, or RGBA without transparency, at most 255
+colors) and run make, or run this script with the PNG, the image name (semtech_logo)
+and the C file to generate.
+The generated file is checked in so that the Keil project builds without Python.
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from argparse import ArgumentParser
+import os
+import struct
+import sys
+import zlib
+
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+PNG_COLOR_TYPE_RGB = 2
+PNG_COLOR_TYPE_RGBA = 6
+PNG_BYTES_PER_PIXEL = {PNG_COLOR_TYPE_RGB: 3, PNG_COLOR_TYPE_RGBA: 4}
+
+# Limits of the format decoded by lv_port_img_rle.c
+MAX_PALETTE_SIZE = 255
+MAX_RUN_LENGTH = 255
+MAX_RUN_INDEX = 0xFFFF
+
+BYTES_PER_LINE = 16
+
+
+class ImageError(Exception):
+    pass
+
+
+def paeth_predictor(left, up, up_left):
+    estimate = left + up - up_left
+    distance_left = abs(estimate - left)
+    distance_up = abs(estimate - up)
+    distance_up_left = abs(estimate - up_left)
+    if distance_left <= distance_up and distance_left <= distance_up_left:
+        return left
+    if distance_up <= distance_up_left:
+        return up
+    return up_left
+
+
+def unfilter_rows(data, width, height, bytes_per_pixel):
+    stride = width * bytes_per_pixel
+    rows = list()
+    previous = bytearray(stride)
+    offset = 0
+    for _ in range(height):
+        filter_type = data[offset]
+        row = bytearray(data[offset + 1 : offset + 1 + stride])
+        offset += 1 + stride
+        for index in range(stride):
+            has_left = index >= bytes_per_pixel
+            left = row[index - bytes_per_pixel] if has_left else 0
+            up = previous[index]
+            up_left = previous[index - bytes_per_pixel] if has_left else 0
+            if filter_type == 1:
+                row[index] = (row[index] + left) & 0xFF
+            elif filter_type == 2:
+                row[index] = (row[index] + up) & 0xFF
+            elif filter_type == 3:
+                row[index] = (row[index] + (left + up) // 2) & 0xFF
+            elif filter_type == 4:
+                row[index] = (row[index] + paeth_predictor(left, up, up_left)) & 0xFF
+            elif filter_type != 0:
+                raise ImageError("Unknown PNG filter {}".format(filter_type))
+        rows.append(row)
+        previous = row
+    return rows
+
+
+def read_png(path):
+    with open(path, "rb") as png_file:
+        content = png_file.read()
+    if not content.startswith(PNG_SIGNATURE):
+        raise ImageError("Not a PNG file")
+
+    offset = len(PNG_SIGNATURE)
+    header = None
+    compressed_data = bytearray()
+    while offset < len(content):
+        (length,) = struct.unpack(">I", content[offset : offset + 4])
+        chunk_type = content[offset + 4 : offset + 8]
+        chunk_data = content[offset + 8 : offset + 8 + length]
+        offset += 12 + length
+        if chunk_type == b"IHDR":
+            header = struct.unpack(">IIBBBBB", chunk_data)
+        elif chunk_type == b"IDAT":
+            compressed_data += chunk_data
+        elif chunk_type == b"IEND":
+            break
+    if header is None:
+        raise ImageError("Missing IHDR chunk")
+
+    width, height, bit_depth, color_type, _, _, interlace = header
+    if bit_depth != 8 or color_type not in PNG_BYTES_PER_PIXEL:
+        raise ImageError("Only 8 bits RGB and RGBA images are supported")
+    if interlace != 0:
+        raise ImageError("Interlaced images are not supported")
+
+    bytes_per_pixel = PNG_BYTES_PER_PIXEL[color_type]
+    rows = unfilter_rows(
+        zlib.decompress(bytes(compressed_data)), width, height, bytes_per_pixel
+    )
+    pixels = list()
+    for row in rows:
+        pixel_row = list()
+        for index in range(0, len(row), bytes_per_pixel):
+            # The image is drawn without alpha blending
+            if color_type == PNG_COLOR_TYPE_RGBA and row[index + 3] != 0xFF:
+                raise ImageError("Transparent pixels are not supported")
+            pixel_row.append(tuple(row[index : index + 3]))
+        pixels.append(pixel_row)
+    return width, height, pixels
+
+
+def encode(pixels):
+    # Colors are indexed in the order they appear
+    palette = list()
+    palette_indexes = dict()
+    row_indexes = list()
+    runs = list()
+    for pixel_row in pixels:
+        row_indexes.append(len(runs))
+        for color in pixel_row:
+            if color not in palette_indexes:
+                if len(palette) == MAX_PALETTE_SIZE:
+                    raise ImageError(
+                        "More than {} colors in the image".format(MAX_PALETTE_SIZE)
+                    )
+                palette_indexes[color] = len(palette)
+                palette.append(color)
+            palette_index = palette_indexes[color]
+            # Runs are closed at the end of each row so that a row can be decoded alone
+            if (
+                len(runs) > row_indexes[-1]
+                and runs[-1][1] == palette_index
+                and runs[-1][0] < MAX_RUN_LENGTH
+            ):
+                runs[-1][0] += 1
+            else:
+                runs.append([1, palette_index])
+        if row_indexes[-1] > MAX_RUN_INDEX:
+            raise ImageError("Too many runs in the image")
+    return palette, row_indexes, runs
+
+
+def format_values(values):
+    lines = list()
+    for start in range(0, len(values), BYTES_PER_LINE):
+        chunk = values[start : start + BYTES_PER_LINE]
+        lines.append("    " + ", ".join("0x{:02x}".format(value) for value in chunk))
+    return ",\n".join(lines) + ",\n"
+
+
+def generate(width, height, palette, row_indexes, runs, name, source_name):
+    output = list()
+    output.append(
+        "/*\n"
+        " * Run-length encoded palette image of {source} generated by\n"
+        " * gui/tools/lv_img_rle.py.\n"
+        " * Do not edit: regenerated by the build when the image changes.\n"
+        " * The format is described with LV_IMG_CF_RLE_PALETTE in lv_port_img_rle.h.\n"
+        " */\n\n"
+        '#include "{name}.h"\n\n'.format(source=source_name, name=name)
+    )
+    output.append(
+        "const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_TEST "
+        "uint8_t {}_map[] = {{\n".format(name)
+    )
+    output.append("    /* Palette size */\n")
+    output.append(format_values([len(palette)]))
+    output.append("    /* Palette, as red, green, blue */\n")
+    output.append(
+        format_values([component for color in palette for component in color])
+    )
+    output.append("    /* Index of the first run of each row */\n")
+    output.append(
+        format_values(
+            [byte for index in row_indexes for byte in (index & 0xFF, index >> 8)]
+        )
+    )
+    output.append("    /* Runs, as length, palette index */\n")
+    output.append(format_values([value for run in runs for value in run]))
+    output.append("};\n\n")
+    output.append(
+        "const lv_img_dsc_t {name} = {{\n"
+        "    .header.always_zero = 0,\n"
+        "    .header.w           = {width},\n"
+        "    .header.h           = {height},\n"
+        "    .data_size          = sizeof( {name}_map ),\n"
+        "    .header.cf          = LV_IMG_CF_RLE_PALETTE,\n"
+        "    .data               = {name}_map,\n"
+        "}};\n".format(name=name, width=width, height=height)
+    )
+    return "".join(output)
+
+
+def main():
+    parser = ArgumentParser(
+        description="Encode a PNG image as an LVGL run-length encoded palette image"
+    )
+    parser.add_argument("source", help="8 bits RGB or opaque RGBA PNG image")
+    parser.add_argument(
+        "name", help="Name of the generated lv_img_dsc_t, and of its header"
+    )
+    parser.add_argument("output", help="C file to generate")
+    args = parser.parse_args()
+
+    try:
+        width, height, pixels = read_png(args.source)
+        palette, row_indexes, runs = encode(pixels)
+    except ImageError as error:
+        sys.exit("{}: {}".format(args.source, error))
+
+    with open(args.output, "w") as output_file:
+        output_file.write(
+            generate(
+                width,
+                height,
+                palette,
+                row_indexes,
+                runs,
+                args.name,
+                os.path.basename(args.source),
+            )
+        )
+
+
+if __name__ == "__main__":
+    main()
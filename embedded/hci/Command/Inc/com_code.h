@@ -42,12 +42,21 @@
 #define COM_CODE_GET_ALMANAC_DATES ( 7 )
 #define COM_CODE_UPDATE_ALMANAC ( 8 )
 #define COM_CODE_CHECK_ALMANAC_UPDATE ( 9 )
+#define COM_CODE_GET_POWER_STATISTICS ( 10 )
+#define COM_CODE_GET_ALMANAC_SIGNATURES ( 11 )
+#define COM_CODE_SCHEDULER ( 12 )
+#define COM_CODE_GET_DISPLAY_STATISTICS ( 13 )
+#define COM_CODE_GET_HEAP_STATISTICS ( 14 )
 
 #define RESP_CODE_EVENT ( 0x80 )
 #define RESP_CODE_WIFI_RESULT ( 0x81 )
 #define RESP_CODE_GNSS_AUTONOMOUS_RESULT ( 0x82 )
 #define RESP_CODE_GNSS_ASSISTED_RESULT ( 0x83 )
 #define LOG_RESPONSE_CODE ( 0x84 )
+#define RESP_CODE_SPECTRUM_SWEEP_RESULT ( 0x85 )
+#define RESP_CODE_CAD_SNIFFER_RESULT ( 0x86 )
+#define RESP_CODE_RX_DUTY_CYCLE_RESULT ( 0x87 )
+#define RESP_CODE_WIFI_EXTENDED_RESULT ( 0x88 )
 #define ERROR_CODE_EVENT ( 0x90 )
 
 #endif  // __COM_CODE_H__
@@ -43,6 +43,10 @@ typedef enum
     COMMAND_BASE_DEMO_WIFI_COUNTRY_CODE = 2,
     COMMAND_BASE_DEMO_GNSS_AUTONOMOUS   = 3,
     COMMAND_BASE_DEMO_GNSS_ASSISTED     = 4,
+    COMMAND_BASE_DEMO_SPECTRUM_SWEEP    = 5,
+    COMMAND_BASE_DEMO_CAD_SNIFFER       = 6,
+    COMMAND_BASE_DEMO_RX_DUTY_CYCLE     = 7,
+    COMMAND_BASE_DEMO_GEOLOCATION       = 8,
 } CommandBaseDemoId_t;
 
 class CommandBase : public CommandInterface
@@ -58,6 +62,8 @@ class CommandBase : public CommandInterface
     void             SetEventStartDemo( CommandBaseDemoId_t demo_to_start );
     void             SetEventStopDemo( );
     void             SetEventResetDemo( void );
+    void             SetEventStartScheduler( );
+    void             SetEventStopScheduler( );
     void             SetNoEvent( );
     void             SendResponseBuffer( const uint8_t* buffer, const uint16_t buffer_length );
     DeviceInterface* device;
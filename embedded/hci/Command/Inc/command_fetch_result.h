@@ -48,8 +48,12 @@ class CommandFetchResult : public CommandInterface
 
    protected:
     void FetchWifiResults( const demo_wifi_scan_all_results_t& wifi_results );
+    void FetchWifiExtendedResults( const demo_wifi_scan_all_results_t& wifi_results );
     void FetchAutonomousGnssResults( const demo_gnss_all_results_t& gnss_autonomous_results );
     void FetchAssistedGnssResults( const demo_gnss_all_results_t& gnss_assisted_results );
+    void FetchSpectrumSweepResults( const demo_spectrum_sweep_results_t& spectrum_sweep_results );
+    void FetchCadSnifferResults( const demo_cad_sniffer_results_t& cad_sniffer_results );
+    void FetchRxDutyCycleResults( const demo_rx_duty_cycle_results_t& rx_duty_cycle_results );
 
     void SendGnssResult( const demo_gnss_all_results_t& gnss_result, const uint16_t resp_code );
 
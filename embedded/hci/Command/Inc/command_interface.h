@@ -47,8 +47,14 @@ typedef enum
     COMMAND_START_WIFI_COUNTRY_CODE_DEMO_EVENT,
     COMMAND_START_GNSS_AUTONOMOUS_DEMO_EVENT,
     COMMAND_START_GNSS_ASSISTED_DEMO_EVENT,
+    COMMAND_START_SPECTRUM_SWEEP_DEMO_EVENT,
+    COMMAND_START_CAD_SNIFFER_DEMO_EVENT,
+    COMMAND_START_RX_DUTY_CYCLE_DEMO_EVENT,
+    COMMAND_START_GEOLOCATION_DEMO_EVENT,
     COMMAND_STOP_DEMO_EVENT,
     COMMAND_RESET_DEMO_EVENT,
+    COMMAND_START_SCHEDULER_EVENT,
+    COMMAND_STOP_SCHEDULER_EVENT,
 } CommandEvent_t;
 
 class CommandInterface
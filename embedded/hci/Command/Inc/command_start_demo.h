@@ -52,9 +52,17 @@ class CommandStartDemo : public CommandBase
     bool ConfigureGnssAutonomous( const uint8_t* buffer, const uint16_t buffer_size );
     bool ConfigureGnssAssisted( const uint8_t* buffer, const uint16_t buffer_size );
     bool ConfigureGnss( demo_gnss_settings_t* gnss_setting, const uint8_t* buffer, const uint16_t buffer_size );
+    bool ConfigureSpectrumSweep( const uint8_t* buffer, const uint16_t buffer_size );
+    bool ConfigureCadSniffer( const uint8_t* buffer, const uint16_t buffer_size );
+    bool ConfigureRxDutyCycle( const uint8_t* buffer, const uint16_t buffer_size );
+    bool ConfigureGeolocation( const uint8_t* buffer, const uint16_t buffer_size );
 
     static demo_wifi_mode_t             wifi_mode_from_value( const uint8_t& value );
+    static demo_wifi_result_type_t      wifi_result_type_from_value( const uint8_t& value );
     static demo_wifi_signal_type_scan_t wifi_signal_type_scan_from_val( const uint8_t& val );
+    static bool                         is_gfsk_bandwidth_valid( const uint8_t& value );
+    static bool                         is_lora_bandwidth_valid( const uint8_t& value );
+    static bool                         is_cad_symbol_number_valid( const uint8_t& value );
 
    private:
     CommandBaseDemoId_t   demo_id_to_start;
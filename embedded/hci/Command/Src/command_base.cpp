@@ -78,6 +78,30 @@ void CommandBase::SetEventStartDemo( CommandBaseDemoId_t demo_to_start )
         break;
     }
 
+    case COMMAND_BASE_DEMO_SPECTRUM_SWEEP:
+    {
+        this->event = COMMAND_START_SPECTRUM_SWEEP_DEMO_EVENT;
+        break;
+    }
+
+    case COMMAND_BASE_DEMO_CAD_SNIFFER:
+    {
+        this->event = COMMAND_START_CAD_SNIFFER_DEMO_EVENT;
+        break;
+    }
+
+    case COMMAND_BASE_DEMO_RX_DUTY_CYCLE:
+    {
+        this->event = COMMAND_START_RX_DUTY_CYCLE_DEMO_EVENT;
+        break;
+    }
+
+    case COMMAND_BASE_DEMO_GEOLOCATION:
+    {
+        this->event = COMMAND_START_GEOLOCATION_DEMO_EVENT;
+        break;
+    }
+
     default:
     {
         this->event = COMMAND_NO_EVENT;
@@ -89,4 +113,8 @@ void CommandBase::SetEventStopDemo( ) { this->event = COMMAND_STOP_DEMO_EVENT; }
 
 void CommandBase::SetEventResetDemo( ) { this->event = COMMAND_RESET_DEMO_EVENT; }
 
+void CommandBase::SetEventStartScheduler( ) { this->event = COMMAND_START_SCHEDULER_EVENT; }
+
+void CommandBase::SetEventStopScheduler( ) { this->event = COMMAND_STOP_SCHEDULER_EVENT; }
+
 void CommandBase::SetNoEvent( ) { this->event = COMMAND_NO_EVENT; }
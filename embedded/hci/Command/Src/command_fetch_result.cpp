@@ -29,6 +29,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <string.h>
 #include "command_fetch_result.h"
 #include "com_code.h"
 #include "lr1110_wifi_types.h"
@@ -37,6 +38,9 @@
 // later on
 #include "stm32l4xx_ll_utils.h"
 
+// Country code (2 bytes) and country code search status (1 byte) appended to the Wi-Fi results
+#define WIFI_COUNTRY_CODE_FIELDS_LENGTH ( 3 )
+
 CommandFetchResult::CommandFetchResult( Hci& hci, EnvironmentInterface& environment, DemoManagerInterface& demo_holder )
     : hci( hci ), environment( environment ), demo_holder( demo_holder )
 {
@@ -93,6 +97,57 @@ CommandEvent_t CommandFetchResult::Execute( )
         this->FetchAssistedGnssResults( gnss_assisted_results );
         break;
     }
+    case DEMO_TYPE_SPECTRUM_SWEEP:
+    {
+        const demo_spectrum_sweep_results_t& spectrum_sweep_results =
+            *( demo_spectrum_sweep_results_t* ) demo_holder.GetResults( );
+        const uint16_t response_code = this->GetComCode( );
+        this->hci.SendResponse( response_code, 1 );
+
+        this->FetchSpectrumSweepResults( spectrum_sweep_results );
+        break;
+    }
+    case DEMO_TYPE_CAD_SNIFFER:
+    {
+        const demo_cad_sniffer_results_t& cad_sniffer_results =
+            *( demo_cad_sniffer_results_t* ) demo_holder.GetResults( );
+        const uint16_t response_code = this->GetComCode( );
+        this->hci.SendResponse( response_code, 1 );
+
+        this->FetchCadSnifferResults( cad_sniffer_results );
+        break;
+    }
+    case DEMO_TYPE_RADIO_RX_DUTY_CYCLE:
+    {
+        const demo_rx_duty_cycle_results_t& rx_duty_cycle_results =
+            *( demo_rx_duty_cycle_results_t* ) demo_holder.GetResults( );
+        const uint16_t response_code = this->GetComCode( );
+        this->hci.SendResponse( response_code, 1 );
+
+        this->FetchRxDutyCycleResults( rx_duty_cycle_results );
+        break;
+    }
+    case DEMO_TYPE_GEOLOCATION:
+    {
+        const demo_geolocation_results_t& geolocation_results =
+            *( demo_geolocation_results_t* ) demo_holder.GetResults( );
+        const bool     is_wifi_done  = geolocation_results.last_completed_step >= DEMO_GEOLOCATION_STEP_WIFI;
+        const bool     is_gnss_done  = geolocation_results.last_completed_step >= DEMO_GEOLOCATION_STEP_GNSS;
+        const uint8_t  n_wifi        = is_wifi_done ? geolocation_results.wifi_results->nbrResults : 0;
+        const uint8_t  n_gnss        = is_gnss_done ? 1 : 0;
+        const uint16_t response_code = this->GetComCode( );
+        this->hci.SendResponse( response_code, ( uint8_t )( n_wifi + n_gnss ) );
+
+        if( is_wifi_done )
+        {
+            this->FetchWifiResults( *geolocation_results.wifi_results );
+        }
+        if( is_gnss_done )
+        {
+            this->FetchAutonomousGnssResults( *geolocation_results.gnss_results );
+        }
+        break;
+    }
     default:
         break;
     }
@@ -101,6 +156,12 @@ CommandEvent_t CommandFetchResult::Execute( )
 
 void CommandFetchResult::FetchWifiResults( const demo_wifi_scan_all_results_t& wifi_results )
 {
+    if( wifi_results.extended_results != NULL )
+    {
+        this->FetchWifiExtendedResults( wifi_results );
+        return;
+    }
+
     for( uint8_t result_index = 0; result_index < wifi_results.nbrResults; result_index++ )
     {
         demo_wifi_scan_single_result_t local_result          = wifi_results.results[result_index];
@@ -135,9 +196,15 @@ void CommandFetchResult::FetchWifiResults( const demo_wifi_scan_all_results_t& w
             ( uint8_t )( ( local_demodulation_us & 0x0000FF00 ) >> 8 ),
             ( uint8_t )( ( local_demodulation_us & 0x00FF0000 ) >> 16 ),
             ( uint8_t )( ( local_demodulation_us & 0xFF000000 ) >> 24 ),
+            local_result.country_code[0],
+            local_result.country_code[1],
+            ( uint8_t )( wifi_results.country_code_error ? 0x01 : 0x00 ),
         };
-        hci.SendResponse( RESP_CODE_WIFI_RESULT, single_wifi_result_buffer,
-                          sizeof( single_wifi_result_buffer ) / sizeof( *single_wifi_result_buffer ) );
+        // The country code fields are only sent when a country code search was chained to the scan
+        const uint16_t single_wifi_result_length =
+            sizeof( single_wifi_result_buffer ) / sizeof( *single_wifi_result_buffer ) -
+            ( wifi_results.has_country_codes ? 0 : WIFI_COUNTRY_CODE_FIELDS_LENGTH );
+        hci.SendResponse( RESP_CODE_WIFI_RESULT, single_wifi_result_buffer, single_wifi_result_length );
 
         // WORKAROUND: using LL_mDelay(1) fixes the bug appearing when sending >
         // 20 Wi-Fi results
@@ -145,6 +212,55 @@ void CommandFetchResult::FetchWifiResults( const demo_wifi_scan_all_results_t& w
     }
 }
 
+void CommandFetchResult::FetchWifiExtendedResults( const demo_wifi_scan_all_results_t& wifi_results )
+{
+    const demo_wifi_extended_results_t& extended_results = *wifi_results.extended_results;
+    uint16_t                            record_index     = 0;
+
+    // Each record is sent as a basic Wi-Fi result followed by the SSID length and the SSID
+    for( uint8_t result_index = 0; result_index < extended_results.nb_records; result_index++ )
+    {
+        const uint8_t* record      = &extended_results.arena[record_index];
+        const uint8_t  ssid_length = record[9];
+
+        uint8_t  extended_result_buffer[26 + DEMO_WIFI_SSID_MAX_LENGTH + WIFI_COUNTRY_CODE_FIELDS_LENGTH] = { 0 };
+        uint16_t buffer_index = 0;
+
+        memcpy( extended_result_buffer, record, DEMO_TYPE_WIFI_MAC_ADDRESS_LENGTH );
+        extended_result_buffer[6] = record[6];
+        extended_result_buffer[7] =
+            CommandFetchResult::ConvertWifiTypeToSerial( ( demo_wifi_signal_type_t ) record[7] );
+        extended_result_buffer[8] = record[8];
+        buffer_index              = 9;
+
+        buffer_index += CommandFetchResult::AppendValueAtIndex( extended_result_buffer, buffer_index,
+                                                                wifi_results.timings.rx_detection_us );
+        buffer_index += CommandFetchResult::AppendValueAtIndex( extended_result_buffer, buffer_index,
+                                                                wifi_results.timings.rx_correlation_us );
+        buffer_index += CommandFetchResult::AppendValueAtIndex( extended_result_buffer, buffer_index,
+                                                                wifi_results.timings.rx_capture_us );
+        buffer_index += CommandFetchResult::AppendValueAtIndex( extended_result_buffer, buffer_index,
+                                                                wifi_results.timings.demodulation_us );
+        extended_result_buffer[buffer_index++] = ssid_length;
+        memcpy( &extended_result_buffer[buffer_index], &record[DEMO_WIFI_EXTENDED_RECORD_HEADER_SIZE], ssid_length );
+        buffer_index += ssid_length;
+
+        if( wifi_results.has_country_codes == true )
+        {
+            // Extended records are stored in the same order as the results the country codes are joined to
+            extended_result_buffer[buffer_index++] = wifi_results.results[result_index].country_code[0];
+            extended_result_buffer[buffer_index++] = wifi_results.results[result_index].country_code[1];
+            extended_result_buffer[buffer_index++] = wifi_results.country_code_error ? 0x01 : 0x00;
+        }
+
+        hci.SendResponse( RESP_CODE_WIFI_EXTENDED_RESULT, extended_result_buffer, buffer_index );
+        record_index += DEMO_WIFI_EXTENDED_RECORD_HEADER_SIZE + ssid_length;
+
+        // WORKAROUND: same as for the basic Wi-Fi results
+        LL_mDelay( 1 );
+    }
+}
+
 void CommandFetchResult::FetchAutonomousGnssResults( const demo_gnss_all_results_t& gnss_autonomous_results )
 {
     this->SendGnssResult( gnss_autonomous_results, RESP_CODE_GNSS_AUTONOMOUS_RESULT );
@@ -155,6 +271,96 @@ void CommandFetchResult::FetchAssistedGnssResults( const demo_gnss_all_results_t
     this->SendGnssResult( gnss_assisted_results, RESP_CODE_GNSS_ASSISTED_RESULT );
 }
 
+void CommandFetchResult::FetchSpectrumSweepResults( const demo_spectrum_sweep_results_t& spectrum_sweep_results )
+{
+    uint8_t  spectrum_sweep_buffer[11 + ( DEMO_SPECTRUM_SWEEP_MAX_CHANNELS * 3 )] = { 0 };
+    uint16_t buffer_index                                                        = 0;
+
+    // 1. Sweep description: start frequency, step, number of channels and number of completed sweeps
+    buffer_index += CommandFetchResult::AppendValueAtIndex( spectrum_sweep_buffer, buffer_index,
+                                                            spectrum_sweep_results.start_frequency_hz );
+    buffer_index += CommandFetchResult::AppendValueAtIndex( spectrum_sweep_buffer, buffer_index,
+                                                            spectrum_sweep_results.step_frequency_hz );
+    buffer_index += CommandFetchResult::AppendValueAtIndex( spectrum_sweep_buffer, buffer_index,
+                                                            spectrum_sweep_results.nb_channels );
+    buffer_index += CommandFetchResult::AppendValueAtIndex( spectrum_sweep_buffer, buffer_index,
+                                                            spectrum_sweep_results.nb_sweeps );
+
+    // 2. Three bytes per channel: minimum, maximum and mean RSSI
+    for( uint8_t channel = 0; channel < spectrum_sweep_results.nb_channels; channel++ )
+    {
+        const demo_spectrum_sweep_channel_result_t& local_result = spectrum_sweep_results.channels[channel];
+
+        spectrum_sweep_buffer[buffer_index++] = ( uint8_t ) local_result.rssi_min;
+        spectrum_sweep_buffer[buffer_index++] = ( uint8_t ) local_result.rssi_max;
+        spectrum_sweep_buffer[buffer_index++] = ( uint8_t ) local_result.rssi_mean;
+    }
+
+    hci.SendResponse( RESP_CODE_SPECTRUM_SWEEP_RESULT, spectrum_sweep_buffer, buffer_index );
+}
+
+void CommandFetchResult::FetchCadSnifferResults( const demo_cad_sniffer_results_t& cad_sniffer_results )
+{
+    uint8_t  cad_sniffer_buffer[11 + ( DEMO_CAD_SNIFFER_MAX_CHANNELS * 34 )] = { 0 };
+    uint16_t buffer_index                                                    = 0;
+
+    // 1. Sniffer description: channels, SF mask, completed cycles, elapsed time and overall CAD duty cycle
+    buffer_index +=
+        CommandFetchResult::AppendValueAtIndex( cad_sniffer_buffer, buffer_index, cad_sniffer_results.nb_channels );
+    buffer_index +=
+        CommandFetchResult::AppendValueAtIndex( cad_sniffer_buffer, buffer_index, cad_sniffer_results.sf_mask );
+    buffer_index +=
+        CommandFetchResult::AppendValueAtIndex( cad_sniffer_buffer, buffer_index, cad_sniffer_results.nb_cycles );
+    buffer_index +=
+        CommandFetchResult::AppendValueAtIndex( cad_sniffer_buffer, buffer_index, cad_sniffer_results.elapsed_ms );
+    buffer_index += CommandFetchResult::AppendValueAtIndex( cad_sniffer_buffer, buffer_index,
+                                                            cad_sniffer_results.cad_duty_cycle_permille );
+
+    // 2. Per channel: frequency, CAD and detection counts, CAD time, activity ratio and detections per SF5..SF12
+    for( uint8_t channel = 0; channel < cad_sniffer_results.nb_channels; channel++ )
+    {
+        const demo_cad_sniffer_channel_result_t& local_result = cad_sniffer_results.channels[channel];
+
+        buffer_index +=
+            CommandFetchResult::AppendValueAtIndex( cad_sniffer_buffer, buffer_index, local_result.frequency_hz );
+        buffer_index += CommandFetchResult::AppendValueAtIndex( cad_sniffer_buffer, buffer_index, local_result.nb_cad );
+        buffer_index +=
+            CommandFetchResult::AppendValueAtIndex( cad_sniffer_buffer, buffer_index, local_result.nb_detections );
+        buffer_index +=
+            CommandFetchResult::AppendValueAtIndex( cad_sniffer_buffer, buffer_index, local_result.cad_time_ms );
+        buffer_index +=
+            CommandFetchResult::AppendValueAtIndex( cad_sniffer_buffer, buffer_index, local_result.activity_permille );
+
+        for( uint8_t sf_index = 0; sf_index < DEMO_CAD_SNIFFER_NB_SF; sf_index++ )
+        {
+            buffer_index += CommandFetchResult::AppendValueAtIndex( cad_sniffer_buffer, buffer_index,
+                                                                    local_result.detections_per_sf[sf_index] );
+        }
+    }
+
+    hci.SendResponse( RESP_CODE_CAD_SNIFFER_RESULT, cad_sniffer_buffer, buffer_index );
+}
+
+void CommandFetchResult::FetchRxDutyCycleResults( const demo_rx_duty_cycle_results_t& rx_duty_cycle_results )
+{
+    const uint32_t values[] = {
+        rx_duty_cycle_results.count_rx_correct_packet, rx_duty_cycle_results.count_rx_wrong_packet,
+        rx_duty_cycle_results.count_preamble_detected, rx_duty_cycle_results.count_missed_preamble,
+        rx_duty_cycle_results.rx_time_ms,              rx_duty_cycle_results.sleep_time_ms,
+        rx_duty_cycle_results.average_current_na,
+    };
+    uint8_t  rx_duty_cycle_buffer[sizeof( values )] = { 0 };
+    uint16_t buffer_index                           = 0;
+
+    for( uint8_t value_index = 0; value_index < ( sizeof( values ) / sizeof( *values ) ); value_index++ )
+    {
+        buffer_index +=
+            CommandFetchResult::AppendValueAtIndex( rx_duty_cycle_buffer, buffer_index, values[value_index] );
+    }
+
+    hci.SendResponse( RESP_CODE_RX_DUTY_CYCLE_RESULT, rx_duty_cycle_buffer, buffer_index );
+}
+
 void CommandFetchResult::SendGnssResult( const demo_gnss_all_results_t& gnss_result, const uint16_t resp_code )
 {
     const uint32_t local_measurement_delay =
@@ -61,7 +61,11 @@ CommandEvent_t CommandGetAlmanacDates::Execute( )
     const uint16_t buffer_len                                    = ALMANAC_DATES_STRING_MAX_LEN;
 
     GnssHelperAlmanacDetails_t almanac_ages_and_crc = { 0 };
-    this->device->GetAlmanacAgesAndCrcOfAllSatellites( &almanac_ages_and_crc );
+    if( this->device->GetAlmanacAgesAndCrcOfAllSatellites( &almanac_ages_and_crc ) == false )
+    {
+        this->hci->SendError( this->GetComCode( ) );
+        return COMMAND_NO_EVENT;
+    }
 
     for( uint8_t index_sat = 0; index_sat < N_SATELLITES; index_sat++ )
     {
@@ -0,0 +1,116 @@
+/**
+ * @file      command_get_almanac_signatures.cpp
+ *
+ * @brief     Implementation of the HCI command to get the almanac signatures class.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "command_get_almanac_signatures.h"
+#include "com_code.h"
+
+// The signatures of all the satellites do not fit in one response, so they are requested by pages
+#define COMMAND_GET_ALMANAC_SIGNATURES_MAX_SATELLITES ( 64 )
+#define COMMAND_GET_ALMANAC_SIGNATURES_HEADER_SIZE ( 9 )
+#define COMMAND_GET_ALMANAC_SIGNATURES_SATELLITE_SIZE ( 6 )
+#define COMMAND_GET_ALMANAC_SIGNATURES_RESPONSE_MAX_SIZE \
+    ( COMMAND_GET_ALMANAC_SIGNATURES_HEADER_SIZE +       \
+      COMMAND_GET_ALMANAC_SIGNATURES_MAX_SATELLITES * COMMAND_GET_ALMANAC_SIGNATURES_SATELLITE_SIZE )
+
+#define COMMAND_GET_ALMANAC_SIGNATURES_FLAG_DELTA_UPDATE ( 0x01 )
+
+CommandGetAlmanacSignatures::CommandGetAlmanacSignatures( DeviceInterface* device, Hci& hci )
+    : hci( &hci ), device( device ), first_sv_id( 0 ), n_satellites( 0 )
+{
+}
+
+CommandGetAlmanacSignatures::~CommandGetAlmanacSignatures( ) {}
+
+uint16_t CommandGetAlmanacSignatures::GetComCode( ) { return COM_CODE_GET_ALMANAC_SIGNATURES; }
+
+bool CommandGetAlmanacSignatures::ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_length )
+{
+    bool success = false;
+    if( ( buffer_length == 2 ) && ( buffer[1] <= COMMAND_GET_ALMANAC_SIGNATURES_MAX_SATELLITES ) &&
+        ( ( buffer[0] + buffer[1] ) <= GNSS_HELPER_NUMBER_SATELLITES_ALMANAC_READ ) )
+    {
+        this->first_sv_id  = buffer[0];
+        this->n_satellites = buffer[1];
+        success            = true;
+    }
+    else
+    {
+        success = false;
+    }
+    return success;
+}
+
+CommandEvent_t CommandGetAlmanacSignatures::Execute( )
+{
+    uint8_t  buffer_response[COMMAND_GET_ALMANAC_SIGNATURES_RESPONSE_MAX_SIZE] = { 0 };
+    uint16_t buffer_index                                                     = 0;
+
+    GnssHelperAlmanacDetails_t almanac_ages_and_crc = { 0 };
+    uint16_t                   oldest_almanac_date  = 0;
+    if( ( this->device->GetAlmanacAgesAndCrcOfAllSatellites( &almanac_ages_and_crc ) == false ) ||
+        ( this->device->GetOldestAlmanacAge( &oldest_almanac_date ) == false ) )
+    {
+        this->hci->SendError( this->GetComCode( ) );
+        return COMMAND_NO_EVENT;
+    }
+
+    // Header: flags, global almanac CRC, oldest almanac date, first satellite id and number of satellites
+    buffer_response[buffer_index++] =
+        ( this->device->IsAlmanacDeltaUpdateSupported( ) ) ? COMMAND_GET_ALMANAC_SIGNATURES_FLAG_DELTA_UPDATE : 0;
+    buffer_response[buffer_index++] = ( uint8_t )( almanac_ages_and_crc.crc_almanac & 0xFF );
+    buffer_response[buffer_index++] = ( uint8_t )( ( almanac_ages_and_crc.crc_almanac >> 8 ) & 0xFF );
+    buffer_response[buffer_index++] = ( uint8_t )( ( almanac_ages_and_crc.crc_almanac >> 16 ) & 0xFF );
+    buffer_response[buffer_index++] = ( uint8_t )( ( almanac_ages_and_crc.crc_almanac >> 24 ) & 0xFF );
+    buffer_response[buffer_index++] = ( uint8_t )( oldest_almanac_date & 0xFF );
+    buffer_response[buffer_index++] = ( uint8_t )( ( oldest_almanac_date >> 8 ) & 0xFF );
+    buffer_response[buffer_index++] = this->first_sv_id;
+    buffer_response[buffer_index++] = this->n_satellites;
+
+    // Then for each satellite: almanac date and CRC32 of the last block written, 0 if unknown
+    for( uint8_t index = 0; index < this->n_satellites; index++ )
+    {
+        const uint8_t  sv_id        = this->first_sv_id + index;
+        const uint16_t almanac_date = almanac_ages_and_crc.ages_per_almanacs[sv_id].almanac_age;
+        uint32_t       block_crc    = 0;
+
+        this->device->GetAlmanacBlockCrc( sv_id, &block_crc );
+
+        buffer_response[buffer_index++] = ( uint8_t )( almanac_date & 0xFF );
+        buffer_response[buffer_index++] = ( uint8_t )( ( almanac_date >> 8 ) & 0xFF );
+        buffer_response[buffer_index++] = ( uint8_t )( block_crc & 0xFF );
+        buffer_response[buffer_index++] = ( uint8_t )( ( block_crc >> 8 ) & 0xFF );
+        buffer_response[buffer_index++] = ( uint8_t )( ( block_crc >> 16 ) & 0xFF );
+        buffer_response[buffer_index++] = ( uint8_t )( ( block_crc >> 24 ) & 0xFF );
+    }
+
+    this->hci->SendResponse( this->GetComCode( ), buffer_response, buffer_index );
+    return COMMAND_NO_EVENT;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file      command_get_heap_statistics.cpp
+ *
+ * @brief     Implementation of the HCI get heap statistics command class.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "command_get_heap_statistics.h"
+#include "com_code.h"
+#include "command_serialize.h"
+#include "heap_statistics.h"
+
+#define COMMAND_GET_HEAP_STATISTICS_RESPONSE_SIZE ( sizeof( heap_statistics_t ) )
+
+CommandGetHeapStatistics::CommandGetHeapStatistics( Hci& hci ) : hci( &hci ), reset_after_read( false ) {}
+
+CommandGetHeapStatistics::~CommandGetHeapStatistics( ) {}
+
+uint16_t CommandGetHeapStatistics::GetComCode( ) { return COM_CODE_GET_HEAP_STATISTICS; }
+
+bool CommandGetHeapStatistics::ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_length )
+{
+    bool success = false;
+    if( buffer_length == 0 )
+    {
+        this->reset_after_read = false;
+        success                = true;
+    }
+    else if( buffer_length == 1 )
+    {
+        this->reset_after_read = ( buffer[0] != 0 );
+        success                = true;
+    }
+    else
+    {
+        success = false;
+    }
+    return success;
+}
+
+CommandEvent_t CommandGetHeapStatistics::Execute( )
+{
+    uint8_t           buffer_response[COMMAND_GET_HEAP_STATISTICS_RESPONSE_SIZE] = { 0 };
+    uint16_t          buffer_index                                               = 0;
+    heap_statistics_t statistics                                                 = { 0 };
+
+    heap_statistics_get( &statistics );
+    if( this->reset_after_read == true )
+    {
+        heap_statistics_reset( );
+    }
+
+    const uint32_t fields[] = {
+        statistics.allocation_count,
+        statistics.free_count,
+        statistics.allocated_bytes,
+        statistics.allocated_bytes_max,
+    };
+    for( uint8_t field = 0; field < ( sizeof( fields ) / sizeof( fields[0] ) ); field++ )
+    {
+        buffer_index = CommandSerialize::AppendUint32( buffer_response, buffer_index, fields[field] );
+    }
+
+    this->hci->SendResponse( this->GetComCode( ), buffer_response, buffer_index );
+    return COMMAND_NO_EVENT;
+}
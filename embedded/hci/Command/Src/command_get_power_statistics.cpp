@@ -0,0 +1,91 @@
+/**
+ * @file      command_get_power_statistics.cpp
+ *
+ * @brief     Implementation of the HCI get power statistics command class.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "command_get_power_statistics.h"
+#include "com_code.h"
+#include "command_serialize.h"
+#include "system_lpm.h"
+
+#define COMMAND_GET_POWER_STATISTICS_RESPONSE_SIZE \
+    ( ( 2 * SYSTEM_LPM_MODE_COUNT + SYSTEM_LPM_WAKEUP_SOURCE_COUNT ) * sizeof( uint32_t ) )
+
+CommandGetPowerStatistics::CommandGetPowerStatistics( Hci& hci ) : hci( &hci ), reset_after_read( false ) {}
+
+CommandGetPowerStatistics::~CommandGetPowerStatistics( ) {}
+
+uint16_t CommandGetPowerStatistics::GetComCode( ) { return COM_CODE_GET_POWER_STATISTICS; }
+
+bool CommandGetPowerStatistics::ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_length )
+{
+    bool success = false;
+    if( buffer_length == 0 )
+    {
+        this->reset_after_read = false;
+        success                = true;
+    }
+    else if( buffer_length == 1 )
+    {
+        this->reset_after_read = ( buffer[0] != 0 );
+        success                = true;
+    }
+    else
+    {
+        success = false;
+    }
+    return success;
+}
+
+CommandEvent_t CommandGetPowerStatistics::Execute( )
+{
+    uint8_t                 buffer_response[COMMAND_GET_POWER_STATISTICS_RESPONSE_SIZE] = { 0 };
+    uint16_t                buffer_index                                                = 0;
+    system_lpm_statistics_t statistics                                                  = { 0 };
+
+    system_lpm_get_statistics( &statistics );
+    if( this->reset_after_read == true )
+    {
+        system_lpm_reset_statistics( );
+    }
+
+    for( uint8_t mode = 0; mode < SYSTEM_LPM_MODE_COUNT; mode++ )
+    {
+        buffer_index = CommandSerialize::AppendUint32( buffer_response, buffer_index, statistics.entry_count[mode] );
+        buffer_index = CommandSerialize::AppendUint32( buffer_response, buffer_index,
+                                                       ( uint32_t ) statistics.time_in_mode_ms[mode] );
+    }
+    for( uint8_t source = 0; source < SYSTEM_LPM_WAKEUP_SOURCE_COUNT; source++ )
+    {
+        buffer_index = CommandSerialize::AppendUint32( buffer_response, buffer_index, statistics.wakeup_count[source] );
+    }
+
+    this->hci->SendResponse( this->GetComCode( ), buffer_response, buffer_index );
+    return COMMAND_NO_EVENT;
+}
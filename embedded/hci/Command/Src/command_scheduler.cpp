@@ -0,0 +1,122 @@
+/**
+ * @file      command_scheduler.cpp
+ *
+ * @brief     Implementation of the HCI scheduler command class.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "command_scheduler.h"
+#include "com_code.h"
+
+CommandScheduler::CommandScheduler( DeviceInterface* device, Hci& hci, DemoScheduler& scheduler )
+    : CommandBase( device, hci ), do_start( false ), scheduler( scheduler )
+{
+    this->settings.demo_type      = DEMO_TYPE_NONE;
+    this->settings.sinks          = DEMO_SCHEDULER_SINK_ALL;
+    this->settings.nb_scans       = 0;
+    this->settings.interval_s     = 0;
+    this->settings.max_interval_s = 0;
+}
+
+CommandScheduler::~CommandScheduler( ) {}
+
+uint16_t CommandScheduler::GetComCode( ) { return COM_CODE_SCHEDULER; }
+
+bool CommandScheduler::ConfigureFromPayload( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    bool success = false;
+    if( buffer_size == 0 )
+    {
+        // An empty payload stops the scheduler
+        this->do_start = false;
+        success        = true;
+    }
+    else if( buffer_size == 12 )
+    {
+        const demo_type_t demo_type = CommandScheduler::demo_type_from_demo_id( buffer[0] );
+        const uint8_t     sinks     = buffer[1];
+        const uint16_t    nb_scans  = buffer[2] + ( buffer[3] * 256 );
+
+        const uint32_t interval_s =
+            buffer[4] + ( buffer[5] << 8 ) + ( buffer[6] << 16 ) + ( ( uint32_t ) buffer[7] << 24 );
+        const uint32_t max_interval_s =
+            buffer[8] + ( buffer[9] << 8 ) + ( buffer[10] << 16 ) + ( ( uint32_t ) buffer[11] << 24 );
+
+        const bool is_sinks_valid    = ( sinks != 0 ) && ( ( sinks & ~DEMO_SCHEDULER_SINK_ALL ) == 0 );
+        const bool is_interval_valid = ( interval_s != 0 ) && ( interval_s <= DEMO_SCHEDULER_MAX_INTERVAL_S );
+        const bool is_max_interval_valid =
+            ( max_interval_s == 0 ) ||
+            ( ( max_interval_s >= interval_s ) && ( max_interval_s <= DEMO_SCHEDULER_MAX_INTERVAL_S ) );
+
+        if( ( demo_type != DEMO_TYPE_NONE ) && ( is_sinks_valid == true ) && ( is_interval_valid == true ) &&
+            ( is_max_interval_valid == true ) )
+        {
+            this->settings.demo_type      = demo_type;
+            this->settings.sinks          = sinks;
+            this->settings.nb_scans       = nb_scans;
+            this->settings.interval_s     = interval_s;
+            this->settings.max_interval_s = max_interval_s;
+            this->do_start                = true;
+            success                       = true;
+        }
+    }
+    return success;
+}
+
+bool CommandScheduler::Job( )
+{
+    if( this->do_start == true )
+    {
+        this->scheduler.Configure( this->settings );
+        this->SetEventStartScheduler( );
+    }
+    else
+    {
+        this->SetEventStopScheduler( );
+    }
+    return true;
+}
+
+demo_type_t CommandScheduler::demo_type_from_demo_id( const uint8_t demo_id )
+{
+    switch( demo_id )
+    {
+    case COMMAND_BASE_DEMO_WIFI_SCAN:
+        return DEMO_TYPE_WIFI;
+    case COMMAND_BASE_DEMO_WIFI_COUNTRY_CODE:
+        return DEMO_TYPE_WIFI_COUNTRY_CODE;
+    case COMMAND_BASE_DEMO_GNSS_AUTONOMOUS:
+        return DEMO_TYPE_GNSS_AUTONOMOUS;
+    case COMMAND_BASE_DEMO_GNSS_ASSISTED:
+        return DEMO_TYPE_GNSS_ASSISTED;
+    case COMMAND_BASE_DEMO_GEOLOCATION:
+        return DEMO_TYPE_GEOLOCATION;
+    default:
+        // Only the scan demos can be scheduled
+        return DEMO_TYPE_NONE;
+    }
+}
@@ -35,13 +35,15 @@
 CommandStartDemo::CommandStartDemo( DeviceInterface* device, Hci& hci, DemoManagerInterface& demo_holder )
     : CommandBase( device, hci ), demo_id_to_start( COMMAND_BASE_NO_DEMO ), demo_holder( demo_holder )
 {
-    this->demo_settings.wifi_settings.channels     = DEMO_WIFI_CHANNELS_DEFAULT >> 1;
-    this->demo_settings.wifi_settings.types        = DEMO_WIFI_TYPE_SCAN_DEFAULT;
-    this->demo_settings.wifi_settings.scan_mode    = DEMO_WIFI_MODE_DEFAULT;
-    this->demo_settings.wifi_settings.nbr_retrials = DEMO_WIFI_NBR_RETRIALS_DEFAULT;
-    this->demo_settings.wifi_settings.max_results  = DEMO_WIFI_MAX_RESULTS_DEFAULT;
-    this->demo_settings.wifi_settings.timeout      = DEMO_WIFI_TIMEOUT_IN_MS_DEFAULT;
-    this->demo_settings.wifi_settings.result_type  = DEMO_WIFI_RESULT_TYPE_DEFAULT;
+    this->demo_settings.wifi_settings.channels                 = DEMO_WIFI_CHANNELS_DEFAULT >> 1;
+    this->demo_settings.wifi_settings.types                    = DEMO_WIFI_TYPE_SCAN_DEFAULT;
+    this->demo_settings.wifi_settings.scan_mode                = DEMO_WIFI_MODE_DEFAULT;
+    this->demo_settings.wifi_settings.nbr_retrials             = DEMO_WIFI_NBR_RETRIALS_DEFAULT;
+    this->demo_settings.wifi_settings.max_results              = DEMO_WIFI_MAX_RESULTS_DEFAULT;
+    this->demo_settings.wifi_settings.timeout                  = DEMO_WIFI_TIMEOUT_IN_MS_DEFAULT;
+    this->demo_settings.wifi_settings.result_type              = DEMO_WIFI_RESULT_TYPE_DEFAULT;
+    this->demo_settings.wifi_settings.is_channel_mask_adaptive = DEMO_WIFI_IS_CHANNEL_MASK_ADAPTIVE_DEFAULT;
+    this->demo_settings.wifi_settings.does_search_country_code = DEMO_WIFI_DOES_SEARCH_COUNTRY_CODE_DEFAULT;
 
     this->demo_settings.gnss_autonomous_settings.option        = DEMO_GNSS_AUTONOMOUS_OPTION_DEFAULT;
     this->demo_settings.gnss_autonomous_settings.capture_mode  = DEMO_GNSS_AUTONOMOUS_CAPTURE_MODE_DEFAULT;
@@ -93,6 +95,30 @@ bool CommandStartDemo::ConfigureFromPayload( const uint8_t* buffer, const uint16
         break;
     }
 
+    case COMMAND_BASE_DEMO_SPECTRUM_SWEEP:
+    {
+        success = this->ConfigureSpectrumSweep( config_buffer, config_buffer_size );
+        break;
+    }
+
+    case COMMAND_BASE_DEMO_CAD_SNIFFER:
+    {
+        success = this->ConfigureCadSniffer( config_buffer, config_buffer_size );
+        break;
+    }
+
+    case COMMAND_BASE_DEMO_RX_DUTY_CYCLE:
+    {
+        success = this->ConfigureRxDutyCycle( config_buffer, config_buffer_size );
+        break;
+    }
+
+    case COMMAND_BASE_DEMO_GEOLOCATION:
+    {
+        success = this->ConfigureGeolocation( config_buffer, config_buffer_size );
+        break;
+    }
+
     default:
     {
         success = false;
@@ -112,8 +138,9 @@ bool CommandStartDemo::ConfigureFromPayload( const uint8_t* buffer, const uint16
 
 bool CommandStartDemo::ConfigureWifiScan( const uint8_t* buffer, const uint16_t buffer_size )
 {
+    // The last bytes, enabling the adaptive channel mask then the country code search, are optional
     bool success = false;
-    if( buffer_size == 9 )
+    if( ( buffer_size >= 9 ) && ( buffer_size <= 11 ) )
     {
         const uint16_t         wifi_channel_mask     = buffer[0] + buffer[1] * 256;
         const uint8_t          wifi_type_mask        = buffer[2];
@@ -122,16 +149,22 @@ bool CommandStartDemo::ConfigureWifiScan( const uint8_t* buffer, const uint16_t
         const uint16_t         wifi_timeout_ms       = buffer[5] + ( buffer[6] * 256 );
         const demo_wifi_mode_t wifi_mode             = CommandStartDemo::wifi_mode_from_value( buffer[7] );
         const bool             wifi_abort_on_timeout = ( buffer[8] == 0x01 ) ? true : false;
+        const bool             wifi_adaptive_mask    = ( buffer_size >= 10 ) && ( buffer[9] == 0x01 );
+        const bool             wifi_country_code     = ( buffer_size == 11 ) && ( buffer[10] == 0x01 );
+
+        const demo_wifi_result_type_t wifi_result_type = CommandStartDemo::wifi_result_type_from_value( buffer[7] );
 
         this->demo_settings.wifi_settings.channels = ( demo_wifi_channel_mask_t ) wifi_channel_mask;
         this->demo_settings.wifi_settings.types    = CommandStartDemo::wifi_signal_type_scan_from_val( wifi_type_mask );
-        this->demo_settings.wifi_settings.scan_mode             = wifi_mode;
-        this->demo_settings.wifi_settings.nbr_retrials          = wifi_nbr_retrials;
-        this->demo_settings.wifi_settings.max_results           = wifi_max_results;
-        this->demo_settings.wifi_settings.timeout               = wifi_timeout_ms;
-        this->demo_settings.wifi_settings.result_type           = DEMO_WIFI_RESULT_TYPE_DEFAULT;
-        this->demo_settings.wifi_settings.does_abort_on_timeout = wifi_abort_on_timeout;
-        success                                                 = true;
+        this->demo_settings.wifi_settings.scan_mode                = wifi_mode;
+        this->demo_settings.wifi_settings.nbr_retrials             = wifi_nbr_retrials;
+        this->demo_settings.wifi_settings.max_results              = wifi_max_results;
+        this->demo_settings.wifi_settings.timeout                  = wifi_timeout_ms;
+        this->demo_settings.wifi_settings.result_type              = wifi_result_type;
+        this->demo_settings.wifi_settings.does_abort_on_timeout    = wifi_abort_on_timeout;
+        this->demo_settings.wifi_settings.is_channel_mask_adaptive = wifi_adaptive_mask;
+        this->demo_settings.wifi_settings.does_search_country_code = wifi_country_code;
+        success                                                    = true;
     }
     else
     {
@@ -226,6 +259,142 @@ bool CommandStartDemo::ConfigureGnss( demo_gnss_settings_t* gnss_setting, const
     return success;
 }
 
+bool CommandStartDemo::ConfigureSpectrumSweep( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    bool success = false;
+    if( buffer_size == 13 )
+    {
+        const uint32_t start_frequency_hz =
+            buffer[0] + ( buffer[1] << 8 ) + ( buffer[2] << 16 ) + ( ( uint32_t ) buffer[3] << 24 );
+        const uint32_t step_frequency_hz =
+            buffer[4] + ( buffer[5] << 8 ) + ( buffer[6] << 16 ) + ( ( uint32_t ) buffer[7] << 24 );
+        const uint8_t  nb_channels            = buffer[8];
+        const uint8_t  nb_samples_per_channel = buffer[9];
+        const uint16_t nb_sweeps              = buffer[10] + ( buffer[11] * 256 );
+        const uint8_t  rx_bandwidth           = buffer[12];
+
+        const bool is_nb_channels_valid = ( nb_channels != 0 ) && ( nb_channels <= DEMO_SPECTRUM_SWEEP_MAX_CHANNELS );
+        const bool is_nb_samples_valid  = ( nb_samples_per_channel != 0 ) &&
+                                         ( nb_samples_per_channel <= DEMO_SPECTRUM_SWEEP_MAX_SAMPLES_PER_CHANNEL );
+
+        // Computed on 64 bits so that a large step cannot wrap the last frequency back into the band
+        const uint64_t stop_frequency_hz =
+            ( uint64_t ) start_frequency_hz + ( uint64_t ) step_frequency_hz * ( nb_channels - 1 );
+        const bool is_range_valid = ( step_frequency_hz != 0 ) &&
+                                    ( start_frequency_hz >= DEMO_RADIO_RF_FREQUENCY_MIN ) &&
+                                    ( stop_frequency_hz <= DEMO_RADIO_RF_FREQUENCY_MAX );
+
+        if( ( is_nb_channels_valid == true ) && ( is_nb_samples_valid == true ) && ( is_range_valid == true ) &&
+            ( CommandStartDemo::is_gfsk_bandwidth_valid( rx_bandwidth ) == true ) )
+        {
+            demo_spectrum_sweep_settings_t& sweep_settings = this->demo_settings.spectrum_sweep_settings;
+
+            sweep_settings.start_frequency_hz     = start_frequency_hz;
+            sweep_settings.step_frequency_hz      = step_frequency_hz;
+            sweep_settings.nb_channels            = nb_channels;
+            sweep_settings.nb_samples_per_channel = nb_samples_per_channel;
+            sweep_settings.nb_sweeps              = nb_sweeps;
+            sweep_settings.rx_bandwidth           = ( lr1110_radio_gfsk_bw_t ) rx_bandwidth;
+            success                               = true;
+        }
+    }
+    return success;
+}
+
+bool CommandStartDemo::ConfigureCadSniffer( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    bool success = false;
+    if( buffer_size >= 9 )
+    {
+        const uint8_t  nb_channels     = buffer[0];
+        const uint16_t sf_mask         = buffer[1] + ( buffer[2] * 256 );
+        const uint8_t  bandwidth       = buffer[3];
+        const uint8_t  cad_symb_nb     = buffer[4];
+        const uint8_t  cad_detect_peak = buffer[5];
+        const uint8_t  cad_detect_min  = buffer[6];
+        const uint16_t nb_cycles       = buffer[7] + ( buffer[8] * 256 );
+
+        const bool is_nb_channels_valid = ( nb_channels != 0 ) && ( nb_channels <= DEMO_CAD_SNIFFER_MAX_CHANNELS );
+        const bool is_sf_mask_valid     = ( sf_mask & DEMO_CAD_SNIFFER_SF_MASK_ALL ) != 0;
+
+        // A null detection threshold would make every CAD report activity on noise
+        const bool is_cad_detection_valid = ( cad_detect_peak != 0 ) && ( cad_detect_min != 0 );
+
+        uint32_t frequencies_hz[DEMO_CAD_SNIFFER_MAX_CHANNELS] = { 0 };
+        bool     are_frequencies_valid =
+            ( is_nb_channels_valid == true ) && ( buffer_size == ( 9 + ( nb_channels * 4 ) ) );
+        for( uint8_t channel = 0; ( are_frequencies_valid == true ) && ( channel < nb_channels ); channel++ )
+        {
+            const uint8_t* frequency_buffer = buffer + 9 + ( channel * 4 );
+
+            frequencies_hz[channel] = frequency_buffer[0] + ( frequency_buffer[1] << 8 ) +
+                                      ( frequency_buffer[2] << 16 ) + ( ( uint32_t ) frequency_buffer[3] << 24 );
+            are_frequencies_valid   = ( frequencies_hz[channel] >= DEMO_RADIO_RF_FREQUENCY_MIN ) &&
+                                      ( frequencies_hz[channel] <= DEMO_RADIO_RF_FREQUENCY_MAX );
+        }
+
+        if( ( are_frequencies_valid == true ) && ( is_sf_mask_valid == true ) &&
+            ( CommandStartDemo::is_lora_bandwidth_valid( bandwidth ) == true ) &&
+            ( CommandStartDemo::is_cad_symbol_number_valid( cad_symb_nb ) == true ) &&
+            ( is_cad_detection_valid == true ) )
+        {
+            demo_cad_sniffer_settings_t& cad_settings = this->demo_settings.cad_sniffer_settings;
+
+            for( uint8_t channel = 0; channel < nb_channels; channel++ )
+            {
+                cad_settings.frequencies_hz[channel] = frequencies_hz[channel];
+            }
+            cad_settings.nb_channels     = nb_channels;
+            cad_settings.sf_mask         = sf_mask;
+            cad_settings.bandwidth       = ( lr1110_radio_lora_bw_t ) bandwidth;
+            cad_settings.cad_symb_nb     = cad_symb_nb;
+            cad_settings.cad_detect_peak = cad_detect_peak;
+            cad_settings.cad_detect_min  = cad_detect_min;
+            cad_settings.nb_cycles       = nb_cycles;
+            success                      = true;
+        }
+    }
+    return success;
+}
+
+bool CommandStartDemo::ConfigureRxDutyCycle( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    bool success = false;
+    if( buffer_size == 8 )
+    {
+        const uint32_t rx_period_ms =
+            buffer[0] + ( buffer[1] << 8 ) + ( buffer[2] << 16 ) + ( ( uint32_t ) buffer[3] << 24 );
+        const uint32_t sleep_period_ms =
+            buffer[4] + ( buffer[5] << 8 ) + ( buffer[6] << 16 ) + ( ( uint32_t ) buffer[7] << 24 );
+
+        const bool is_rx_period_valid = ( rx_period_ms != 0 ) && ( rx_period_ms <= DEMO_RX_DUTY_CYCLE_MAX_PERIOD_MS );
+        const bool is_sleep_period_valid =
+            ( sleep_period_ms != 0 ) && ( sleep_period_ms <= DEMO_RX_DUTY_CYCLE_MAX_PERIOD_MS );
+
+        if( ( is_rx_period_valid == true ) && ( is_sleep_period_valid == true ) )
+        {
+            this->demo_settings.rx_duty_cycle_settings.rx_period_ms    = rx_period_ms;
+            this->demo_settings.rx_duty_cycle_settings.sleep_period_ms = sleep_period_ms;
+            success                                                    = true;
+        }
+    }
+    return success;
+}
+
+bool CommandStartDemo::ConfigureGeolocation( const uint8_t* buffer, const uint16_t buffer_size )
+{
+    // The payload is the Wi-Fi scan configuration followed by the GNSS autonomous configuration
+    bool success = false;
+    if( ( buffer_size >= 14 ) && ( buffer_size <= 16 ) )
+    {
+        const uint16_t wifi_buffer_size = buffer_size - 5;
+
+        success = this->ConfigureWifiScan( buffer, wifi_buffer_size ) &&
+                  this->ConfigureGnssAutonomous( buffer + wifi_buffer_size, 5 );
+    }
+    return success;
+}
+
 demo_wifi_mode_t CommandStartDemo::wifi_mode_from_value( const uint8_t& value )
 {
     demo_wifi_mode_t wifi_mode = DEMO_WIFI_SCAN_MODE_BEACON;
@@ -242,10 +411,22 @@ demo_wifi_mode_t CommandStartDemo::wifi_mode_from_value( const uint8_t& value )
         wifi_mode = DEMO_WIFI_SCAN_MODE_BEACON_AND_PACKET;
         break;
     }
+
+    case 3:
+    {
+        wifi_mode = DEMO_WIFI_SCAN_MODE_BEACON;
+        break;
+    }
     }
     return wifi_mode;
 }
 
+demo_wifi_result_type_t CommandStartDemo::wifi_result_type_from_value( const uint8_t& value )
+{
+    // Mode 3 scans the full beacons to get the extended results, including the SSID
+    return ( value == 3 ) ? DEMO_WIFI_RESULT_TYPE_EXTENDED_FULL : DEMO_WIFI_RESULT_TYPE_DEFAULT;
+}
+
 demo_wifi_signal_type_scan_t CommandStartDemo::wifi_signal_type_scan_from_val( const uint8_t& val )
 {
     demo_wifi_signal_type_scan_t wifi_type = DEMO_WIFI_SETTING_TYPE_B;
@@ -270,6 +451,72 @@ demo_wifi_signal_type_scan_t CommandStartDemo::wifi_signal_type_scan_from_val( c
     return wifi_type;
 }
 
+bool CommandStartDemo::is_gfsk_bandwidth_valid( const uint8_t& value )
+{
+    bool is_valid = false;
+    switch( value )
+    {
+    case LR1110_RADIO_GFSK_BW_4800:
+    case LR1110_RADIO_GFSK_BW_5800:
+    case LR1110_RADIO_GFSK_BW_7300:
+    case LR1110_RADIO_GFSK_BW_9700:
+    case LR1110_RADIO_GFSK_BW_11700:
+    case LR1110_RADIO_GFSK_BW_14600:
+    case LR1110_RADIO_GFSK_BW_19500:
+    case LR1110_RADIO_GFSK_BW_23400:
+    case LR1110_RADIO_GFSK_BW_29300:
+    case LR1110_RADIO_GFSK_BW_39000:
+    case LR1110_RADIO_GFSK_BW_46900:
+    case LR1110_RADIO_GFSK_BW_58600:
+    case LR1110_RADIO_GFSK_BW_78200:
+    case LR1110_RADIO_GFSK_BW_93800:
+    case LR1110_RADIO_GFSK_BW_117300:
+    case LR1110_RADIO_GFSK_BW_156200:
+    case LR1110_RADIO_GFSK_BW_187200:
+    case LR1110_RADIO_GFSK_BW_234300:
+    case LR1110_RADIO_GFSK_BW_312000:
+    case LR1110_RADIO_GFSK_BW_373600:
+    case LR1110_RADIO_GFSK_BW_467000:
+    {
+        is_valid = true;
+        break;
+    }
+    default:
+        is_valid = false;
+    }
+    return is_valid;
+}
+
+bool CommandStartDemo::is_lora_bandwidth_valid( const uint8_t& value )
+{
+    bool is_valid = false;
+    switch( value )
+    {
+    case LR1110_RADIO_LORA_BW_10:
+    case LR1110_RADIO_LORA_BW_15:
+    case LR1110_RADIO_LORA_BW_20:
+    case LR1110_RADIO_LORA_BW_31:
+    case LR1110_RADIO_LORA_BW_41:
+    case LR1110_RADIO_LORA_BW_62:
+    case LR1110_RADIO_LORA_BW_125:
+    case LR1110_RADIO_LORA_BW_250:
+    case LR1110_RADIO_LORA_BW_500:
+    {
+        is_valid = true;
+        break;
+    }
+    default:
+        is_valid = false;
+    }
+    return is_valid;
+}
+
+bool CommandStartDemo::is_cad_symbol_number_valid( const uint8_t& value )
+{
+    // The radio only runs a CAD over 1, 2, 4, 8 or 16 symbols
+    return ( value == 1 ) || ( value == 2 ) || ( value == 4 ) || ( value == 8 ) || ( value == 16 );
+}
+
 bool CommandStartDemo::Job( )
 {
     bool success = false;
@@ -302,6 +549,35 @@ bool CommandStartDemo::Job( )
         success = true;
         break;
     }
+
+    case COMMAND_BASE_DEMO_SPECTRUM_SWEEP:
+    {
+        this->demo_holder.UpdateConfigSpectrumSweep( &this->demo_settings.spectrum_sweep_settings );
+        success = true;
+        break;
+    }
+
+    case COMMAND_BASE_DEMO_CAD_SNIFFER:
+    {
+        this->demo_holder.UpdateConfigCadSniffer( &this->demo_settings.cad_sniffer_settings );
+        success = true;
+        break;
+    }
+
+    case COMMAND_BASE_DEMO_RX_DUTY_CYCLE:
+    {
+        this->demo_holder.UpdateConfigRxDutyCycle( &this->demo_settings.rx_duty_cycle_settings );
+        success = true;
+        break;
+    }
+
+    case COMMAND_BASE_DEMO_GEOLOCATION:
+    {
+        this->demo_holder.UpdateConfigWifiScan( &this->demo_settings.wifi_settings );
+        this->demo_holder.UpdateConfigAutonomousGnss( &this->demo_settings.gnss_autonomous_settings );
+        success = true;
+        break;
+    }
     default:
     {
         // The demo id to start is unknown. Reset it to NO_DEMO and indicate failure of the job
@@ -73,6 +73,11 @@
 #define LR1110_WIFI_MAX_RESULT_PER_TRANSACTION( single_size ) \
     ( MIN( ( LR1110_WIFI_READ_RESULT_LIMIT ) / ( single_size ), LR1110_WIFI_N_RESULTS_MAX_PER_CHUNK ) )
 
+#define LR1110_WIFI_STREAM_BUFFER_SIZE ( 320 )
+
+#define LR1110_WIFI_STREAM_RESULT_PER_TRANSACTION( single_size ) \
+    ( MIN( ( LR1110_WIFI_STREAM_BUFFER_SIZE ) / ( single_size ), LR1110_WIFI_N_RESULTS_MAX_PER_CHUNK ) )
+
 #define LR1110_WIFI_ALL_CUMULATIVE_TIMING_SIZE ( 16 )
 #define LR1110_WIFI_VERSION_SIZE ( 2 )
 #define LR1110_WIFI_READ_RESULT_LIMIT ( 1020 )
@@ -130,6 +135,16 @@ typedef union
     lr1110_wifi_extended_full_result_t*          extended_complete;
 } lr1110_wifi_result_interface_t;
 
+/*!
+ * @brief Wi-Fi scan results callback interface
+ */
+typedef union
+{
+    lr1110_wifi_basic_complete_result_callback_t         basic_complete;
+    lr1110_wifi_basic_mac_type_channel_result_callback_t basic_mac_type_channel;
+    lr1110_wifi_extended_full_result_callback_t          extended_complete;
+} lr1110_wifi_result_callback_interface_t;
+
 /*
  * -----------------------------------------------------------------------------
  * --- PRIVATE VARIABLES -------------------------------------------------------
@@ -203,6 +218,25 @@ static lr1110_status_t fetch_and_aggregate_all_results( const void* context, con
                                                         uint8_t*                          result_buffer,
                                                         lr1110_wifi_result_interface_t    result_structures );
 
+/*!
+ * @brief Fetch results chunk by chunk and hand them one at a time to a callback
+ *
+ * @returns Operation status
+ */
+static lr1110_status_t fetch_and_stream_all_results( const void* context, const uint8_t index_result_start,
+                                                     const uint8_t                           nb_results,
+                                                     const lr1110_wifi_result_format_t       result_format_code,
+                                                     lr1110_wifi_result_callback_interface_t result_callback,
+                                                     void*                                   user_context );
+
+/*!
+ * @brief Parse a single result and hand it to the callback matching its format
+ *
+ * @returns The value returned by the callback
+ */
+static bool generic_result_streamer( const uint8_t* buffer, lr1110_wifi_result_callback_interface_t result_callback,
+                                     void* user_context, const lr1110_wifi_result_format_t format_code );
+
 /*!
  * @brief Share the size of a result format
  *
@@ -378,6 +412,42 @@ lr1110_status_t lr1110_wifi_read_extended_full_results( const void* radio, const
                                             LR1110_WIFI_RESULT_FORMAT_EXTENDED_FULL, result_buffer, result_interface );
 }
 
+lr1110_status_t lr1110_wifi_stream_basic_complete_results( const void* context, const uint8_t start_result_index,
+                                                           const uint8_t                                nb_results,
+                                                           lr1110_wifi_basic_complete_result_callback_t callback,
+                                                           void*                                        user_context )
+{
+    lr1110_wifi_result_callback_interface_t result_callback = { 0 };
+    result_callback.basic_complete                          = callback;
+
+    return fetch_and_stream_all_results( context, start_result_index, nb_results,
+                                         LR1110_WIFI_RESULT_FORMAT_BASIC_COMPLETE, result_callback, user_context );
+}
+
+lr1110_status_t lr1110_wifi_stream_basic_mac_type_channel_results(
+    const void* context, const uint8_t start_result_index, const uint8_t nb_results,
+    lr1110_wifi_basic_mac_type_channel_result_callback_t callback, void* user_context )
+{
+    lr1110_wifi_result_callback_interface_t result_callback = { 0 };
+    result_callback.basic_mac_type_channel                  = callback;
+
+    return fetch_and_stream_all_results( context, start_result_index, nb_results,
+                                         LR1110_WIFI_RESULT_FORMAT_BASIC_MAC_TYPE_CHANNEL, result_callback,
+                                         user_context );
+}
+
+lr1110_status_t lr1110_wifi_stream_extended_full_results( const void* context, const uint8_t start_result_index,
+                                                          const uint8_t                               nb_results,
+                                                          lr1110_wifi_extended_full_result_callback_t callback,
+                                                          void*                                       user_context )
+{
+    lr1110_wifi_result_callback_interface_t result_callback = { 0 };
+    result_callback.extended_complete                       = callback;
+
+    return fetch_and_stream_all_results( context, start_result_index, nb_results,
+                                         LR1110_WIFI_RESULT_FORMAT_EXTENDED_FULL, result_callback, user_context );
+}
+
 lr1110_status_t lr1110_wifi_reset_cumulative_timing( const void* context )
 {
     const uint8_t cbuffer[LR1110_WIFI_RESET_CUMUL_TIMING_CMD_LENGTH] = {
@@ -655,24 +725,82 @@ static lr1110_status_t fetch_and_aggregate_all_results( const void* context, con
             return ( lr1110_status_t ) local_hal_status;
         }
 
+        // Each chunk overwrites the bytes parsed from the previous one, so the buffer does not need to be reset
         generic_results_interpreter( results_to_read, index_result_start_writing, result_buffer, result_structures,
                                      result_format_code );
 
-        // Reset the content of the result_buffer in case there are still results to fetch
+        index_to_read += results_to_read;
+        index_result_start_writing += results_to_read;
+        remaining_results -= results_to_read;
+    }
+    return ( lr1110_status_t ) hal_status;
+}
+
+static lr1110_status_t fetch_and_stream_all_results( const void* context, const uint8_t index_result_start,
+                                                     const uint8_t                           nb_results,
+                                                     const lr1110_wifi_result_format_t       result_format_code,
+                                                     lr1110_wifi_result_callback_interface_t result_callback,
+                                                     void*                                   user_context )
+{
+    uint8_t       result_buffer[LR1110_WIFI_STREAM_BUFFER_SIZE];
+    const uint8_t result_size              = lr1110_wifi_get_result_size_from_format( result_format_code );
+    const uint8_t nb_results_per_chunk_max = LR1110_WIFI_STREAM_RESULT_PER_TRANSACTION( result_size );
+    uint8_t       index_to_read            = index_result_start;
+    uint8_t       remaining_results        = nb_results;
+
+    while( remaining_results > 0 )
+    {
+        const uint8_t results_to_read = MIN( remaining_results, nb_results_per_chunk_max );
+
+        const lr1110_hal_status_t hal_status = lr1110_wifi_read_results_helper( context, index_to_read, results_to_read,
+                                                                                result_buffer, result_format_code );
+        if( hal_status != LR1110_HAL_STATUS_OK )
+        {
+            return ( lr1110_status_t ) hal_status;
+        }
+
+        for( uint8_t result_index = 0; result_index < results_to_read; result_index++ )
         {
-            const uint16_t result_buffer_size =
-                LR1110_WIFI_MAX_SIZE_PER_SPI( lr1110_wifi_get_result_size_from_format( result_format_code ) );
-            for( uint16_t index = 0; index < result_buffer_size; index++ )
+            if( generic_result_streamer( &result_buffer[result_size * result_index], result_callback, user_context,
+                                         result_format_code ) == false )
             {
-                result_buffer[index] = 0;
+                return LR1110_STATUS_OK;
             }
         }
 
         index_to_read += results_to_read;
-        index_result_start_writing += results_to_read;
         remaining_results -= results_to_read;
     }
-    return ( lr1110_status_t ) hal_status;
+    return LR1110_STATUS_OK;
+}
+
+static bool generic_result_streamer( const uint8_t* buffer, lr1110_wifi_result_callback_interface_t result_callback,
+                                     void* user_context, const lr1110_wifi_result_format_t format_code )
+{
+    switch( format_code )
+    {
+    case LR1110_WIFI_RESULT_FORMAT_BASIC_COMPLETE:
+    {
+        lr1110_wifi_basic_complete_result_t result;
+        interpret_basic_complete_result_from_buffer( 1, 0, buffer, &result );
+        return result_callback.basic_complete( &result, user_context );
+    }
+
+    case LR1110_WIFI_RESULT_FORMAT_BASIC_MAC_TYPE_CHANNEL:
+    {
+        lr1110_wifi_basic_mac_type_channel_result_t result;
+        interpret_basic_mac_type_channel_result_from_buffer( 1, 0, buffer, &result );
+        return result_callback.basic_mac_type_channel( &result, user_context );
+    }
+
+    case LR1110_WIFI_RESULT_FORMAT_EXTENDED_FULL:
+    {
+        lr1110_wifi_extended_full_result_t result;
+        interpret_extended_full_result_from_buffer( 1, 0, buffer, &result );
+        return result_callback.extended_complete( &result, user_context );
+    }
+    }
+    return false;
 }
 
 static void generic_results_interpreter( const uint8_t n_result_to_parse, const uint8_t index_result_start_writing,
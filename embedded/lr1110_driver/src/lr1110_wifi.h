@@ -392,6 +392,71 @@ lr1110_status_t lr1110_wifi_read_extended_full_results( const void* radio, const
                                                         const uint8_t                       nb_results,
                                                         lr1110_wifi_extended_full_result_t* results );
 
+/*!
+ * @brief Read basic complete results and hand them one at a time to a callback
+ *
+ * The results are parsed directly out of the SPI buffer, so the caller does not need an array able to hold all of
+ * them. Reading stops as soon as the callback returns false.
+ *
+ * @param [in] context Chip implementation context
+ * @param [in] start_result_index Result index from which starting to fetch the results
+ * @param [in] nb_results Number of results to fetch
+ * @param [in] callback Function called for each result
+ * @param [in] user_context Pointer given back to the callback
+ *
+ * @returns Operation status
+ *
+ * /see lr1110_wifi_read_basic_complete_results
+ */
+lr1110_status_t lr1110_wifi_stream_basic_complete_results( const void* context, const uint8_t start_result_index,
+                                                           const uint8_t                                nb_results,
+                                                           lr1110_wifi_basic_complete_result_callback_t callback,
+                                                           void*                                        user_context );
+
+/*!
+ * @brief Read basic MAC, type, channel results and hand them one at a time to a callback
+ *
+ * The results are parsed directly out of the SPI buffer, so the caller does not need an array able to hold all of
+ * them. Reading stops as soon as the callback returns false.
+ *
+ * @param [in] context Chip implementation context
+ * @param [in] start_result_index Result index from which starting to fetch the results
+ * @param [in] nb_results Number of results to fetch
+ * @param [in] callback Function called for each result
+ * @param [in] user_context Pointer given back to the callback
+ *
+ * @returns Operation status
+ *
+ * /see lr1110_wifi_read_basic_mac_type_channel_results
+ */
+lr1110_status_t lr1110_wifi_stream_basic_mac_type_channel_results(
+    const void* context, const uint8_t start_result_index, const uint8_t nb_results,
+    lr1110_wifi_basic_mac_type_channel_result_callback_t callback, void* user_context );
+
+/*!
+ * @brief Read extended full results and hand them one at a time to a callback
+ *
+ * The results are parsed directly out of the SPI buffer, so the caller does not need an array able to hold all of
+ * them. Reading stops as soon as the callback returns false.
+ *
+ * @remark: This result fetching function **MUST** be used only if the scan function call was made with Scan Mode set to
+ * LR1110_WIFI_SCAN_MODE_FULL_BEACON.
+ *
+ * @param [in] context Chip implementation context
+ * @param [in] start_result_index Result index from which starting to fetch the results
+ * @param [in] nb_results Number of results to fetch
+ * @param [in] callback Function called for each result
+ * @param [in] user_context Pointer given back to the callback
+ *
+ * @returns Operation status
+ *
+ * /see lr1110_wifi_read_extended_full_results
+ */
+lr1110_status_t lr1110_wifi_stream_extended_full_results( const void* context, const uint8_t start_result_index,
+                                                          const uint8_t                               nb_results,
+                                                          lr1110_wifi_extended_full_result_callback_t callback,
+                                                          void*                                       user_context );
+
 /*!
  * @brief Reset the internal counters of cumulative timing
  *
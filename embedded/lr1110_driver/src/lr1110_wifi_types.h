@@ -390,6 +390,39 @@ typedef struct lr1110_wifi_version_s
     uint8_t minor;
 } lr1110_wifi_version_t;
 
+/*!
+ * @brief Callback receiving the basic complete results one at a time
+ *
+ * @param [in] result The result parsed from the SPI buffer, only valid during the call
+ * @param [in] user_context The context given to the streaming function
+ *
+ * @returns true to receive the next result, false to stop reading results
+ */
+typedef bool ( *lr1110_wifi_basic_complete_result_callback_t )( const lr1110_wifi_basic_complete_result_t* result,
+                                                                void* user_context );
+
+/*!
+ * @brief Callback receiving the basic MAC, type, channel results one at a time
+ *
+ * @param [in] result The result parsed from the SPI buffer, only valid during the call
+ * @param [in] user_context The context given to the streaming function
+ *
+ * @returns true to receive the next result, false to stop reading results
+ */
+typedef bool ( *lr1110_wifi_basic_mac_type_channel_result_callback_t )(
+    const lr1110_wifi_basic_mac_type_channel_result_t* result, void* user_context );
+
+/*!
+ * @brief Callback receiving the extended full results one at a time
+ *
+ * @param [in] result The result parsed from the SPI buffer, only valid during the call
+ * @param [in] user_context The context given to the streaming function
+ *
+ * @returns true to receive the next result, false to stop reading results
+ */
+typedef bool ( *lr1110_wifi_extended_full_result_callback_t )( const lr1110_wifi_extended_full_result_t* result,
+                                                               void*                                     user_context );
+
 /*
  * -----------------------------------------------------------------------------
  * --- PUBLIC FUNCTIONS PROTOTYPES ---------------------------------------------
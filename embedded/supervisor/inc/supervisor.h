@@ -39,13 +39,15 @@
 #include "configuration.h"
 #include "demo_manager_interface.h"
 #include "connectivity_manager_interface.h"
+#include "demo_scheduler.h"
+#include "system_lpm.h"
 
 class Supervisor
 {
    public:
     Supervisor( Gui* gui, DeviceInterface* device, DemoManagerInterface* demo_manager,
                 EnvironmentInterface* environment, CommunicationManager* communication_manager,
-                ConnectivityManagerInterface* connectivity );
+                ConnectivityManagerInterface* connectivity, DemoScheduler* scheduler );
     virtual ~Supervisor( );
 
     void Init( );
@@ -65,6 +67,7 @@ class Supervisor
     void TransferResultToGui( const demo_gnss_all_results_t* result );
     void TransferResultToGui( const demo_ping_pong_results_t* result );
     void TransferResultToGui( const demo_radio_per_results_t* result );
+    void TransferResultToGui( const demo_spectrum_sweep_results_t* result );
     void TransferResultToGui( const demo_modem_temperature_results_t* result );
     void TransferResultToGui( const demo_modem_file_upload_results_t* result );
 
@@ -74,6 +77,12 @@ class Supervisor
     void TransferResultToSerial( const demo_wifi_scan_all_results_t* result );
     void TransferResultToSerial( const demo_gnss_all_results_t* result );
 
+    void TransferGeolocationResults( const demo_geolocation_results_t* result );
+
+    void TransferResultToSinks( const demo_wifi_scan_all_results_t* result, const uint8_t sinks );
+    void TransferResultToSinks( const demo_gnss_all_results_t* result, const uint8_t sinks );
+    void TransferScheduledScanResults( );
+
     void ConvertSettingsFromDemoToGui( const demo_all_settings_t* demo_settings, GuiDemoSettings_t* gui_demo_settings );
 
     void ConvertSettingsFromGuiToDemo( const GuiRadioSetting_t* gui_settings, demo_radio_settings_t* demo_settings );
@@ -82,6 +91,7 @@ class Supervisor
 
     void GuiRuntimeAndProcess( );
     void DemoRuntimeAndProcess( );
+    void SchedulerRuntime( );
     void CommunicationManagerRuntime( );
     void InterruptionRuntime( );
     void NetworkConnectivityRuntimeAndProcess( );
@@ -89,7 +99,8 @@ class Supervisor
 
     void GetAndPropagateVersion( );
 
-    void EnterWaitForInterrupt( ) const;
+    void              EnterWaitForInterrupt( ) const;
+    system_lpm_mode_t GetLowPowerMode( ) const;
 
     static GuiDemoStatus_t DemoGnssErrorCodeToGuiStatus( const demo_gnss_error_t error_code );
 
@@ -106,6 +117,7 @@ class Supervisor
     ConnectivityManagerInterface* connectivity_manager;
     CommunicationManager*         communication_manager;
     bool                          has_connectivity;
+    DemoScheduler*                scheduler;
 };
 
 #endif  // __SUPERVISOR_H__
@@ -31,6 +31,8 @@
 
 #include "supervisor.h"
 #include "connectivity_conversions.h"
+#include "system_uart.h"
+#include "system_lptim.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -50,7 +52,7 @@ bool          Supervisor::is_down_gui_interrupt    = false;
 
 Supervisor::Supervisor( Gui* gui, DeviceInterface* device, DemoManagerInterface* demo_manager,
                         EnvironmentInterface* environment, CommunicationManager* communication_manager,
-                        ConnectivityManagerInterface* connectivity_manager )
+                        ConnectivityManagerInterface* connectivity_manager, DemoScheduler* scheduler )
     : run_demo( false ),
       demo_manager( demo_manager ),
       gui( gui ),
@@ -58,7 +60,8 @@ Supervisor::Supervisor( Gui* gui, DeviceInterface* device, DemoManagerInterface*
       device( device ),
       connectivity_manager( connectivity_manager ),
       communication_manager( communication_manager ),
-      has_connectivity( connectivity_manager->IsConnectable( ) )
+      has_connectivity( connectivity_manager->IsConnectable( ) ),
+      scheduler( scheduler )
 {
     version_handler.almanac_crc  = 0;
     version_handler.almanac_date = 0;
@@ -96,9 +99,7 @@ void Supervisor::Init( )
     gui_gnss_demo_assistance_position_default.longitude      = location.longitude;
     gui_gnss_demo_assistance_position_default.set_by_network = false;
 
-    this->gui->Init( &gui_demo_settings, &gui_demo_settings_default, &gui_gnss_demo_assistance_position,
-                     &gui_gnss_demo_assistance_position_default, &version_handler );
-
+    // The connectivity must be known before the GUI initialization, which builds the menus depending on it
     if( this->has_connectivity == true )
     {
         this->gui->EnableConnectivity( );
@@ -107,6 +108,9 @@ void Supervisor::Init( )
     {
         this->gui->DisableConnectivity( );
     }
+
+    this->gui->Init( &gui_demo_settings, &gui_demo_settings_default, &gui_gnss_demo_assistance_position,
+                     &gui_gnss_demo_assistance_position_default, &version_handler );
 }
 
 void Supervisor::ConvertSettingsFromDemoToGui( const demo_all_settings_t* demo_settings,
@@ -186,6 +190,8 @@ void Supervisor::ConvertSettingsFromDemoToGui( const demo_all_settings_t* demo_s
 
     gui_demo_settings->radio_settings.payload_length = demo_settings->radio_settings.nb_of_packets;
 
+    gui_demo_settings->radio_settings.rx_sampling_period_ms = demo_settings->radio_settings.rx_sampling_period_ms;
+
     gui_demo_settings->radio_settings.is_lora =
         ( demo_settings->radio_settings.pkt_type == LR1110_RADIO_PKT_TYPE_LORA ) ? true : false;
 
@@ -194,6 +200,9 @@ void Supervisor::ConvertSettingsFromDemoToGui( const demo_all_settings_t* demo_s
 
     gui_demo_settings->radio_settings.lora.sf = demo_settings->radio_settings.modulation_lora.sf - 5;
 
+    // The display refresh rate only concerns the GUI, so it has no demo counterpart
+    gui_demo_settings->radio_settings.refresh_rate = GUI_REFRESH_RATE_DEFAULT;
+
     switch( demo_settings->radio_settings.modulation_lora.bw )
     {
     case LR1110_RADIO_LORA_BW_125:
@@ -304,10 +313,11 @@ void Supervisor::ConvertSettingsFromDemoToGui( const demo_all_settings_t* demo_s
 void Supervisor::ConvertSettingsFromGuiToDemo( const GuiRadioSetting_t* gui_settings,
                                                demo_radio_settings_t*   demo_settings )
 {
-    demo_settings->rf_frequency   = gui_settings->rf_freq_in_hz;
-    demo_settings->tx_power       = gui_settings->pwr_in_dbm;
-    demo_settings->nb_of_packets  = gui_settings->nb_of_packets;
-    demo_settings->payload_length = gui_settings->payload_length;
+    demo_settings->rf_frequency          = gui_settings->rf_freq_in_hz;
+    demo_settings->tx_power              = gui_settings->pwr_in_dbm;
+    demo_settings->nb_of_packets         = gui_settings->nb_of_packets;
+    demo_settings->payload_length        = gui_settings->payload_length;
+    demo_settings->rx_sampling_period_ms = gui_settings->rx_sampling_period_ms;
     demo_settings->pkt_type =
         ( gui_settings->is_lora == true ) ? LR1110_RADIO_PKT_TYPE_LORA : LR1110_RADIO_PKT_TYPE_GFSK;
 
@@ -510,11 +520,17 @@ void Supervisor::Runtime( )
     this->GuiRuntimeAndProcess( );
     this->CommunicationManagerRuntime( );
     this->DeviceRuntime( );
+    this->SchedulerRuntime( );
 
     if( this->run_demo )
     {
         this->DemoRuntimeAndProcess( );
     }
+
+    if( this->CanEnterLowPower( ) )
+    {
+        this->EnterWaitForInterrupt( );
+    }
 }
 
 void Supervisor::GuiRuntimeAndProcess( )
@@ -696,6 +712,12 @@ void Supervisor::GuiRuntimeAndProcess( )
         this->run_demo = true;
         break;
     }
+    case GUI_LAST_EVENT_START_DEMO_SPECTRUM_SWEEP:
+    {
+        demo_manager->Start( DEMO_TYPE_SPECTRUM_SWEEP );
+        this->run_demo = true;
+        break;
+    }
     case GUI_LAST_EVENT_STOP_DEMO:
     {
         demo_manager->Stop( );
@@ -857,6 +879,11 @@ void Supervisor::DemoRuntimeAndProcess( )
         this->run_demo = false;
         this->TransfertDemoResultsToGui( );
         this->communication_manager->EventNotify( );
+        if( this->scheduler->IsScanOngoing( ) )
+        {
+            this->TransferScheduledScanResults( );
+        }
+        this->scheduler->ArmWakeUp( );
         break;
     }
     default:
@@ -866,6 +893,26 @@ void Supervisor::DemoRuntimeAndProcess( )
     }
 }
 
+void Supervisor::SchedulerRuntime( )
+{
+    if( this->run_demo == true )
+    {
+        return;
+    }
+
+    if( this->scheduler->IsScanOngoing( ) == true )
+    {
+        // The scheduled scan has been stopped before its termination
+        this->scheduler->ScanTerminated( false );
+    }
+    else if( this->scheduler->IsScanDue( ) == true )
+    {
+        this->demo_manager->Start( this->scheduler->GetDemoType( ) );
+        this->scheduler->ScanStarted( );
+        this->run_demo = true;
+    }
+}
+
 void Supervisor::CommunicationManagerRuntime( )
 {
     this->communication_manager->Runtime( );
@@ -929,6 +976,30 @@ void Supervisor::CommunicationManagerRuntime( )
             this->run_demo = true;
             break;
         }
+        case COMMAND_START_SPECTRUM_SWEEP_DEMO_EVENT:
+        {
+            demo_manager->Start( DEMO_TYPE_SPECTRUM_SWEEP );
+            this->run_demo = true;
+            break;
+        }
+        case COMMAND_START_CAD_SNIFFER_DEMO_EVENT:
+        {
+            demo_manager->Start( DEMO_TYPE_CAD_SNIFFER );
+            this->run_demo = true;
+            break;
+        }
+        case COMMAND_START_RX_DUTY_CYCLE_DEMO_EVENT:
+        {
+            demo_manager->Start( DEMO_TYPE_RADIO_RX_DUTY_CYCLE );
+            this->run_demo = true;
+            break;
+        }
+        case COMMAND_START_GEOLOCATION_DEMO_EVENT:
+        {
+            demo_manager->Start( DEMO_TYPE_GEOLOCATION );
+            this->run_demo = true;
+            break;
+        }
         case COMMAND_STOP_DEMO_EVENT:
         {
             this->demo_manager->Stop( );
@@ -941,6 +1012,17 @@ void Supervisor::CommunicationManagerRuntime( )
             this->run_demo = false;
             this->device->Init( );
             this->demo_manager->Reset( );
+            break;
+        }
+        case COMMAND_START_SCHEDULER_EVENT:
+        {
+            this->scheduler->Start( );
+            break;
+        }
+        case COMMAND_STOP_SCHEDULER_EVENT:
+        {
+            this->scheduler->Stop( );
+            break;
         }
         }
     }
@@ -1108,29 +1190,59 @@ void Supervisor::InterruptionRuntime( )
 bool Supervisor::CanEnterLowPower( ) const
 {
     bool can_enter_low_power = true;
-    // DemoInterface*                   running_demo        = NULL;
-    // DemoContainerSelectedType_t type                = DEMO_TYPE_NONE;
-    // type = this->demo_container.GetSelectedDemoAndType( running_demo );
-
-    // can_enter_low_power &= !Supervisor::is_demo_interrupt_raised;
-    // can_enter_low_power &= !this->gui->HasRefreshPending( );
-
-    // if( type != DEMO_TYPE_NONE )
-    // {
-    //     can_enter_low_power &= ( ( running_demo->IsStarted( ) &&
-    //                                running_demo->IsWaitingForInterrupt( )
-    //                                )
-    //                                ||
-    //                              ( !running_demo->IsStarted( ) ) );
-    // }
+
+    can_enter_low_power &= !Supervisor::is_demo_interrupt_raised;
+    can_enter_low_power &= !Supervisor::is_gui_interrupt_raised;
+    can_enter_low_power &= this->gui->IsIdle( );
+    can_enter_low_power &= !this->communication_manager->HasNewCommand( );
+    can_enter_low_power &= system_uart_is_tx_terminated( );
+
+    if( this->run_demo == true )
+    {
+        can_enter_low_power &= this->demo_manager->IsWaitingForInterrupt( );
+    }
+
     return can_enter_low_power;
 }
 
+system_lpm_mode_t Supervisor::GetLowPowerMode( ) const
+{
+    // USART2 is not clocked in STOP2, so stay in sleep mode as long as a host may send commands
+    switch( this->communication_manager->GetHostType( ) )
+    {
+    case COMMUNICATION_MANAGER_DEMO_HOST:
+    case COMMUNICATION_MANAGER_FIELD_TEST_HOST:
+    {
+        return SYSTEM_LPM_MODE_SLEEP;
+    }
+    default:
+    {
+        return SYSTEM_LPM_MODE_STOP2;
+    }
+    }
+}
+
 void Supervisor::EnterWaitForInterrupt( ) const
 {
-    while( !Supervisor::is_demo_interrupt_raised )
+    uint32_t gui_refresh_delay_ms = 0;
+
+    // The GUI refresh is throttled: wake up when it is due. This uses the LPTIM wake-up, leaving the alarm of the
+    // demo timer untouched
+    if( this->gui->GetRefreshDelay( &gui_refresh_delay_ms ) == true )
     {
+        system_lptim_set_wakeup( system_lptim_get_ticks( ) +
+                                 ( ( uint64_t ) SYSTEM_LPTIM_TICKS_PER_SECOND * gui_refresh_delay_ms ) / 1000 );
     }
+
+    __disable_irq( );
+    // An interrupt may have been raised since CanEnterLowPower was evaluated
+    if( ( Supervisor::is_demo_interrupt_raised == false ) && ( Supervisor::is_gui_interrupt_raised == false ) )
+    {
+        system_lpm_enter( this->GetLowPowerMode( ) );
+    }
+    __enable_irq( );
+
+    system_lptim_stop_wakeup( );
 }
 
 void Supervisor::TransfertDemoResultsToGui( )
@@ -1161,6 +1273,15 @@ void Supervisor::TransfertDemoResultsToGui( )
         this->TransferResultToGui( ( demo_radio_per_results_t* ) demo_manager->GetResults( ) );
         break;
 
+    case DEMO_TYPE_SPECTRUM_SWEEP:
+        this->TransferResultToGui( ( demo_spectrum_sweep_results_t* ) demo_manager->GetResults( ) );
+        break;
+
+    case DEMO_TYPE_CAD_SNIFFER:
+    case DEMO_TYPE_RADIO_RX_DUTY_CYCLE:
+        // These demos have no dedicated page, their statistics are fetched over the HCI
+        break;
+
     case DEMO_TYPE_TEMPERATURE:
         this->TransferResultToGui( ( demo_modem_temperature_results_t* ) demo_manager->GetResults( ) );
         break;
@@ -1169,6 +1290,10 @@ void Supervisor::TransfertDemoResultsToGui( )
         this->TransferResultToGui( ( demo_modem_file_upload_results_t* ) demo_manager->GetResults( ) );
         break;
 
+    case DEMO_TYPE_GEOLOCATION:
+        this->TransferGeolocationResults( ( demo_geolocation_results_t* ) demo_manager->GetResults( ) );
+        break;
+
     default:
         this->communication_manager->Log( "Error: unknown demo type in result handling: 0x%x\n", demo_type );
     }
@@ -1277,10 +1402,32 @@ void Supervisor::TransferResultToGui( const demo_radio_per_results_t* result )
     guiResult.count_rx_correct_packet = result->count_rx_correct_packet;
     guiResult.count_rx_timeout        = result->count_rx_timeout;
     guiResult.count_rx_wrong_packet   = result->count_rx_wrong_packet;
+    guiResult.rx_rate_instant_pps     = result->rx_rate_instant_pps;
+    guiResult.rx_rate_average_pps     = result->rx_rate_average_pps;
 
     this->gui->UpdateRadioPerResult( guiResult );
 }
 
+void Supervisor::TransferResultToGui( const demo_spectrum_sweep_results_t* result )
+{
+    GuiSpectrumSweepResult_t guiResult;
+
+    guiResult.start_frequency_hz = result->start_frequency_hz;
+    guiResult.step_frequency_hz  = result->step_frequency_hz;
+    guiResult.nb_channels        = result->nb_channels;
+    guiResult.nb_sweeps          = result->nb_sweeps;
+
+    for( uint8_t channel = 0; ( channel < result->nb_channels ) && ( channel < GUI_SPECTRUM_SWEEP_MAX_CHANNELS );
+         channel++ )
+    {
+        guiResult.rssi_min[channel]  = result->channels[channel].rssi_min;
+        guiResult.rssi_max[channel]  = result->channels[channel].rssi_max;
+        guiResult.rssi_mean[channel] = result->channels[channel].rssi_mean;
+    }
+
+    this->gui->UpdateSpectrumSweepResult( guiResult );
+}
+
 void Supervisor::TransferResultToGui( const demo_modem_temperature_results_t* result )
 {
     GuiTemperatureResult_t guiResult = {};
@@ -1386,6 +1533,118 @@ void Supervisor::TransferResultToSerial( const demo_gnss_all_results_t* result )
     this->communication_manager->Store( *result, delay_capture_s );
 }
 
+void Supervisor::TransferGeolocationResults( const demo_geolocation_results_t* result )
+{
+    const uint8_t sinks = ( this->scheduler->IsScanOngoing( ) == true ) ? this->scheduler->GetSinks( )
+                                                                         : DEMO_SCHEDULER_SINK_ALL;
+    const bool    is_serial_sink  = ( sinks & DEMO_SCHEDULER_SINK_SERIAL ) != 0;
+    const bool    is_lorawan_sink = ( sinks & DEMO_SCHEDULER_SINK_LORAWAN ) != 0;
+
+    // Each step is handled as soon as it completes, so the Wi-Fi results are stored and sent while the GNSS capture
+    // is running
+    switch( result->last_completed_step )
+    {
+    case DEMO_GEOLOCATION_STEP_WIFI:
+    {
+        this->TransferResultToGui( result->wifi_results );
+        if( is_serial_sink == true )
+        {
+            this->communication_manager->EraseDataStored( );
+            this->communication_manager->Store( this->version_handler );
+            this->TransferResultToSerial( result->wifi_results );
+        }
+        if( is_lorawan_sink == true )
+        {
+            this->TransferResultToConnectivity( result->wifi_results );
+        }
+        break;
+    }
+    case DEMO_GEOLOCATION_STEP_GNSS:
+    {
+        this->TransferResultToGui( result->gnss_results );
+        if( is_serial_sink == true )
+        {
+            this->TransferResultToSerial( result->gnss_results );
+            this->communication_manager->SendDataStoredToServer( );
+        }
+        if( is_lorawan_sink == true )
+        {
+            this->TransferResultToConnectivity( result->gnss_results );
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void Supervisor::TransferResultToSinks( const demo_wifi_scan_all_results_t* result, const uint8_t sinks )
+{
+    if( ( sinks & DEMO_SCHEDULER_SINK_SERIAL ) != 0 )
+    {
+        this->communication_manager->EraseDataStored( );
+        this->communication_manager->Store( this->version_handler );
+        this->TransferResultToSerial( result );
+        this->communication_manager->SendDataStoredToServer( );
+    }
+    if( ( sinks & DEMO_SCHEDULER_SINK_LORAWAN ) != 0 )
+    {
+        this->TransferResultToConnectivity( result );
+    }
+}
+
+void Supervisor::TransferResultToSinks( const demo_gnss_all_results_t* result, const uint8_t sinks )
+{
+    if( ( sinks & DEMO_SCHEDULER_SINK_SERIAL ) != 0 )
+    {
+        this->communication_manager->EraseDataStored( );
+        this->communication_manager->Store( this->version_handler );
+        this->TransferResultToSerial( result );
+        this->communication_manager->SendDataStoredToServer( );
+    }
+    if( ( sinks & DEMO_SCHEDULER_SINK_LORAWAN ) != 0 )
+    {
+        this->TransferResultToConnectivity( result );
+    }
+}
+
+void Supervisor::TransferScheduledScanResults( )
+{
+    const uint8_t sinks       = this->scheduler->GetSinks( );
+    bool          has_results = false;
+
+    switch( this->demo_manager->GetType( ) )
+    {
+    case DEMO_TYPE_WIFI:
+    case DEMO_TYPE_WIFI_COUNTRY_CODE:
+    {
+        const demo_wifi_scan_all_results_t* results = ( demo_wifi_scan_all_results_t* ) demo_manager->GetResults( );
+        has_results                                 = ( results->nbrResults != 0 );
+        this->TransferResultToSinks( results, sinks );
+        break;
+    }
+    case DEMO_TYPE_GNSS_AUTONOMOUS:
+    case DEMO_TYPE_GNSS_ASSISTED:
+    {
+        const demo_gnss_all_results_t* results = ( demo_gnss_all_results_t* ) demo_manager->GetResults( );
+        has_results = ( results->error == DEMO_GNSS_BASE_NO_ERROR ) && ( results->nb_result != 0 );
+        this->TransferResultToSinks( results, sinks );
+        break;
+    }
+    case DEMO_TYPE_GEOLOCATION:
+    {
+        // The results of each step have already been sent while the demo was running
+        const demo_geolocation_results_t* results = ( demo_geolocation_results_t* ) demo_manager->GetResults( );
+        has_results = ( results->wifi_results->nbrResults != 0 ) || ( results->gnss_results->nb_result != 0 );
+        break;
+    }
+    default:
+        break;
+    }
+
+    this->scheduler->ScanTerminated( has_results );
+}
+
 bool Supervisor::HasPendingInterrupt( ) const { return Supervisor::is_demo_interrupt_raised; }
 
 const version_handler_t* Supervisor::GetVersionHandler( ) const { return &this->version_handler; }
@@ -43,6 +43,7 @@ extern "C" {
 #include "system_i2c.h"
 #include "system_time.h"
 #include "system_lptim.h"
+#include "system_lpm.h"
 
 void system_init( void );
 
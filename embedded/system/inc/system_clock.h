@@ -37,6 +37,7 @@ extern "C" {
 #endif
 
 void system_clock_init( void );
+void system_clock_restore_after_stop( void );
 
 #ifdef __cplusplus
 }
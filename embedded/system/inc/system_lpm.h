@@ -0,0 +1,75 @@
+/**
+ * @file      system_lpm.h
+ *
+ * @brief     MCU low-power mode related functions header
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SYSTEM_LPM_H__
+#define __SYSTEM_LPM_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum
+{
+    SYSTEM_LPM_MODE_RUN,
+    SYSTEM_LPM_MODE_SLEEP,
+    SYSTEM_LPM_MODE_STOP2,
+    SYSTEM_LPM_MODE_COUNT,
+} system_lpm_mode_t;
+
+typedef enum
+{
+    SYSTEM_LPM_WAKEUP_SOURCE_LPTIM,
+    SYSTEM_LPM_WAKEUP_SOURCE_RADIO,
+    SYSTEM_LPM_WAKEUP_SOURCE_TOUCH,
+    SYSTEM_LPM_WAKEUP_SOURCE_UART,
+    SYSTEM_LPM_WAKEUP_SOURCE_OTHER,
+    SYSTEM_LPM_WAKEUP_SOURCE_COUNT,
+} system_lpm_wakeup_source_t;
+
+typedef struct
+{
+    uint64_t time_in_mode_ms[SYSTEM_LPM_MODE_COUNT];
+    uint32_t entry_count[SYSTEM_LPM_MODE_COUNT];
+    uint32_t wakeup_count[SYSTEM_LPM_WAKEUP_SOURCE_COUNT];
+} system_lpm_statistics_t;
+
+void system_lpm_init( void );
+void system_lpm_enter( system_lpm_mode_t mode );
+void system_lpm_get_statistics( system_lpm_statistics_t* statistics );
+void system_lpm_reset_statistics( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // __SYSTEM_LPM_H__
@@ -33,14 +33,25 @@
 #define __SYSTEM_LPTIM_H__
 
 #include "stdint.h"
+#include <stdbool.h>
 #include "stm32l4xx_ll_lptim.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-void system_lptim_init( );
-void system_lptim_set_and_run( uint32_t ticks );
+// LPTIM1 runs continuously from the LSE, the 16-bit counter is extended to 64 bits on each autoreload match
+#define SYSTEM_LPTIM_TICKS_PER_SECOND ( 32768 )
+
+void     system_lptim_init( );
+uint64_t system_lptim_get_ticks( void );
+void     system_lptim_set_alarm( uint64_t ticks );
+void     system_lptim_stop_alarm( void );
+// Wake-up independent of the alarm, that only brings the core out of low power at the given instant
+void     system_lptim_set_wakeup( uint64_t ticks );
+void     system_lptim_stop_wakeup( void );
+void     system_lptim_overflow_callback( void );
+bool     system_lptim_alarm_callback( void );
 
 #ifdef __cplusplus
 }
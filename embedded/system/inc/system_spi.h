@@ -49,6 +49,13 @@ void system_spi_read( SPI_TypeDef* spi, uint8_t* buffer, uint16_t length );
 void system_spi_write_read( SPI_TypeDef* spi, const uint8_t* cbuffer, uint8_t* rbuffer, uint16_t length );
 void system_spi_read_with_dummy_byte( SPI_TypeDef* spi, uint8_t* buffer, uint16_t length, uint8_t dummy_byte );
 
+/*!
+ * @brief Write 16-bit words, most significant byte first, in 16-bit frames
+ *
+ * The SPI is switched to 16-bit frames for the transfer and back to 8-bit frames afterwards.
+ */
+void system_spi_write_16bit( SPI_TypeDef* spi, const uint16_t* buffer, uint32_t length );
+
 #ifdef __cplusplus
 }
 #endif
@@ -40,7 +40,8 @@ extern "C" {
 
 void     system_time_init( void );
 void     system_time_wait_ms( uint32_t time_in_ms );
-void     system_time_IncreaseTicker( void );
+uint64_t system_time_get_ms( void );
+uint64_t system_time_get_us( void );
 uint32_t system_time_GetTicker( void );
 
 #ifdef __cplusplus
@@ -40,4 +40,5 @@ void system_init( void )
     system_time_init( );
     system_uart_init( );
     system_lptim_init( );
+    system_lpm_init( );
 }
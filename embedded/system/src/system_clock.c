@@ -35,6 +35,9 @@
 #include "stm32l4xx_ll_system.h"
 #include "stm32l4xx_ll_utils.h"
 #include "stm32l4xx_ll_bus.h"
+#include "system_clock.h"
+
+static void system_clock_start_pll( void );
 
 void system_clock_init( void )
 {
@@ -70,15 +73,7 @@ void system_clock_init( void )
     LL_RCC_PLL_ConfigDomain_48M( LL_RCC_PLLSOURCE_HSI, LL_RCC_PLLM_DIV_1, 10, LL_RCC_PLLQ_DIV_4 );
     LL_RCC_PLL_EnableDomain_48M( );
     LL_RCC_PLL_EnableDomain_SYS( );
-    LL_RCC_PLL_Enable( );
-    while( LL_RCC_PLL_IsReady( ) != 1 )
-    {
-    }
-
-    LL_RCC_SetSysClkSource( LL_RCC_SYS_CLKSOURCE_PLL );
-    while( LL_RCC_GetSysClkSource( ) != LL_RCC_SYS_CLKSOURCE_STATUS_PLL )
-    {
-    }
+    system_clock_start_pll( );
 
     LL_RCC_SetAHBPrescaler( LL_RCC_SYSCLK_DIV_1 );
     LL_RCC_SetAPB1Prescaler( LL_RCC_APB1_DIV_1 );
@@ -92,3 +87,23 @@ void system_clock_init( void )
     LL_RCC_SetRNGClockSource( LL_RCC_RNG_CLKSOURCE_PLL );
     LL_RCC_SetLPTIMClockSource( LL_RCC_LPTIM1_CLKSOURCE_LSE );
 }
+
+void system_clock_restore_after_stop( void )
+{
+    // The MCU wakes up from STOP2 on HSI16 with the PLL off. The PLL configuration is retained, so it only has to be
+    // restarted and selected again as system clock
+    system_clock_start_pll( );
+}
+
+static void system_clock_start_pll( void )
+{
+    LL_RCC_PLL_Enable( );
+    while( LL_RCC_PLL_IsReady( ) != 1 )
+    {
+    }
+
+    LL_RCC_SetSysClkSource( LL_RCC_SYS_CLKSOURCE_PLL );
+    while( LL_RCC_GetSysClkSource( ) != LL_RCC_SYS_CLKSOURCE_STATUS_PLL )
+    {
+    }
+}
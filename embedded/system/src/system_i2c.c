@@ -105,5 +105,11 @@ void system_i2c_read( const uint8_t address, uint8_t* buffer_out, const uint8_t
         }
     }
 
+    /* The last byte of a burst may still be pending when the STOP flag is raised */
+    if( ( i < length ) && LL_I2C_IsActiveFlag_RXNE( I2C1 ) )
+    {
+        buffer_out[i++] = LL_I2C_ReceiveData8( I2C1 );
+    }
+
     LL_I2C_ClearFlag_STOP( I2C1 );
 }
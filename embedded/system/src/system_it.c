@@ -37,11 +37,11 @@
 #include "system_time.h"
 #include "system_lptim.h"
 #include "system_uart.h"
+#include "touch.h"
 
 extern void SupervisorInterruptHandlerGui( bool is_down );
 extern void SupervisorInterruptHandlerDemo( void );
 extern void TimerHasElapsed( void );
-extern void lv_tick_inc( uint32_t );
 
 /**
  * @brief  This function handles NMI exception.
@@ -128,11 +128,7 @@ void PendSV_Handler( void ) {}
  * @param  None
  * @retval None
  */
-void SysTick_Handler( void )
-{
-    system_time_IncreaseTicker( );
-    lv_tick_inc( 1 );
-}
+void SysTick_Handler( void ) {}
 
 /******************************************************************************/
 /*                 STM32L4xx Peripherals Interrupt Handlers                   */
@@ -165,6 +161,7 @@ void EXTI15_10_IRQHandler( void )
 
         LL_EXTI_ClearFlag_0_31( LL_EXTI_LINE_10 );
         is_down = !LL_GPIO_IsInputPinSet( TOUCH_IRQ_PORT, TOUCH_IRQ_PIN );
+        touch_interrupt_handler( );
         SupervisorInterruptHandlerGui( is_down );
     }
 }
@@ -220,6 +217,18 @@ void LPTIM1_IRQHandler( void )
         /* Clear the Autoreload match interrupt flag */
         LL_LPTIM_ClearFLAG_ARRM( LPTIM1 );
 
+        system_lptim_overflow_callback( );
+    }
+
+    /* Check whether Compare match interrupt is pending */
+    if( LL_LPTIM_IsActiveFlag_CMPM( LPTIM1 ) == 1 )
+    {
+        /* Clear the Compare match interrupt flag */
+        LL_LPTIM_ClearFLAG_CMPM( LPTIM1 );
+    }
+
+    if( system_lptim_alarm_callback( ) == true )
+    {
         TimerHasElapsed( );
     }
 }
@@ -0,0 +1,163 @@
+/**
+ * @file      system_lpm.c
+ *
+ * @brief     MCU low-power mode related functions implementation.
+ *
+ * Revised BSD License
+ * Copyright Semtech Corporation 2020. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Semtech corporation nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "system_lpm.h"
+#include "system_clock.h"
+#include "system_lptim.h"
+#include "stm32l4xx_ll_bus.h"
+#include "stm32l4xx_ll_cortex.h"
+#include "stm32l4xx_ll_exti.h"
+#include "stm32l4xx_ll_pwr.h"
+#include "stm32l4xx_ll_rcc.h"
+
+static uint64_t reset_instant_ticks                          = 0;
+static uint64_t time_in_mode_ticks[SYSTEM_LPM_MODE_COUNT]    = { 0 };
+static uint32_t entry_count[SYSTEM_LPM_MODE_COUNT]           = { 0 };
+static uint32_t wakeup_count[SYSTEM_LPM_WAKEUP_SOURCE_COUNT] = { 0 };
+
+static system_lpm_wakeup_source_t system_lpm_get_pending_wakeup_source( void );
+static uint64_t                   system_lpm_ticks_to_ms( uint64_t ticks );
+
+void system_lpm_init( void )
+{
+    LL_APB1_GRP1_EnableClock( LL_APB1_GRP1_PERIPH_PWR );
+
+    // Restart on HSI16 so that the PLL can be re-enabled right away on wake-up
+    LL_RCC_SetClkAfterWakeFromStop( LL_RCC_STOP_WAKEUPCLOCK_HSI );
+    LL_PWR_SetPowerMode( LL_PWR_MODE_STOP2 );
+
+    // LPTIM1 reaches the NVIC through EXTI line 32 when the core is in STOP2
+    LL_EXTI_EnableIT_32_63( LL_EXTI_LINE_32 );
+
+    system_lpm_reset_statistics( );
+}
+
+void system_lpm_enter( system_lpm_mode_t mode )
+{
+    // Must be called with interrupts masked: the pending interrupt still wakes the core up but its handler only runs
+    // once the caller unmasks interrupts, after the clocks have been restored and the wake-up source recorded
+    const uint64_t start_ticks = system_lptim_get_ticks( );
+
+    switch( mode )
+    {
+    case SYSTEM_LPM_MODE_SLEEP:
+    {
+        LL_LPM_EnableSleep( );
+        __DSB( );
+        __WFI( );
+        break;
+    }
+    case SYSTEM_LPM_MODE_STOP2:
+    {
+        LL_LPM_EnableDeepSleep( );
+        __DSB( );
+        __WFI( );
+        LL_LPM_EnableSleep( );
+        system_clock_restore_after_stop( );
+        break;
+    }
+    default:
+    {
+        return;
+    }
+    }
+
+    time_in_mode_ticks[mode] += system_lptim_get_ticks( ) - start_ticks;
+    entry_count[mode]++;
+    wakeup_count[system_lpm_get_pending_wakeup_source( )]++;
+}
+
+void system_lpm_get_statistics( system_lpm_statistics_t* statistics )
+{
+    uint64_t time_in_low_power_ticks = 0;
+
+    __disable_irq( );
+    const uint64_t elapsed_ticks = system_lptim_get_ticks( ) - reset_instant_ticks;
+    for( uint8_t mode = SYSTEM_LPM_MODE_SLEEP; mode < SYSTEM_LPM_MODE_COUNT; mode++ )
+    {
+        statistics->time_in_mode_ms[mode] = system_lpm_ticks_to_ms( time_in_mode_ticks[mode] );
+        statistics->entry_count[mode]     = entry_count[mode];
+        time_in_low_power_ticks += time_in_mode_ticks[mode];
+    }
+    for( uint8_t source = 0; source < SYSTEM_LPM_WAKEUP_SOURCE_COUNT; source++ )
+    {
+        statistics->wakeup_count[source] = wakeup_count[source];
+    }
+    __enable_irq( );
+
+    // The run mode is entered once per wake-up, its duration is whatever was not spent in a low-power mode
+    statistics->time_in_mode_ms[SYSTEM_LPM_MODE_RUN] =
+        system_lpm_ticks_to_ms( elapsed_ticks - time_in_low_power_ticks );
+    statistics->entry_count[SYSTEM_LPM_MODE_RUN] =
+        statistics->entry_count[SYSTEM_LPM_MODE_SLEEP] + statistics->entry_count[SYSTEM_LPM_MODE_STOP2];
+}
+
+void system_lpm_reset_statistics( void )
+{
+    __disable_irq( );
+    reset_instant_ticks = system_lptim_get_ticks( );
+    for( uint8_t mode = 0; mode < SYSTEM_LPM_MODE_COUNT; mode++ )
+    {
+        time_in_mode_ticks[mode] = 0;
+        entry_count[mode]        = 0;
+    }
+    for( uint8_t source = 0; source < SYSTEM_LPM_WAKEUP_SOURCE_COUNT; source++ )
+    {
+        wakeup_count[source] = 0;
+    }
+    __enable_irq( );
+}
+
+static system_lpm_wakeup_source_t system_lpm_get_pending_wakeup_source( void )
+{
+    if( NVIC_GetPendingIRQ( EXTI4_IRQn ) != 0 )
+    {
+        return SYSTEM_LPM_WAKEUP_SOURCE_RADIO;
+    }
+    else if( NVIC_GetPendingIRQ( EXTI15_10_IRQn ) != 0 )
+    {
+        return SYSTEM_LPM_WAKEUP_SOURCE_TOUCH;
+    }
+    else if( ( NVIC_GetPendingIRQ( DMA1_Channel6_IRQn ) != 0 ) || ( NVIC_GetPendingIRQ( DMA1_Channel7_IRQn ) != 0 ) )
+    {
+        return SYSTEM_LPM_WAKEUP_SOURCE_UART;
+    }
+    else if( NVIC_GetPendingIRQ( LPTIM1_IRQn ) != 0 )
+    {
+        return SYSTEM_LPM_WAKEUP_SOURCE_LPTIM;
+    }
+    else
+    {
+        return SYSTEM_LPM_WAKEUP_SOURCE_OTHER;
+    }
+}
+
+static uint64_t system_lpm_ticks_to_ms( uint64_t ticks ) { return ( ticks * 1000 ) / SYSTEM_LPTIM_TICKS_PER_SECOND; }
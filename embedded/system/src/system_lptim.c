@@ -32,6 +32,18 @@
 #include "system_lptim.h"
 #include "stm32l4xx_ll_bus.h"
 
+#define SYSTEM_LPTIM_COUNTER_MASK ( 0xFFFF )
+
+static volatile uint32_t overflow_count  = 0;
+static volatile bool     is_alarm_armed  = false;
+static volatile uint64_t alarm_ticks     = 0;
+static volatile bool     is_wakeup_armed = false;
+static volatile uint64_t wakeup_ticks    = 0;
+
+static void     system_lptim_arm_compare( void );
+static uint32_t system_lptim_read_counter( void );
+static void     system_lptim_write_compare( uint32_t compare );
+
 void system_lptim_init( )
 {
     LL_APB1_GRP1_EnableClock( LL_APB1_GRP1_PERIPH_LPTIM1 );
@@ -40,7 +52,7 @@ void system_lptim_init( )
     NVIC_EnableIRQ( LPTIM1_IRQn );
 
     LL_LPTIM_SetClockSource( LPTIM1, LL_LPTIM_CLK_SOURCE_INTERNAL );
-    LL_LPTIM_SetPrescaler( LPTIM1, LL_LPTIM_PRESCALER_DIV16 );
+    LL_LPTIM_SetPrescaler( LPTIM1, LL_LPTIM_PRESCALER_DIV1 );
     LL_LPTIM_SetPolarity( LPTIM1, LL_LPTIM_OUTPUT_POLARITY_REGULAR );
     LL_LPTIM_SetUpdateMode( LPTIM1, LL_LPTIM_UPDATE_MODE_IMMEDIATE );
     LL_LPTIM_SetCounterMode( LPTIM1, LL_LPTIM_COUNTER_MODE_INTERNAL );
@@ -55,11 +67,167 @@ void system_lptim_init( )
     }
 
     LL_LPTIM_ClearFLAG_ARRM( LPTIM1 );
+    LL_LPTIM_ClearFLAG_CMPM( LPTIM1 );
     LL_LPTIM_EnableIT_ARRM( LPTIM1 );
+    LL_LPTIM_EnableIT_CMPM( LPTIM1 );
+
+    LL_LPTIM_SetAutoReload( LPTIM1, SYSTEM_LPTIM_COUNTER_MASK );
+    LL_LPTIM_StartCounter( LPTIM1, LL_LPTIM_OPERATING_MODE_CONTINUOUS );
+}
+
+uint64_t system_lptim_get_ticks( void )
+{
+    uint32_t overflows_before = 0;
+    uint32_t overflows_after  = 0;
+    uint32_t counter          = 0;
+
+    do
+    {
+        overflows_before = overflow_count;
+        // The autoreload match is raised while the counter still holds 0xFFFF, so the counter is shifted by one tick
+        // to make the rollover coincide with the overflow accounting
+        counter         = ( system_lptim_read_counter( ) + 1 ) & SYSTEM_LPTIM_COUNTER_MASK;
+        overflows_after = overflow_count;
+    } while( overflows_before != overflows_after );
+
+    // Account for an overflow that has not been serviced yet, typically when called with interrupts masked
+    if( ( LL_LPTIM_IsActiveFlag_ARRM( LPTIM1 ) == 1 ) && ( counter < ( SYSTEM_LPTIM_COUNTER_MASK / 2 ) ) )
+    {
+        overflows_after++;
+    }
+
+    return ( ( uint64_t ) overflows_after << 16 ) | counter;
+}
+
+void system_lptim_set_alarm( uint64_t ticks )
+{
+    alarm_ticks    = ticks;
+    is_alarm_armed = true;
+    system_lptim_arm_compare( );
+}
+
+void system_lptim_stop_alarm( void )
+{
+    is_alarm_armed = false;
+
+    // The compare register may hold the alarm deadline, move it to the wake-up one
+    if( is_wakeup_armed == true )
+    {
+        system_lptim_arm_compare( );
+    }
+}
+
+void system_lptim_set_wakeup( uint64_t ticks )
+{
+    wakeup_ticks    = ticks;
+    is_wakeup_armed = true;
+    system_lptim_arm_compare( );
+}
+
+void system_lptim_stop_wakeup( void )
+{
+    is_wakeup_armed = false;
+
+    // The compare register may hold the wake-up deadline, move it to the alarm one
+    if( is_alarm_armed == true )
+    {
+        system_lptim_arm_compare( );
+    }
+}
+
+void system_lptim_overflow_callback( void ) { overflow_count++; }
+
+bool system_lptim_alarm_callback( void )
+{
+    const uint64_t now_ticks     = system_lptim_get_ticks( );
+    bool           has_expired   = false;
+    bool           alarm_elapsed = false;
+
+    // The wake-up has no handler: the interrupt has already brought the core out of low power
+    if( ( is_wakeup_armed == true ) && ( now_ticks >= wakeup_ticks ) )
+    {
+        is_wakeup_armed = false;
+        has_expired     = true;
+    }
+
+    if( ( is_alarm_armed == true ) && ( now_ticks >= alarm_ticks ) )
+    {
+        is_alarm_armed = false;
+        has_expired    = true;
+        alarm_elapsed  = true;
+    }
+
+    // The compare register only holds the earliest deadline, move it to the one still armed
+    if( has_expired == true )
+    {
+        system_lptim_arm_compare( );
+    }
+
+    return alarm_elapsed;
+}
+
+static void system_lptim_arm_compare( void )
+{
+    uint64_t ticks = 0;
+
+    if( ( is_alarm_armed == true ) && ( ( is_wakeup_armed == false ) || ( alarm_ticks <= wakeup_ticks ) ) )
+    {
+        ticks = alarm_ticks;
+    }
+    else if( is_wakeup_armed == true )
+    {
+        ticks = wakeup_ticks;
+    }
+    else
+    {
+        return;
+    }
+
+    if( ticks <= ( system_lptim_get_ticks( ) + 1 ) )
+    {
+        // Too close to be caught by the compare match: let the interrupt handler expire it right away
+        NVIC_SetPendingIRQ( LPTIM1_IRQn );
+    }
+    else
+    {
+        const uint32_t compare = ( uint32_t )( ticks - 1 ) & SYSTEM_LPTIM_COUNTER_MASK;
+
+        // A compare value of 0xFFFF coincides with the autoreload match which already checks the alarm
+        if( compare != SYSTEM_LPTIM_COUNTER_MASK )
+        {
+            system_lptim_write_compare( compare );
+
+            // The counter keeps running until the compare register write completes: if it has gone past the
+            // compare value meanwhile, the match is missed and would only happen again one counter period later
+            if( ticks <= ( system_lptim_get_ticks( ) + 1 ) )
+            {
+                NVIC_SetPendingIRQ( LPTIM1_IRQn );
+            }
+        }
+    }
+}
+
+static uint32_t system_lptim_read_counter( void )
+{
+    uint32_t counter      = LL_LPTIM_GetCounter( LPTIM1 );
+    uint32_t counter_prev = 0;
+
+    // The counter runs asynchronously to the APB clock: it is only reliable once two consecutive reads match
+    do
+    {
+        counter_prev = counter;
+        counter      = LL_LPTIM_GetCounter( LPTIM1 );
+    } while( counter != counter_prev );
+
+    return counter;
 }
 
-void system_lptim_set_and_run( uint32_t ticks )
+static void system_lptim_write_compare( uint32_t compare )
 {
-    LL_LPTIM_SetAutoReload( LPTIM1, ticks );
-    LL_LPTIM_StartCounter( LPTIM1, LL_LPTIM_OPERATING_MODE_ONESHOT );
-}
\ No newline at end of file
+    LL_LPTIM_ClearFlag_CMPOK( LPTIM1 );
+    LL_LPTIM_SetCompare( LPTIM1, compare );
+
+    while( LL_LPTIM_IsActiveFlag_CMPOK( LPTIM1 ) != 1 )
+    {
+    }
+}
@@ -31,6 +31,8 @@
 
 #include "system_spi.h"
 
+static void system_spi_set_data_width( SPI_TypeDef* spi, uint32_t data_width, uint32_t rx_fifo_threshold );
+
 void system_spi_init( void )
 {
     LL_SPI_InitTypeDef  SPI_InitStruct  = { 0 };
@@ -134,3 +136,50 @@ void system_spi_read_with_dummy_byte( SPI_TypeDef* spi, uint8_t* buffer, uint16_
         buffer[i] = LL_SPI_ReceiveData8( spi );
     }
 }
+
+void system_spi_write_16bit( SPI_TypeDef* spi, const uint16_t* buffer, uint32_t length )
+{
+    if( length == 0 )
+    {
+        return;
+    }
+
+    system_spi_set_data_width( spi, LL_SPI_DATAWIDTH_16BIT, LL_SPI_RX_FIFO_TH_HALF );
+
+    // Keep one frame queued ahead of the one being shifted out, the RX FIFO holds the two received frames
+    LL_SPI_TransmitData16( spi, buffer[0] );
+    for( uint32_t i = 1; i < length; i++ )
+    {
+        while( LL_SPI_IsActiveFlag_TXE( spi ) == 0 )
+        {
+        };
+
+        LL_SPI_TransmitData16( spi, buffer[i] );
+
+        while( LL_SPI_IsActiveFlag_RXNE( spi ) == 0 )
+        {
+        };
+
+        LL_SPI_ReceiveData16( spi );
+    }
+
+    while( LL_SPI_IsActiveFlag_RXNE( spi ) == 0 )
+    {
+    };
+
+    LL_SPI_ReceiveData16( spi );
+
+    system_spi_set_data_width( spi, LL_SPI_DATAWIDTH_8BIT, LL_SPI_RX_FIFO_TH_QUARTER );
+}
+
+static void system_spi_set_data_width( SPI_TypeDef* spi, uint32_t data_width, uint32_t rx_fifo_threshold )
+{
+    while( LL_SPI_IsActiveFlag_BSY( spi ) != 0 )
+    {
+    };
+
+    LL_SPI_Disable( spi );
+    LL_SPI_SetDataWidth( spi, data_width );
+    LL_SPI_SetRxFIFOThreshold( spi, rx_fifo_threshold );
+    LL_SPI_Enable( spi );
+}
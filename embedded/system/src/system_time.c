@@ -30,15 +30,17 @@
  */
 
 #include "system_time.h"
+#include "system_lptim.h"
 #include "stm32l4xx_ll_cortex.h"
 #include "stm32l4xx_ll_utils.h"
 
-volatile static uint32_t ticker = 0;
-
-void system_time_init( void ) { LL_SYSTICK_EnableIT( ); }
+// The time base is derived from the free-running LPTIM1 counter, so no periodic interrupt is needed to keep time
+void system_time_init( void ) { LL_SYSTICK_DisableIT( ); }
 
 void system_time_wait_ms( uint32_t time_in_ms ) { LL_mDelay( time_in_ms ); }
 
-void system_time_IncreaseTicker( void ) { ticker++; }
+uint64_t system_time_get_ms( void ) { return ( system_lptim_get_ticks( ) * 1000 ) / SYSTEM_LPTIM_TICKS_PER_SECOND; }
+
+uint64_t system_time_get_us( void ) { return ( system_lptim_get_ticks( ) * 1000000 ) / SYSTEM_LPTIM_TICKS_PER_SECOND; }
 
-uint32_t system_time_GetTicker( void ) { return ticker; }
+uint32_t system_time_GetTicker( void ) { return ( uint32_t ) system_time_get_ms( ); }
@@ -48,6 +48,8 @@ class Job:
     WIFI_TIMEOUT_KEY = "wifi_timeout"
     WIFI_MODE_KEY = "wifi_mode"
     WIFI_ABORT_ON_TIMEOUT_KEY = "wifi_abort_on_timeout"
+    WIFI_ADAPTIVE_CHANNEL_MASK_KEY = "wifi_adaptive_channel_mask"
+    WIFI_SEARCH_COUNTRY_CODE_KEY = "wifi_search_country_code"
     GNSS_AUTONOMOUS_ENABLE_KEY = "gnss_autonomous_enable"
     GNSS_AUTONOMOUS_OPTION_KEY = "gnss_autonomous_option"
     GNSS_AUTONOMOUS_CAPTURE_MODE_KEY = "gnss_autonomous_capture_mode"
@@ -85,6 +87,8 @@ class Job:
         self.wifi_timeout = 0
         self.wifi_mode = WifiMode.beacon_only
         self.wifi_abort_on_timeout = False
+        self.wifi_adaptive_channel_mask = False
+        self.wifi_search_country_code = False
         self.gnss_autonomous_enable = gnss_autonomous_enable
         self.gnss_autonomous_option = GnssOption.default
         self.gnss_autonomous_capture_mode = GnssCaptureMode.mode_0_legacy
@@ -173,6 +177,12 @@ class Job:
             Job.WIFI_ABORT_ON_TIMEOUT_KEY: lambda obj, value: setattr(
                 obj, "wifi_abort_on_timeout", value
             ),
+            Job.WIFI_ADAPTIVE_CHANNEL_MASK_KEY: lambda obj, value: setattr(
+                obj, "wifi_adaptive_channel_mask", value
+            ),
+            Job.WIFI_SEARCH_COUNTRY_CODE_KEY: lambda obj, value: setattr(
+                obj, "wifi_search_country_code", value
+            ),
             Job.GNSS_AUTONOMOUS_OPTION_KEY: lambda obj, value: Job.SetGnssAutonomousOptionFromJobDict(
                 obj, value
             ),
@@ -295,6 +295,10 @@ class JobExecutor:
                 start_command.wifi_timeout = job.wifi_timeout
                 start_command.wifi_mode = job.wifi_mode
                 start_command.wifi_abort_on_timeout = job.wifi_abort_on_timeout
+                start_command.wifi_adaptive_channel_mask = (
+                    job.wifi_adaptive_channel_mask
+                )
+                start_command.wifi_search_country_code = job.wifi_search_country_code
                 return start_command
             elif job.wifi_enable_mode == WifiEnableMode.country_code:
                 start_command = CommandStartWifiCountryCode()
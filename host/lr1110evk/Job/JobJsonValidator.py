@@ -68,7 +68,7 @@ class WifiApiField(StringField):
 class WifiModeField(StringField):
     def __init__(self, *args, **kwargs):
         super(WifiModeField, self).__init__(
-            pattern="^(beacon_and_packet|beacon_only)$",
+            pattern="^(beacon_and_packet|beacon_only|full_beacon_with_ssid)$",
             description="The Acquisition Mode to configure for passive scan operations.",
         )
 
@@ -140,6 +140,12 @@ class WifiJobDocument(CommonJobDocument):
         description="Enable or disable the Wi-Fi abort on timeout. If set to True, the Wi-Fi scan will jump to next channel as soon as a preamble timeout is reached.",
         required=True,
     )
+    wifi_adaptive_channel_mask = BooleanField(
+        description="Enable or disable the adaptive Wi-Fi channel mask. If set to True, the device restricts the scans to the channels that recently produced results, with periodic full sweeps of the configured channels.",
+    )
+    wifi_search_country_code = BooleanField(
+        description="Enable or disable the country code search chained to the Wi-Fi scan. If set to True, the country codes found are joined to the scan results by MAC address.",
+    )
     wifi_mode = WifiModeField()
 
 
@@ -27,10 +27,14 @@ Define Almanac update strategy class
  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 """
 
+from zlib import crc32
 from ..SerialExchange import (
     CommandUpdateAlmanac,
     CommandCheckAlmanacUpdate,
+    CommandGetAlmanacSignatures,
     CommunicationHandler,
+    CommunicationHandlerNoResponse,
+    CommunicationHandlerUnknownResponseException,
 )
 from ..SerialExchange import ResponseUpdateAlmanac
 
@@ -62,37 +66,129 @@ class UpdateAlmanacCheckFailure(UpdateAlmanacException):
 
 
 class UpdateAlmanacJob:
+    SIZE_BLOCK = 20
+    N_SATELLITES = 128
+    N_SATELLITES_PER_SIGNATURE_REQUEST = 64
+
     def __init__(
         self,
         communication_handler: CommunicationHandler,
         almanac_bytestream: bytes,
         expected_crc: bytes,
         logger=None,
+        delta_update=True,
     ):
         self.almanac_bytestream = almanac_bytestream
         self.expected_crc = expected_crc
         self.communication_handler = communication_handler
         self.logger = logger
+        self.delta_update = delta_update
 
     def log(self, info):
         if self.logger:
             self.logger.log(info)
 
     def execute_update(self):
+        if self.delta_update:
+            blocks = self.get_delta_blocks()
+            if blocks == []:
+                # Nothing pushed: checking would fail on the device and drop its
+                # block signatures, forcing a full update next time
+                return
+            if blocks is not None:
+                self.push_blocks(blocks)
+                try:
+                    self.check_update()
+                    return
+                except UpdateAlmanacCheckFailure:
+                    self.log("Delta update check failed, falling back to full update")
         self.push_bytestream()
         self.check_update()
 
+    def split_blocks(self):
+        return [
+            self.almanac_bytestream[index : index + UpdateAlmanacJob.SIZE_BLOCK]
+            for index in range(
+                0, len(self.almanac_bytestream), UpdateAlmanacJob.SIZE_BLOCK
+            )
+        ]
+
+    def get_delta_blocks(self):
+        """Return the blocks differing from the almanac on the device
+
+        Return None if the device does not support delta update, including firmware
+        not knowing the signature command. The header block is always sent first
+        when at least one satellite block differs.
+        """
+        signatures = dict()
+        for first_satellite_id in range(
+            0,
+            UpdateAlmanacJob.N_SATELLITES,
+            UpdateAlmanacJob.N_SATELLITES_PER_SIGNATURE_REQUEST,
+        ):
+            command = CommandGetAlmanacSignatures(
+                first_satellite_id, UpdateAlmanacJob.N_SATELLITES_PER_SIGNATURE_REQUEST
+            )
+            try:
+                (
+                    command_sent,
+                    response_received,
+                ) = self.communication_handler.handle_exchange(command)
+            except (
+                CommunicationHandlerNoResponse,
+                CommunicationHandlerUnknownResponseException,
+            ) as exception:
+                self.log("Almanac signatures not available: {}".format(exception))
+                return None
+            if not self.is_exchange_valid(command_sent, response_received):
+                self.log(
+                    "Unexpected response to the almanac signatures request: {}".format(
+                        response_received
+                    )
+                )
+                return None
+            if not response_received.is_delta_update_supported:
+                self.log("Device does not support delta update")
+                return None
+            signatures.update(response_received.signature_per_satellites)
+
+        if response_received.almanac_crc == self.expected_crc:
+            self.log("Almanac already up to date")
+            return []
+
+        header_block, *satellite_blocks = self.split_blocks()
+        delta_blocks = [
+            block
+            for block in satellite_blocks
+            if self.is_block_different(block, signatures.get(block[0]))
+        ]
+        self.log(
+            "{} of {} satellite blocks differ".format(
+                len(delta_blocks), len(satellite_blocks)
+            )
+        )
+        if not delta_blocks:
+            # Same satellite dates but different CRC: let the full update resolve it
+            return None
+        return [header_block] + delta_blocks
+
+    @staticmethod
+    def is_block_different(block: bytes, signature):
+        if signature is None:
+            return True
+        if signature.is_block_crc_known:
+            return signature.block_crc != crc32(block)
+        block_date = int.from_bytes(block[1:3], byteorder="little")
+        return signature.date != block_date
+
     def push_bytestream(self):
-        def command_update_generator(bytestream: bytes):
-            size_burst = 20
-            for index in range(0, len(bytestream), size_burst):
-                burst_bytestream = bytestream[index : index + size_burst]
-                command_update_alamac = CommandUpdateAlmanac(burst_bytestream)
-                yield command_update_alamac
+        self.push_blocks(self.split_blocks())
 
+    def push_blocks(self, blocks):
         # Start by sending all the update commands
         self.log("Start downloading to embedded...")
-        for command in command_update_generator(self.almanac_bytestream):
+        for block in blocks:
+            command = CommandUpdateAlmanac(block)
             (
                 command_sent,
                 response_received,
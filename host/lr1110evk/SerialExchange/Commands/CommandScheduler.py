@@ -0,0 +1,70 @@
+"""
+Define scheduler serial command classes
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from enum import IntFlag
+from .CommandBase import CommandBase
+
+
+class SchedulerSink(IntFlag):
+    SERIAL = 1
+    LORAWAN = 2
+
+
+class CommandStartScheduler(CommandBase):
+    def __init__(self):
+        self.demo_command = None
+        self.sinks = SchedulerSink.SERIAL | SchedulerSink.LORAWAN
+        self.nb_scans = 0
+        self.interval_s = None
+        self.max_interval_s = 0
+
+    @staticmethod
+    def get_com_code():
+        return b"\x0c\x00"
+
+    def payload_to_bytes(self):
+        return (
+            self.demo_command.get_demo_id()
+            + int(self.sinks).to_bytes(1, byteorder="little")
+            + self.nb_scans.to_bytes(2, byteorder="little")
+            + self.interval_s.to_bytes(4, byteorder="little")
+            + self.max_interval_s.to_bytes(4, byteorder="little")
+        )
+
+
+class CommandStopScheduler(CommandBase):
+    def __init__(self):
+        pass
+
+    @staticmethod
+    def get_com_code():
+        return b"\x0c\x00"
+
+    def payload_to_bytes(self):
+        return b""
@@ -61,6 +61,25 @@ class GnssConstellation(Enum):
 class WifiMode(Enum):
     beacon_only = b"\x01"
     beacon_and_packet = b"\x02"
+    full_beacon_with_ssid = b"\x03"
+
+
+@unique
+class SpectrumSweepBandwidth(Enum):
+    bw_39000 = b"\x1c"
+    bw_58600 = b"\x0c"
+    bw_117300 = b"\x0b"
+    bw_187200 = b"\x12"
+    bw_312000 = b"\x19"
+    bw_467000 = b"\x09"
+
+
+@unique
+class CadSnifferBandwidth(Enum):
+    bw_62500 = b"\x03"
+    bw_125000 = b"\x04"
+    bw_250000 = b"\x05"
+    bw_500000 = b"\x06"
 
 
 @unique
@@ -126,6 +145,8 @@ class CommandStartWifiScan(CommandStartWifiBase):
         super().__init__()
         self.wifi_types = list()
         self.wifi_mode = None
+        self.wifi_adaptive_channel_mask = False
+        self.wifi_search_country_code = False
 
     def config_payload_to_byte(self):
         wifi_channel_mask_bytes = CommandStartWifiBase.channel_list_to_bit_mask(
@@ -143,6 +164,12 @@ class CommandStartWifiScan(CommandStartWifiBase):
         wifi_abort_on_timeout_byte = (
             b"\x01" if self.wifi_abort_on_timeout is True else b"\x00"
         )
+        wifi_adaptive_channel_mask_byte = (
+            b"\x01" if self.wifi_adaptive_channel_mask is True else b"\x00"
+        )
+        wifi_search_country_code_byte = (
+            b"\x01" if self.wifi_search_country_code is True else b"\x00"
+        )
 
         return (
             wifi_channel_mask_bytes
@@ -152,6 +179,8 @@ class CommandStartWifiScan(CommandStartWifiBase):
             + wifi_timeout_bytes
             + wifi_mode_byte
             + wifi_abort_on_timeout_byte
+            + wifi_adaptive_channel_mask_byte
+            + wifi_search_country_code_byte
         )
 
 
@@ -213,3 +242,86 @@ class CommandStartGnssAutonomous(CommandStartGnssBase):
 
 class CommandStartGnssAssisted(CommandStartGnssBase):
     DEMO_ID = b"\x04"
+
+
+class CommandStartSpectrumSweep(CommandStart):
+    DEMO_ID = b"\x05"
+
+    def __init__(self):
+        self.start_frequency_hz = None
+        self.step_frequency_hz = None
+        self.nb_channels = None
+        self.nb_samples_per_channel = None
+        self.nb_sweeps = None
+        self.rx_bandwidth = None
+
+    def config_payload_to_byte(self):
+        return (
+            self.start_frequency_hz.to_bytes(4, byteorder="little")
+            + self.step_frequency_hz.to_bytes(4, byteorder="little")
+            + self.nb_channels.to_bytes(1, byteorder="little")
+            + self.nb_samples_per_channel.to_bytes(1, byteorder="little")
+            + self.nb_sweeps.to_bytes(2, byteorder="little")
+            + self.rx_bandwidth.value
+        )
+
+
+class CommandStartCadSniffer(CommandStart):
+    DEMO_ID = b"\x06"
+
+    def __init__(self):
+        self.frequencies_hz = None
+        self.spreading_factors = None
+        self.bandwidth = None
+        self.cad_symb_nb = None
+        self.cad_detect_peak = None
+        self.cad_detect_min = None
+        self.nb_cycles = None
+
+    def config_payload_to_byte(self):
+        sf_mask = 0
+        for spreading_factor in self.spreading_factors:
+            sf_mask |= 1 << spreading_factor
+        return (
+            len(self.frequencies_hz).to_bytes(1, byteorder="little")
+            + sf_mask.to_bytes(2, byteorder="little")
+            + self.bandwidth.value
+            + self.cad_symb_nb.to_bytes(1, byteorder="little")
+            + self.cad_detect_peak.to_bytes(1, byteorder="little")
+            + self.cad_detect_min.to_bytes(1, byteorder="little")
+            + self.nb_cycles.to_bytes(2, byteorder="little")
+            + b"".join(
+                [
+                    frequency_hz.to_bytes(4, byteorder="little")
+                    for frequency_hz in self.frequencies_hz
+                ]
+            )
+        )
+
+
+class CommandStartRxDutyCycle(CommandStart):
+    DEMO_ID = b"\x07"
+
+    def __init__(self):
+        self.rx_period_ms = None
+        self.sleep_period_ms = None
+
+    def config_payload_to_byte(self):
+        return (
+            self.rx_period_ms.to_bytes(4, byteorder="little")
+            + self.sleep_period_ms.to_bytes(4, byteorder="little")
+        )
+
+
+class CommandStartGeolocation(CommandStart):
+    DEMO_ID = b"\x08"
+
+    def __init__(self):
+        self.wifi_scan = CommandStartWifiScan()
+        self.gnss_autonomous = CommandStartGnssAutonomous()
+
+    def config_payload_to_byte(self):
+        return (
+            self.wifi_scan.config_payload_to_byte()
+            + self.gnss_autonomous.config_payload_to_byte()
+        )
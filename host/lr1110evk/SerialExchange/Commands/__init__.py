@@ -6,15 +6,30 @@ from .CommandStart import (
     CommandStartWifiCountryCode,
     CommandStartGnssAutonomous,
     CommandStartGnssAssisted,
+    CommandStartSpectrumSweep,
+    CommandStartCadSniffer,
+    CommandStartRxDutyCycle,
+    CommandStartGeolocation,
     GnssOption,
     GnssCaptureMode,
     GnssConstellation,
     WifiMode,
     WifiEnableMode,
     GnssAntennaSelection,
+    SpectrumSweepBandwidth,
+    CadSnifferBandwidth,
 )
 from .CommandStatus import CommandStatus
 from .CommandGetVersion import CommandGetVersion
 from .CommandGetAlmanacDates import CommandGetAlmanacDates
 from .CommandUpdateAlmanac import CommandUpdateAlmanac
 from .CommandCheckAlmanacUpdate import CommandCheckAlmanacUpdate
+from .CommandGetPowerStatistics import CommandGetPowerStatistics
+from .CommandGetDisplayStatistics import CommandGetDisplayStatistics
+from .CommandGetHeapStatistics import CommandGetHeapStatistics
+from .CommandGetAlmanacSignatures import CommandGetAlmanacSignatures
+from .CommandScheduler import (
+    CommandStartScheduler,
+    CommandStopScheduler,
+    SchedulerSink,
+)
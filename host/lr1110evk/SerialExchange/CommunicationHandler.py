@@ -34,6 +34,7 @@ from .Responses import (
     ResponseConfigureAck,
     ResponseFetchResult,
     ResponseWifiResult,
+    ResponseWifiExtendedResult,
     ResponseGnssAutonomousResult,
     ResponseGnssAssistedResult,
     ResponseReset,
@@ -44,6 +45,14 @@ from .Responses import (
     ResponseAlmanacDates,
     ResponseUpdateAlmanac,
     ResponseCheckAlmanacUpdate,
+    ResponsePowerStatistics,
+    ResponseDisplayStatistics,
+    ResponseHeapStatistics,
+    ResponseAlmanacSignatures,
+    ResponseSpectrumSweepResult,
+    ResponseCadSnifferResult,
+    ResponseRxDutyCycleResult,
+    ResponseSchedulerAck,
 )
 
 
@@ -82,6 +91,7 @@ class CommunicationHandler:
         ResponseConfigureAck,
         ResponseFetchResult,
         ResponseWifiResult,
+        ResponseWifiExtendedResult,
         ResponseGnssAutonomousResult,
         ResponseGnssAssistedResult,
         ResponseReset,
@@ -92,6 +102,14 @@ class CommunicationHandler:
         ResponseAlmanacDates,
         ResponseUpdateAlmanac,
         ResponseCheckAlmanacUpdate,
+        ResponsePowerStatistics,
+        ResponseDisplayStatistics,
+        ResponseHeapStatistics,
+        ResponseAlmanacSignatures,
+        ResponseSpectrumSweepResult,
+        ResponseCadSnifferResult,
+        ResponseRxDutyCycleResult,
+        ResponseSchedulerAck,
     ]
 
     def __init__(self, serial_handler, logger):
@@ -0,0 +1,131 @@
+"""
+Define almanac signatures serial response class
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from .ResponseBase import ResponseBase, ResponseMalformedException
+
+
+class AlmanacSatelliteSignature:
+    def __init__(self, date, block_crc):
+        self.date = date
+        self.block_crc = block_crc
+
+    @property
+    def is_block_crc_known(self):
+        return self.block_crc != 0
+
+    def __str__(self):
+        return "{} (block CRC 0x{:08x})".format(self.date, self.block_crc)
+
+
+class ResponseAlmanacSignatures(ResponseBase):
+    SIZE_HEADER_RAW_BYTES = 9
+    SIZE_SAT_SIGNATURE_RAW_BYTES = 6
+    FLAG_DELTA_UPDATE_SUPPORTED = 0x01
+
+    def __init__(
+        self,
+        reception_time,
+        is_delta_update_supported,
+        almanac_crc,
+        oldest_almanac_date,
+        signature_per_satellites,
+    ):
+        super().__init__(reception_time)
+        self.is_delta_update_supported = is_delta_update_supported
+        self.almanac_crc = almanac_crc
+        # Oldest date among the satellites having an almanac, 0 if none
+        self.oldest_almanac_date = oldest_almanac_date
+        self.signature_per_satellites = signature_per_satellites
+
+    def __str__(self):
+        return (
+            "Almanac signatures (CRC 0x{:08x}, oldest date {}, "
+            "delta update {}):\n{}".format(
+                self.almanac_crc,
+                self.oldest_almanac_date,
+                "supported" if self.is_delta_update_supported else "not supported",
+                ";".join(
+                    [
+                        "{}: {}".format(sat, signature)
+                        for sat, signature in self.signature_per_satellites.items()
+                    ]
+                ),
+            )
+        )
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x0b\x00"
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) < ResponseAlmanacSignatures.SIZE_HEADER_RAW_BYTES:
+            raise ResponseMalformedException(response_raw)
+
+        flags = payload[0]
+        almanac_crc = int.from_bytes(payload[1:5], byteorder="little")
+        oldest_almanac_date = int.from_bytes(payload[5:7], byteorder="little")
+        first_satellite_id = payload[7]
+        n_satellites = payload[8]
+
+        raw_signatures = payload[ResponseAlmanacSignatures.SIZE_HEADER_RAW_BYTES :]
+        if len(raw_signatures) != (
+            n_satellites * ResponseAlmanacSignatures.SIZE_SAT_SIGNATURE_RAW_BYTES
+        ):
+            raise ResponseMalformedException(response_raw)
+
+        signature_per_satellites = dict()
+        for index, raw_signature in enumerate(
+            ResponseAlmanacSignatures.chunker(
+                raw_signatures, ResponseAlmanacSignatures.SIZE_SAT_SIGNATURE_RAW_BYTES
+            )
+        ):
+            satellite_id = first_satellite_id + index
+            signature_per_satellites[satellite_id] = AlmanacSatelliteSignature(
+                date=int.from_bytes(raw_signature[0:2], byteorder="little"),
+                block_crc=int.from_bytes(raw_signature[2:6], byteorder="little"),
+            )
+
+        response = ResponseAlmanacSignatures(
+            reception_time=response_raw.receive_time,
+            is_delta_update_supported=bool(
+                flags & ResponseAlmanacSignatures.FLAG_DELTA_UPDATE_SUPPORTED
+            ),
+            almanac_crc=almanac_crc,
+            oldest_almanac_date=oldest_almanac_date,
+            signature_per_satellites=signature_per_satellites,
+        )
+        return response
+
+    @staticmethod
+    # From https://stackoverflow.com/a/434328
+    def chunker(sequence, size):
+        for pos in range(0, len(sequence), size):
+            yield sequence[pos : pos + size]
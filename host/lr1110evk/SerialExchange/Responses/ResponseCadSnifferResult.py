@@ -0,0 +1,158 @@
+"""
+Define CAD sniffer result serial response class
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from .ResponseBase import ResponseBase, ResponseMalformedException
+
+
+class CadSnifferChannelResult:
+    LOWEST_SF = 5
+
+    def __init__(
+        self,
+        frequency_hz,
+        nb_cad,
+        nb_detections,
+        cad_time_ms,
+        activity_permille,
+        detections_per_sf,
+    ):
+        self.frequency_hz = frequency_hz
+        self.nb_cad = nb_cad
+        self.nb_detections = nb_detections
+        self.cad_time_ms = cad_time_ms
+        self.activity_permille = activity_permille
+        self.detections_per_sf = detections_per_sf
+
+    def __str__(self):
+        detections = ", ".join(
+            [
+                "SF{}: {}".format(sf, count)
+                for sf, count in self.detections_per_sf.items()
+                if count != 0
+            ]
+        )
+        return "{} Hz: {}/{} detections ({:.1f} %), {} ms in CAD [{}]".format(
+            self.frequency_hz,
+            self.nb_detections,
+            self.nb_cad,
+            self.activity_permille / 10,
+            self.cad_time_ms,
+            detections,
+        )
+
+
+class ResponseCadSnifferResult(ResponseBase):
+    SIZE_HEADER_RAW_BYTES = 11
+    SIZE_CHANNEL_RAW_BYTES = 34
+    NB_SPREADING_FACTORS = 8
+
+    def __init__(
+        self,
+        reception_time,
+        sf_mask,
+        nb_cycles,
+        elapsed_ms,
+        cad_duty_cycle_permille,
+        channels,
+    ):
+        super().__init__(reception_time)
+        self.sf_mask = sf_mask
+        self.nb_cycles = nb_cycles
+        self.elapsed_ms = elapsed_ms
+        self.cad_duty_cycle_permille = cad_duty_cycle_permille
+        self.channels = channels
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) < ResponseCadSnifferResult.SIZE_HEADER_RAW_BYTES:
+            raise ResponseMalformedException(response_raw)
+
+        nb_channels = payload[0]
+        sf_mask = int.from_bytes(payload[1:3], byteorder="little")
+        nb_cycles = int.from_bytes(payload[3:5], byteorder="little")
+        elapsed_ms = int.from_bytes(payload[5:9], byteorder="little")
+        cad_duty_cycle_permille = int.from_bytes(payload[9:11], byteorder="little")
+
+        raw_channels = payload[ResponseCadSnifferResult.SIZE_HEADER_RAW_BYTES :]
+        if len(raw_channels) != (
+            nb_channels * ResponseCadSnifferResult.SIZE_CHANNEL_RAW_BYTES
+        ):
+            raise ResponseMalformedException(response_raw)
+
+        channels = list()
+        for raw_channel in ResponseCadSnifferResult.chunker(
+            raw_channels, ResponseCadSnifferResult.SIZE_CHANNEL_RAW_BYTES
+        ):
+            detections_per_sf = dict()
+            for index in range(ResponseCadSnifferResult.NB_SPREADING_FACTORS):
+                spreading_factor = index + CadSnifferChannelResult.LOWEST_SF
+                detections_per_sf[spreading_factor] = int.from_bytes(
+                    raw_channel[18 + 2 * index : 20 + 2 * index], byteorder="little"
+                )
+            channels.append(
+                CadSnifferChannelResult(
+                    frequency_hz=int.from_bytes(raw_channel[0:4], byteorder="little"),
+                    nb_cad=int.from_bytes(raw_channel[4:8], byteorder="little"),
+                    nb_detections=int.from_bytes(raw_channel[8:12], byteorder="little"),
+                    cad_time_ms=int.from_bytes(raw_channel[12:16], byteorder="little"),
+                    activity_permille=int.from_bytes(
+                        raw_channel[16:18], byteorder="little"
+                    ),
+                    detections_per_sf=detections_per_sf,
+                )
+            )
+
+        response = ResponseCadSnifferResult(
+            reception_time=response_raw.receive_time,
+            sf_mask=sf_mask,
+            nb_cycles=nb_cycles,
+            elapsed_ms=elapsed_ms,
+            cad_duty_cycle_permille=cad_duty_cycle_permille,
+            channels=channels,
+        )
+        return response
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x86\x00"
+
+    def __str__(self):
+        return "CadSnifferResult({} cycles, {} ms, CAD {:.1f} %):\n{}".format(
+            self.nb_cycles,
+            self.elapsed_ms,
+            self.cad_duty_cycle_permille / 10,
+            "\n".join([str(channel) for channel in self.channels]),
+        )
+
+    @staticmethod
+    # From https://stackoverflow.com/a/434328
+    def chunker(sequence, size):
+        for pos in range(0, len(sequence), size):
+            yield sequence[pos : pos + size]
@@ -0,0 +1,107 @@
+"""
+Define display statistics response class
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from .ResponseBase import ResponseBase, ResponseMalformedException
+
+
+class ResponseDisplayStatistics(ResponseBase):
+    FIELDS = [
+        "frame_count",
+        "frames_per_second",
+        "render_time_us_last",
+        "render_time_us_max",
+        "render_time_us_total",
+        "flush_time_us_last",
+        "flush_time_us_max",
+        "flush_time_us_total",
+        "area_px_last",
+        "area_px_max",
+        "area_px_total",
+    ]
+    SIZE_FIELD_BYTES = 4
+
+    def __init__(self, reception_time, statistics):
+        super().__init__(reception_time)
+        self.statistics = statistics
+
+    def get_average(self, field_total):
+        if self.statistics["frame_count"] == 0:
+            return 0
+        return self.statistics[field_total] / self.statistics["frame_count"]
+
+    def __str__(self):
+        return (
+            "Display statistics: {} frames, {} fps\n"
+            "render: {} us last, {} us max, {:.0f} us average\n"
+            "flush: {} us last, {} us max, {:.0f} us average\n"
+            "area: {} px last, {} px max, {:.0f} px average".format(
+                self.statistics["frame_count"],
+                self.statistics["frames_per_second"],
+                self.statistics["render_time_us_last"],
+                self.statistics["render_time_us_max"],
+                self.get_average("render_time_us_total"),
+                self.statistics["flush_time_us_last"],
+                self.statistics["flush_time_us_max"],
+                self.get_average("flush_time_us_total"),
+                self.statistics["area_px_last"],
+                self.statistics["area_px_max"],
+                self.get_average("area_px_total"),
+            )
+        )
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x0d\x00"
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        if len(response_raw.payload_bytes) != (
+            len(ResponseDisplayStatistics.FIELDS)
+            * ResponseDisplayStatistics.SIZE_FIELD_BYTES
+        ):
+            raise ResponseMalformedException(response_raw)
+
+        fields = [
+            int.from_bytes(raw_field, byteorder="little")
+            for raw_field in ResponseDisplayStatistics.chunker(
+                response_raw.payload_bytes, ResponseDisplayStatistics.SIZE_FIELD_BYTES
+            )
+        ]
+
+        response = ResponseDisplayStatistics(
+            reception_time=response_raw.receive_time,
+            statistics=dict(zip(ResponseDisplayStatistics.FIELDS, fields)),
+        )
+        return response
+
+    @staticmethod
+    # From https://stackoverflow.com/a/434328
+    def chunker(sequence, size):
+        for pos in range(0, len(sequence), size):
+            yield sequence[pos : pos + size]
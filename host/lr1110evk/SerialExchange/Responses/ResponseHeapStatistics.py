@@ -0,0 +1,86 @@
+"""
+Define heap statistics response class
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from .ResponseBase import ResponseBase, ResponseMalformedException
+
+
+class ResponseHeapStatistics(ResponseBase):
+    FIELDS = [
+        "allocation_count",
+        "free_count",
+        "allocated_bytes",
+        "allocated_bytes_max",
+    ]
+    SIZE_FIELD_BYTES = 4
+
+    def __init__(self, reception_time, statistics):
+        super().__init__(reception_time)
+        self.statistics = statistics
+
+    def __str__(self):
+        return (
+            "Heap statistics: {} allocations, {} frees\n"
+            "allocated: {} bytes, {} bytes max".format(
+                self.statistics["allocation_count"],
+                self.statistics["free_count"],
+                self.statistics["allocated_bytes"],
+                self.statistics["allocated_bytes_max"],
+            )
+        )
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x0e\x00"
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        if len(response_raw.payload_bytes) != (
+            len(ResponseHeapStatistics.FIELDS)
+            * ResponseHeapStatistics.SIZE_FIELD_BYTES
+        ):
+            raise ResponseMalformedException(response_raw)
+
+        fields = [
+            int.from_bytes(raw_field, byteorder="little")
+            for raw_field in ResponseHeapStatistics.chunker(
+                response_raw.payload_bytes, ResponseHeapStatistics.SIZE_FIELD_BYTES
+            )
+        ]
+
+        response = ResponseHeapStatistics(
+            reception_time=response_raw.receive_time,
+            statistics=dict(zip(ResponseHeapStatistics.FIELDS, fields)),
+        )
+        return response
+
+    @staticmethod
+    # From https://stackoverflow.com/a/434328
+    def chunker(sequence, size):
+        for pos in range(0, len(sequence), size):
+            yield sequence[pos : pos + size]
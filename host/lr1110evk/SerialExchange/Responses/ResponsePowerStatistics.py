@@ -0,0 +1,114 @@
+"""
+Define power statistics response class
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from .ResponseBase import ResponseBase, ResponseMalformedException
+
+
+class ResponsePowerStatistics(ResponseBase):
+    POWER_MODES = ["run", "sleep", "stop2"]
+    WAKEUP_SOURCES = ["lptim", "radio", "touch", "uart", "other"]
+    SIZE_FIELD_BYTES = 4
+
+    def __init__(
+        self,
+        reception_time,
+        entry_count_per_mode,
+        time_ms_per_mode,
+        wakeup_count_per_source,
+    ):
+        super().__init__(reception_time)
+        self.entry_count_per_mode = entry_count_per_mode
+        self.time_ms_per_mode = time_ms_per_mode
+        self.wakeup_count_per_source = wakeup_count_per_source
+
+    def __str__(self):
+        return "Power statistics:\n{}\nWake-up sources: {}".format(
+            "\n".join(
+                [
+                    "{}: {} ms ({} entries)".format(
+                        mode,
+                        self.time_ms_per_mode[mode],
+                        self.entry_count_per_mode[mode],
+                    )
+                    for mode in ResponsePowerStatistics.POWER_MODES
+                ]
+            ),
+            ";".join(
+                [
+                    "{}: {}".format(source, count)
+                    for source, count in self.wakeup_count_per_source.items()
+                ]
+            ),
+        )
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x0a\x00"
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        n_fields = 2 * len(ResponsePowerStatistics.POWER_MODES) + len(
+            ResponsePowerStatistics.WAKEUP_SOURCES
+        )
+        if len(response_raw.payload_bytes) != (
+            n_fields * ResponsePowerStatistics.SIZE_FIELD_BYTES
+        ):
+            raise ResponseMalformedException(response_raw)
+
+        fields = [
+            int.from_bytes(raw_field, byteorder="little")
+            for raw_field in ResponsePowerStatistics.chunker(
+                response_raw.payload_bytes, ResponsePowerStatistics.SIZE_FIELD_BYTES
+            )
+        ]
+
+        entry_count_per_mode = dict()
+        time_ms_per_mode = dict()
+        for index_mode, mode in enumerate(ResponsePowerStatistics.POWER_MODES):
+            entry_count_per_mode[mode] = fields[2 * index_mode]
+            time_ms_per_mode[mode] = fields[2 * index_mode + 1]
+
+        n_mode_fields = 2 * len(ResponsePowerStatistics.POWER_MODES)
+        wakeup_count_per_source = dict()
+        for index_source, source in enumerate(ResponsePowerStatistics.WAKEUP_SOURCES):
+            wakeup_count_per_source[source] = fields[n_mode_fields + index_source]
+
+        response = ResponsePowerStatistics(
+            reception_time=response_raw.receive_time,
+            entry_count_per_mode=entry_count_per_mode,
+            time_ms_per_mode=time_ms_per_mode,
+            wakeup_count_per_source=wakeup_count_per_source,
+        )
+        return response
+
+    @staticmethod
+    # From https://stackoverflow.com/a/434328
+    def chunker(sequence, size):
+        for pos in range(0, len(sequence), size):
+            yield sequence[pos : pos + size]
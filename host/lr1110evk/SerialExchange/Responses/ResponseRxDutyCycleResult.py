@@ -0,0 +1,91 @@
+"""
+Define duty-cycled RX result serial response class
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from .ResponseBase import ResponseBase, ResponseMalformedException
+
+
+class ResponseRxDutyCycleResult(ResponseBase):
+    SIZE_RAW_BYTES = 28
+
+    def __init__(
+        self,
+        reception_time,
+        count_rx_correct_packet,
+        count_rx_wrong_packet,
+        count_preamble_detected,
+        count_missed_preamble,
+        rx_time_ms,
+        sleep_time_ms,
+        average_current_na,
+    ):
+        super().__init__(reception_time)
+        self.count_rx_correct_packet = count_rx_correct_packet
+        self.count_rx_wrong_packet = count_rx_wrong_packet
+        self.count_preamble_detected = count_preamble_detected
+        self.count_missed_preamble = count_missed_preamble
+        self.rx_time_ms = rx_time_ms
+        self.sleep_time_ms = sleep_time_ms
+        self.average_current_na = average_current_na
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) != ResponseRxDutyCycleResult.SIZE_RAW_BYTES:
+            raise ResponseMalformedException(response_raw)
+
+        values = [
+            int.from_bytes(raw_value, byteorder="little")
+            for raw_value in ResponseRxDutyCycleResult.chunker(payload, 4)
+        ]
+        response = ResponseRxDutyCycleResult(response_raw.receive_time, *values)
+        return response
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x87\x00"
+
+    def __str__(self):
+        return (
+            "RxDutyCycleResult: {} correct, {} wrong, {} preambles ({} missed), "
+            "{} ms RX, {} ms sleep, average current {:.1f} uA".format(
+                self.count_rx_correct_packet,
+                self.count_rx_wrong_packet,
+                self.count_preamble_detected,
+                self.count_missed_preamble,
+                self.rx_time_ms,
+                self.sleep_time_ms,
+                self.average_current_na / 1000,
+            )
+        )
+
+    @staticmethod
+    # From https://stackoverflow.com/a/434328
+    def chunker(sequence, size):
+        for pos in range(0, len(sequence), size):
+            yield sequence[pos : pos + size]
@@ -0,0 +1,111 @@
+"""
+Define RSSI spectrum sweep result serial response class
+
+ Revised BSD License
+ Copyright Semtech Corporation 2020. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+     * Redistributions of source code must retain the above copyright
+       notice, this list of conditions and the following disclaimer.
+     * Redistributions in binary form must reproduce the above copyright
+       notice, this list of conditions and the following disclaimer in the
+       documentation and/or other materials provided with the distribution.
+     * Neither the name of the Semtech corporation nor the
+       names of its contributors may be used to endorse or promote products
+       derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ ARE DISCLAIMED. IN NO EVENT SHALL SEMTECH CORPORATION BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""
+
+from .ResponseBase import ResponseBase, ResponseMalformedException
+
+
+class SpectrumSweepChannelResult:
+    def __init__(self, frequency_hz, rssi_min, rssi_max, rssi_mean):
+        self.frequency_hz = frequency_hz
+        self.rssi_min = rssi_min
+        self.rssi_max = rssi_max
+        self.rssi_mean = rssi_mean
+
+    def __str__(self):
+        return "{} Hz: min {} dBm, max {} dBm, mean {} dBm".format(
+            self.frequency_hz, self.rssi_min, self.rssi_max, self.rssi_mean
+        )
+
+
+class ResponseSpectrumSweepResult(ResponseBase):
+    SIZE_HEADER_RAW_BYTES = 11
+    SIZE_CHANNEL_RAW_BYTES = 3
+
+    def __init__(self, reception_time, nb_sweeps, channels):
+        super().__init__(reception_time)
+        self.nb_sweeps = nb_sweeps
+        self.channels = channels
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        payload = response_raw.payload_bytes
+        if len(payload) < ResponseSpectrumSweepResult.SIZE_HEADER_RAW_BYTES:
+            raise ResponseMalformedException(response_raw)
+
+        start_frequency_hz = int.from_bytes(payload[0:4], byteorder="little")
+        step_frequency_hz = int.from_bytes(payload[4:8], byteorder="little")
+        nb_channels = payload[8]
+        nb_sweeps = int.from_bytes(payload[9:11], byteorder="little")
+
+        raw_channels = payload[ResponseSpectrumSweepResult.SIZE_HEADER_RAW_BYTES :]
+        if len(raw_channels) != (
+            nb_channels * ResponseSpectrumSweepResult.SIZE_CHANNEL_RAW_BYTES
+        ):
+            raise ResponseMalformedException(response_raw)
+
+        channels = list()
+        for index, raw_channel in enumerate(
+            ResponseSpectrumSweepResult.chunker(
+                raw_channels, ResponseSpectrumSweepResult.SIZE_CHANNEL_RAW_BYTES
+            )
+        ):
+            rssi_min, rssi_max, rssi_mean = [
+                int.from_bytes(raw_channel[i : i + 1], byteorder="little", signed=True)
+                for i in range(ResponseSpectrumSweepResult.SIZE_CHANNEL_RAW_BYTES)
+            ]
+            channels.append(
+                SpectrumSweepChannelResult(
+                    frequency_hz=start_frequency_hz + index * step_frequency_hz,
+                    rssi_min=rssi_min,
+                    rssi_max=rssi_max,
+                    rssi_mean=rssi_mean,
+                )
+            )
+
+        response = ResponseSpectrumSweepResult(
+            reception_time=response_raw.receive_time,
+            nb_sweeps=nb_sweeps,
+            channels=channels,
+        )
+        return response
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x85\x00"
+
+    def __str__(self):
+        return "SpectrumSweepResult({} sweeps):\n{}".format(
+            self.nb_sweeps, "\n".join([str(channel) for channel in self.channels])
+        )
+
+    @staticmethod
+    # From https://stackoverflow.com/a/434328
+    def chunker(sequence, size):
+        for pos in range(0, len(sequence), size):
+            yield sequence[pos : pos + size]
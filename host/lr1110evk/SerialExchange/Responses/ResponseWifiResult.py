@@ -32,24 +32,102 @@ from lr1110evk.BaseTypes import ScannedMacAddress
 
 
 class ResponseWifiResult(ResponseBase):
-    def __init__(self, receive_time, mac_address):
+    SIZE_BASIC_RAW_BYTES = 25
+    SIZE_COUNTRY_CODE_RAW_BYTES = 3
+
+    def __init__(
+        self, receive_time, mac_address, country_code=None, country_code_error=False
+    ):
         super().__init__(receive_time)
         self.mac_address = mac_address
+        # None unless a country code search was chained to the scan
+        self.country_code = country_code
+        self.country_code_error = country_code_error
 
     @classmethod
     def from_response_raw(cls, response_raw):
         receive_time = response_raw.receive_time
-        mac_address = ScannedMacAddress.from_bytes(
-            response_raw.payload_bytes, receive_time
+        payload = response_raw.payload_bytes
+        basic_size = ResponseWifiResult.SIZE_BASIC_RAW_BYTES
+        mac_address = ScannedMacAddress.from_bytes(payload[:basic_size], receive_time)
+        country_code, country_code_error = ResponseWifiResult.parse_country_code(
+            payload[basic_size:]
         )
         response_mac_address = ResponseWifiResult(
-            receive_time=receive_time, mac_address=mac_address
+            receive_time=receive_time,
+            mac_address=mac_address,
+            country_code=country_code,
+            country_code_error=country_code_error,
         )
         return response_mac_address
 
+    @staticmethod
+    def parse_country_code(raw_bytes):
+        """Parse the optional country code fields ending a Wi-Fi result
+
+        Return the country code, or None if absent, and whether the country code
+        search failed.
+        """
+        if len(raw_bytes) < ResponseWifiResult.SIZE_COUNTRY_CODE_RAW_BYTES:
+            return None, False
+        country_code = raw_bytes[0:2].decode("ascii", errors="replace")
+        country_code_error = raw_bytes[2] != 0
+        return country_code, country_code_error
+
+    def country_code_str(self):
+        if self.country_code is None:
+            return ""
+        if self.country_code_error:
+            return " country code search failed"
+        return " country code {}".format(self.country_code)
+
     @classmethod
     def get_response_code(cls):
         return b"\x81\x00"
 
     def __str__(self):
-        return "WifiResult({}): {}".format(self.reception_time, self.mac_address)
+        return "WifiResult({}): {}{}".format(
+            self.reception_time, self.mac_address, self.country_code_str()
+        )
+
+
+class ResponseWifiExtendedResult(ResponseWifiResult):
+    def __init__(
+        self,
+        receive_time,
+        mac_address,
+        ssid,
+        country_code=None,
+        country_code_error=False,
+    ):
+        super().__init__(receive_time, mac_address, country_code, country_code_error)
+        self.ssid = ssid
+
+    @classmethod
+    def from_response_raw(cls, response_raw):
+        receive_time = response_raw.receive_time
+        payload = response_raw.payload_bytes
+        basic_size = ResponseWifiExtendedResult.SIZE_BASIC_RAW_BYTES
+        mac_address = ScannedMacAddress.from_bytes(payload[:basic_size], receive_time)
+        ssid_length = payload[basic_size]
+        ssid_end = basic_size + 1 + ssid_length
+        ssid = payload[basic_size + 1 : ssid_end].decode("utf-8", errors="replace")
+        country_code, country_code_error = ResponseWifiResult.parse_country_code(
+            payload[ssid_end:]
+        )
+        return ResponseWifiExtendedResult(
+            receive_time=receive_time,
+            mac_address=mac_address,
+            ssid=ssid,
+            country_code=country_code,
+            country_code_error=country_code_error,
+        )
+
+    @classmethod
+    def get_response_code(cls):
+        return b"\x88\x00"
+
+    def __str__(self):
+        return "WifiExtendedResult({}): {} '{}'{}".format(
+            self.reception_time, self.mac_address, self.ssid, self.country_code_str()
+        )
@@ -9,8 +9,25 @@ from .ResponseLog import ResponseLog
 from .ResponseSetDateLocAck import ResponseSetDateLoc
 from .ResponseStartAck import ResponseStartAck
 from .ResponseStatus import ResponseStatus
-from .ResponseWifiResult import ResponseWifiResult
+from .ResponseWifiResult import ResponseWifiResult, ResponseWifiExtendedResult
 from .ResponseVersion import ResponseVersion
 from .ResponseAlmanacDates import ResponseAlmanacDates
 from .ResponseUpdateAlmanac import ResponseUpdateAlmanac
 from .ResponseCheckAlmanacUpdate import ResponseCheckAlmanacUpdate
+from .ResponsePowerStatistics import ResponsePowerStatistics
+from .ResponseDisplayStatistics import ResponseDisplayStatistics
+from .ResponseHeapStatistics import ResponseHeapStatistics
+from .ResponseSpectrumSweepResult import (
+    ResponseSpectrumSweepResult,
+    SpectrumSweepChannelResult,
+)
+from .ResponseCadSnifferResult import (
+    ResponseCadSnifferResult,
+    CadSnifferChannelResult,
+)
+from .ResponseRxDutyCycleResult import ResponseRxDutyCycleResult
+from .ResponseSchedulerAck import ResponseSchedulerAck
+from .ResponseAlmanacSignatures import (
+    ResponseAlmanacSignatures,
+    AlmanacSatelliteSignature,
+)
@@ -5,6 +5,8 @@ from .Commands import (
     GnssConstellation,
     WifiMode,
     WifiEnableMode,
+    SpectrumSweepBandwidth,
+    CadSnifferBandwidth,
     CommandFetchResults,
     CommandReset,
     CommandSetDateLoc,
@@ -12,11 +14,19 @@ from .Commands import (
     CommandStartWifiCountryCode,
     CommandStartGnssAutonomous,
     CommandStartGnssAssisted,
+    CommandStartSpectrumSweep,
+    CommandStartCadSniffer,
+    CommandStartRxDutyCycle,
+    CommandStartGeolocation,
     CommandStatus,
     CommandGetVersion,
     CommandGetAlmanacDates,
     CommandUpdateAlmanac,
     CommandCheckAlmanacUpdate,
+    CommandGetAlmanacSignatures,
+    CommandStartScheduler,
+    CommandStopScheduler,
+    SchedulerSink,
 )
 from .Responses import (
     ResponseRaw,
@@ -31,10 +41,16 @@ from .Responses import (
     ResponseStartAck,
     ResponseStatus,
     ResponseWifiResult,
+    ResponseWifiExtendedResult,
     ResponseVersion,
     ResponseAlmanacDates,
     ResponseUpdateAlmanac,
     ResponseCheckAlmanacUpdate,
+    ResponseAlmanacSignatures,
+    ResponseSpectrumSweepResult,
+    ResponseCadSnifferResult,
+    ResponseRxDutyCycleResult,
+    ResponseSchedulerAck,
 )
 from .SerialHandler import (
     SerialHandler,
@@ -45,4 +61,5 @@ from .CommunicationHandler import (
     CommunicationHandlerException,
     CommunicationHandlerNoResponse,
     CommunicationHandlerSerialNotListeningException,
+    CommunicationHandlerUnknownResponseException,
 )
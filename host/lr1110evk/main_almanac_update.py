@@ -183,6 +183,11 @@ def entry_point_update_almanac():
         help="File to use to store the log (default={})".format(default_log_filename),
         default=default_log_filename,
     )
+    parser.add_argument(
+        "--full",
+        help="Send all the almanac blocks instead of only the ones differing from the device",
+        action="store_true",
+    )
     parser.add_argument("--version", action="version", version=version)
     args = parser.parse_args()
 
@@ -248,6 +253,7 @@ def entry_point_update_almanac():
         almanac_bytestream=almanac_bin,
         expected_crc=almanac_crc,
         logger=log_logger,
+        delta_update=not args.full,
     )
 
     try: